@@ -74,7 +74,10 @@ extern "C" {
 #define ODSDEMO_OUTPUT_MSG_NOISE_PROFILE    MMWDEMO_OUTPUT_MSG_NOISE_PROFILE
 #define ODSDEMO_OUTPUT_MSG_AZIMUT_STATIC_HEAT_MAP   MMWDEMO_OUTPUT_MSG_AZIMUT_STATIC_HEAT_MAP
 #define ODSDEMO_OUTPUT_MSG_RANGE_DOPPLER_HEAT_MAP   MMWDEMO_OUTPUT_MSG_RANGE_DOPPLER_HEAT_MAP
-#define ODSDEMO_OUTPUT_MSG_MAX             MMWDEMO_OUTPUT_MSG_MAX
+
+/* ODS specific TLVs, numbered after the SDK ones */
+#define ODSDEMO_OUTPUT_MSG_DETECTED_POINTS_SUB_BIN  MMWDEMO_OUTPUT_MSG_MAX
+#define ODSDEMO_OUTPUT_MSG_MAX             (MMWDEMO_OUTPUT_MSG_MAX + 1)
 
 /**
  * @brief
@@ -107,6 +110,15 @@ typedef enum OdsDemo_message_type_e
     ODSDEMO_MSS2DSS_LVDSSTREAM_CFG,
     ODSDEMO_MSS2DSS_CQ_SIGIMG_MONITOR,
     ODSDEMO_MSS2DSS_ANALOG_MONITOR,
+    ODSDEMO_MSS2DSS_STATIC_CLUTTER_CFG,
+    ODSDEMO_MSS2DSS_RANGE_FFT_BATCH_CFG,
+    ODSDEMO_MSS2DSS_RADAR_CUBE_BFP_CFG,
+    ODSDEMO_MSS2DSS_RADAR_CUBE_LAYOUT_CFG,
+    ODSDEMO_MSS2DSS_OBJ_CAP_CFG,
+    ODSDEMO_MSS2DSS_SUB_BIN_INTERP_CFG,
+    ODSDEMO_MSS2DSS_CFAR_THR_TABLE_RANGE_CFG,
+    ODSDEMO_MSS2DSS_CFAR_THR_TABLE_DOPPLER_CFG,
+    ODSDEMO_MSS2DSS_CFAR_THR_CALIB_CFG,
  
     /*! @brief   message types for DSS to MSS communication */
     ODSDEMO_DSS2MSS_CONFIGDONE = 0xFEED0100,
@@ -176,6 +188,99 @@ typedef struct OdsDemo_detObjMsg_t
     OdsDemo_msgTlv   tlv[ODSDEMO_OUTPUT_MSG_MAX];
 } OdsDemo_detInfoMsg;
 
+/**
+ * @brief
+ *  Payload of the stats TLV (ODSDEMO_OUTPUT_MSG_STATS)
+ *
+ * @details
+ *  The first fields are the ones of MmwDemo_output_message_stats, in the same
+ *  order, so that parsers of the SDK stats TLV read them unchanged. They are
+ *  followed by the bit growth statistics of the block floating point radar
+ *  cube, which are zero when the radar cube is 16-bit fixed point, and by the
+ *  number of detections dropped by the object list capacities.
+ */
+typedef struct OdsDemo_output_message_stats_t
+{
+    /*! @brief   Interframe processing time in usec */
+    uint32_t     interFrameProcessingTime;
+
+    /*! @brief   Transmission time of output detection information in usec */
+    uint32_t     transmitOutputTime;
+
+    /*! @brief   Interframe processing margin in usec */
+    uint32_t     interFrameProcessingMargin;
+
+    /*! @brief   Interchirp processing margin in usec */
+    uint32_t     interChirpProcessingMargin;
+
+    /*! @brief   CPU Load (%) during active frame duration */
+    uint32_t     activeFrameCPULoad;
+
+    /*! @brief   CPU Load (%) during inter frame duration */
+    uint32_t     interFrameCPULoad;
+
+    /*! @brief   Smallest block exponent of the radar cube */
+    uint8_t      radarCubeExpMin;
+
+    /*! @brief   Largest block exponent of the radar cube */
+    uint8_t      radarCubeExpMax;
+
+    /*! @brief   Number of radar cube blocks (chirp, Rx antenna and, if the radar
+                 cube is packed, range block) with a non zero exponent, saturated
+                 to 0xFFFF */
+    uint16_t     radarCubeNumScaledBlocks;
+
+    /*! @brief   Number of Doppler FFT input samples clipped to the headroom
+                 of the 2D FFT */
+    uint32_t     dopplerInNumClipped;
+
+    /*! @brief   Number of CFAR detections left out of the raw detection list
+                 (the weakest ones) because it was full */
+    uint32_t     numDetObjRawDropped;
+
+    /*! @brief   Number of objects left out of the output list (the weakest
+                 ones) because it was full, plus the objects left out of the
+                 detected points TLV because they did not fit in the HSM buffer */
+    uint32_t     numDetObjDropped;
+} OdsDemo_output_message_stats;
+
+/**
+ * @brief
+ *  Descriptor of the sub-bin detected points TLV
+ *  (ODSDEMO_OUTPUT_MSG_DETECTED_POINTS_SUB_BIN)
+ *
+ * @details
+ *  The TLV follows the detected points TLV when the sub-bin interpolation is
+ *  enabled. The descriptor is followed by one OdsDemo_detectedObjSubBin per
+ *  detected object, in the order of the detected points TLV.
+ */
+typedef struct OdsDemo_output_message_subBinObjDescr_t
+{
+    /*! @brief   Number of detected objects */
+    uint16_t     numDetectedObj;
+
+    /*! @brief   Q format of the fractional range and Doppler indices */
+    uint16_t     binQFormat;
+} OdsDemo_output_message_subBinObjDescr;
+
+/**
+ * @brief
+ *  Fractional range and Doppler indices of a detected object
+ *
+ * @details
+ *  The indices of the detected points TLV refined to a fraction of a bin,
+ *  in Q(binQFormat) of the TLV descriptor. The Doppler index is signed like
+ *  the one of the detected points TLV.
+ */
+typedef struct OdsDemo_detectedObjSubBin_t
+{
+    /*! @brief   Range index */
+    int32_t      rangeIdx;
+
+    /*! @brief   Doppler index */
+    int32_t      dopplerIdx;
+} OdsDemo_detectedObjSubBin;
+
 #define ODSDEMO_MAX_FILE_NAME_SIZE 128
 /**
  * @brief
@@ -194,6 +299,163 @@ typedef struct OdsDemo_dssAssertInfoMsg_t
     uint32_t line;
 } OdsDemo_dssAssertInfoMsg;
 
+/**
+ * @brief
+ *  Static clutter filter configuration
+ *
+ * @details
+ *  The structure configures the cross frame clutter filter. When enabled the
+ *  zero Doppler estimate of every range bin and virtual antenna is tracked across
+ *  frames with a first order IIR filter, otherwise the mean of the current frame
+ *  is removed. The filter is only applied when clutter removal is enabled.
+ */
+typedef struct OdsDemo_StaticClutterCfg_t
+{
+    /*! @brief 1 - track the clutter across frames, 0 - per frame mean removal */
+    uint8_t     enabled;
+
+    /*! @brief Weight of the current frame in the IIR update, in Q15 format
+               (32768 is equivalent to per frame mean removal) */
+    uint16_t    alphaQ15;
+} OdsDemo_StaticClutterCfg;
+
+/**
+ * @brief
+ *  Batched range FFT configuration
+ *
+ * @details
+ *  The structure selects how the range FFT of a chirp is computed. In batched
+ *  mode the samples of all Rx antennas of a chirp are fetched from the ADCBUF with
+ *  a single EDMA transfer and transformed together, otherwise each antenna is
+ *  fetched and transformed on its own with the ping/pong EDMA channels.
+ */
+typedef struct OdsDemo_RangeFftBatchCfg_t
+{
+    /*! @brief 1 - batched range FFT over all Rx antennas, 0 - per antenna */
+    uint8_t     enabled;
+} OdsDemo_RangeFftBatchCfg;
+
+/**
+ * @brief
+ *  Block floating point radar cube configuration
+ *
+ * @details
+ *  In block floating point mode every (chirp, Rx antenna) block of range FFT
+ *  output is stored in the radar cube as 16-bit mantissas with a shared
+ *  exponent, instead of being saturated to 16 bits. The exponents are kept
+ *  next to the radar cube and applied by the Doppler processing when the
+ *  samples are loaded. The mode needs the fused range FFT.
+ */
+typedef struct OdsDemo_RadarCubeBfpCfg_t
+{
+    /*! @brief 1 - block floating point radar cube, 0 - 16-bit fixed point */
+    uint8_t     enabled;
+} OdsDemo_RadarCubeBfpCfg;
+
+/*! @brief Radar cube stored chirp after chirp, in range FFT output order */
+#define ODSDEMO_RADAR_CUBE_LAYOUT_RANGE_MAJOR       0U
+
+/*! @brief Radar cube stored range bin after range bin, in Doppler FFT input order */
+#define ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR     1U
+
+/**
+ * @brief
+ *  Radar cube layout configuration
+ *
+ * @details
+ *  In range-major layout the 1D output EDMA stores every chirp the way the
+ *  range FFT produces it and the Doppler processing gathers each Doppler
+ *  vector with one small transfer per chirp. In Doppler-major layout the 1D
+ *  output EDMA corner-turns every chirp instead, so that the Doppler vector
+ *  of each range bin and virtual antenna is contiguous and the Doppler
+ *  processing fetches it with a single burst.
+ */
+typedef struct OdsDemo_RadarCubeLayoutCfg_t
+{
+    /*! @brief ODSDEMO_RADAR_CUBE_LAYOUT_RANGE_MAJOR or ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR */
+    uint8_t     layout;
+} OdsDemo_RadarCubeLayoutCfg;
+
+/**
+ * @brief
+ *  Object list capacity configuration
+ *
+ * @details
+ *  The structure sets the number of CFAR detections and of output objects
+ *  the data path keeps per frame. When a list is full the weakest entries are
+ *  dropped, and the number of dropped entries is reported in the stats TLV.
+ *  The lists are allocated at sensor start, zero selects the default
+ *  capacity (2048 detections, 100 objects).
+ */
+typedef struct OdsDemo_ObjCapCfg_t
+{
+    /*! @brief Capacity of the list of CFAR detections before peak grouping */
+    uint16_t    maxNumDetObjRaw;
+
+    /*! @brief Capacity of the list of output objects */
+    uint16_t    maxNumDetObj;
+} OdsDemo_ObjCapCfg;
+
+/**
+ * @brief
+ *  Sub-bin interpolation configuration
+ *
+ * @details
+ *  When enabled, the range and Doppler indices of the detected objects are
+ *  refined to a fraction of a bin from the detection matrix, the coordinates
+ *  are computed from the refined range, and the fractional indices are sent
+ *  in the sub-bin detected points TLV.
+ */
+typedef struct OdsDemo_SubBinInterpCfg_t
+{
+    /*! @brief Enabled flag */
+    uint8_t     enabled;
+} OdsDemo_SubBinInterpCfg;
+
+/*! @brief Maximum number of points of a CFAR threshold table */
+#define ODS_CFAR_THR_TABLE_MAX_POINTS   8U
+
+/**
+ * @brief
+ *  Range dependent CFAR threshold table configuration
+ *
+ * @details
+ *  Piecewise linear threshold offset over the range bins, added to the
+ *  thresholdScale of the CFAR along range or along Doppler. The offset is
+ *  interpolated between the points and held before the first and after the
+ *  last one. No points for the same threshold at all range bins.
+ */
+typedef struct OdsDemo_CfarThrTableCfg_t
+{
+    /*! @brief Number of points, up to ODS_CFAR_THR_TABLE_MAX_POINTS */
+    uint8_t     numPoints;
+
+    /*! @brief Range bins of the points, increasing */
+    uint16_t    rangeIdx[ODS_CFAR_THR_TABLE_MAX_POINTS];
+
+    /*! @brief Threshold offsets at the points, in the unit of thresholdScale */
+    int16_t     offset[ODS_CFAR_THR_TABLE_MAX_POINTS];
+} OdsDemo_CfarThrTableCfg;
+
+/**
+ * @brief
+ *  CFAR threshold calibration configuration
+ *
+ * @details
+ *  When numFrames is not 0, the first numFrames frames after sensor start
+ *  are taken as empty-room frames. The noise peak of every range bin above
+ *  the noise average is learned from them, and both threshold tables are
+ *  then set so that the threshold of the range bin is margin above it.
+ */
+typedef struct OdsDemo_CfarThrCalibCfg_t
+{
+    /*! @brief Number of empty-room frames, 0 to disable the calibration */
+    uint16_t    numFrames;
+
+    /*! @brief Margin above the learned noise peak, in the unit of thresholdScale */
+    uint16_t    margin;
+} OdsDemo_CfarThrCalibCfg;
+
 /**
  * @brief
  *  Message body used in Millimeter Wave Demo for passing configuration from MSS
@@ -227,6 +489,30 @@ typedef union OdsDemo_message_body_u
 
     /*! @brief   Clutter removal configuration */
     OdsDemo_ClutterRemovalCfg clutterRemovalCfg;
+
+    /*! @brief   Static clutter filter configuration */
+    OdsDemo_StaticClutterCfg staticClutterCfg;
+
+    /*! @brief   Batched range FFT configuration */
+    OdsDemo_RangeFftBatchCfg rangeFftBatchCfg;
+
+    /*! @brief   Block floating point radar cube configuration */
+    OdsDemo_RadarCubeBfpCfg radarCubeBfpCfg;
+
+    /*! @brief   Radar cube layout configuration */
+    OdsDemo_RadarCubeLayoutCfg radarCubeLayoutCfg;
+
+    /*! @brief   Object list capacity configuration */
+    OdsDemo_ObjCapCfg      objCapCfg;
+
+    /*! @brief   Sub-bin interpolation configuration */
+    OdsDemo_SubBinInterpCfg subBinInterpCfg;
+
+    /*! @brief   CFAR threshold table configuration */
+    OdsDemo_CfarThrTableCfg cfarThrTableCfg;
+
+    /*! @brief   CFAR threshold calibration configuration */
+    OdsDemo_CfarThrCalibCfg cfarThrCalibCfg;
     
     /*! @brief   Detection Information message */
     OdsDemo_detInfoMsg     detObj;
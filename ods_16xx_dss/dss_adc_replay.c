@@ -0,0 +1,450 @@
+/**
+ *   @file  dss_adc_replay.c
+ *
+ *   @brief
+ *      Replays recorded raw ADC frames through the ODS processing chain.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* BIOS/XDC Include Files. */
+#include <xdc/std.h>
+#include <xdc/runtime/System.h>
+
+#ifdef _TMS320C6X
+#include <ti/utils/cycleprofiler/cycle_profiler.h>
+#else
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* ODS Demo Include Files */
+#include "dss_ods.h"
+#include "dss_data_path.h"
+#include "dss_adc_replay.h"
+
+/**************************************************************************
+ ************************** Local Functions *******************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Free running time base of the replay driver. On the DSP this is the
+ *      cycle counter, off-target it is the monotonic clock in micro seconds.
+ *
+ *  @retval
+ *      Current time in ticks, see @ref OdsDemo_adcReplayTicksPerUs
+ */
+static uint32_t OdsDemo_adcReplayGetTicks(void)
+{
+#ifdef _TMS320C6X
+    return Cycleprofiler_getTimeStamp();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U);
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Number of time base ticks per micro second.
+ *
+ *  @retval
+ *      Ticks per micro second
+ */
+static uint32_t OdsDemo_adcReplayTicksPerUs(void)
+{
+#ifdef _TMS320C6X
+    return DSP_CLOCK_MHZ;
+#else
+    return 1U;
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Waits until periodUs micro seconds have elapsed since startTicks.
+ *      The DSP build busy waits on the cycle counter since the BIOS clock
+ *      tick is too coarse for frame pacing; periods must stay below the
+ *      cycle counter wrap (about 7 s at 600 MHz).
+ *
+ *  @param[in]  startTicks  Time base value at frame start
+ *  @param[in]  periodUs    Period to wait out
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_adcReplayWait(uint32_t startTicks, uint32_t periodUs)
+{
+    uint32_t periodTicks = periodUs * OdsDemo_adcReplayTicksPerUs();
+#ifdef _TMS320C6X
+    while ((OdsDemo_adcReplayGetTicks() - startTicks) < periodTicks)
+    {
+    }
+#else
+    uint32_t elapsed = OdsDemo_adcReplayGetTicks() - startTicks;
+    struct timespec ts;
+
+    if (elapsed < periodTicks)
+    {
+        ts.tv_sec  = (periodTicks - elapsed) / 1000000U;
+        ts.tv_nsec = ((periodTicks - elapsed) % 1000000U) * 1000U;
+        nanosleep(&ts, NULL);
+    }
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Validates the identification and the frame layout of a capture header.
+ *
+ *  @param[in]  hdr     Capture header
+ *
+ *  @retval
+ *      0 if the layout is supported, -1 otherwise.
+ */
+static int32_t OdsDemo_adcReplayCheckHeader(const OdsDemo_adcCaptureHeader *hdr)
+{
+    uint64_t expectedFrameSize;
+
+    if ((hdr->magic != ODS_ADC_CAPTURE_MAGIC) || (hdr->version != ODS_ADC_CAPTURE_VERSION) ||
+        (hdr->headerSize < sizeof(OdsDemo_adcCaptureHeader)))
+    {
+        System_printf("Error: not an ADC capture or unsupported version %d\n", hdr->version);
+        return -1;
+    }
+    if ((hdr->adcFmt != 0) || (hdr->numChirpsPerChirpEvent == 0) ||
+        (hdr->numChirpsPerFrame % hdr->numChirpsPerChirpEvent) != 0)
+    {
+        System_printf("Error: ADC capture layout not supported\n");
+        return -1;
+    }
+
+    expectedFrameSize = (uint64_t)hdr->numChirpsPerFrame * hdr->numRxAntennas *
+                        hdr->numAdcSamples * sizeof(cmplx16ReIm_t);
+    if (hdr->frameSize != expectedFrameSize)
+    {
+        System_printf("Error: ADC capture frame size %d, expected %d\n",
+                      hdr->frameSize, (uint32_t)expectedFrameSize);
+        return -1;
+    }
+    return 0;
+}
+
+/**************************************************************************
+ ************************** Exported Functions ****************************
+ **************************************************************************/
+
+int32_t OdsDemo_adcReplayOpen(OdsDemo_adcReplay *replay, const void *base,
+                              uint32_t size, OdsDemo_adcReplayMode mode)
+{
+    const OdsDemo_adcCaptureHeader *hdr = (const OdsDemo_adcCaptureHeader *)base;
+    uint32_t frameNum;
+
+    memset((void *)replay, 0, sizeof(OdsDemo_adcReplay));
+
+    if ((base == NULL) || (size < sizeof(OdsDemo_adcCaptureHeader)))
+    {
+        System_printf("Error: ADC capture too small (%d bytes)\n", size);
+        return -1;
+    }
+    if (OdsDemo_adcReplayCheckHeader(hdr) < 0)
+    {
+        return -1;
+    }
+
+    if (((uint64_t)hdr->frameIndexOffset +
+         (uint64_t)hdr->numFrames * sizeof(OdsDemo_adcCaptureFrameIdx)) > size)
+    {
+        System_printf("Error: ADC capture frame index truncated\n");
+        return -1;
+    }
+
+    replay->base     = (const uint8_t *)base;
+    replay->size     = size;
+    replay->header   = hdr;
+    replay->frameIdx = (const OdsDemo_adcCaptureFrameIdx *)(replay->base + hdr->frameIndexOffset);
+    replay->mode     = mode;
+    replay->stats.minProcTimeUs = 0xFFFFFFFFU;
+
+    for (frameNum = 0; frameNum < hdr->numFrames; frameNum++)
+    {
+        uint32_t offset = replay->frameIdx[frameNum].offset;
+
+        if (((offset % ODS_ADC_CAPTURE_FRAME_ALIGN) != 0) ||
+            (((uint64_t)offset + hdr->frameSize) > size))
+        {
+            System_printf("Error: ADC capture frame %d out of bounds or misaligned\n", frameNum);
+            replay->header = NULL;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int32_t OdsDemo_adcReplayOpenSource(OdsDemo_adcReplay *replay,
+                                    const OdsDemo_adcCaptureHeader *header,
+                                    OdsDemo_adcReplayEventFxn eventFxn, uintptr_t arg,
+                                    OdsDemo_adcReplayMode mode)
+{
+    memset((void *)replay, 0, sizeof(OdsDemo_adcReplay));
+
+    if ((header == NULL) || (eventFxn == NULL) || (OdsDemo_adcReplayCheckHeader(header) < 0))
+    {
+        return -1;
+    }
+
+    replay->sourceHeader = *header;
+    replay->header   = &replay->sourceHeader;
+    replay->eventFxn = eventFxn;
+    replay->eventArg = arg;
+    replay->mode     = mode;
+    replay->stats.minProcTimeUs = 0xFFFFFFFFU;
+
+    return 0;
+}
+
+#ifndef _TMS320C6X
+int32_t OdsDemo_adcReplayMapFile(OdsDemo_adcReplay *replay, const char *path,
+                                 OdsDemo_adcReplayMode mode)
+{
+    struct stat st;
+    void *base;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        System_printf("Error: unable to open ADC capture %s\n", path);
+        return -1;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size <= 0) || ((uint64_t)st.st_size > 0xFFFFFFFFU))
+    {
+        System_printf("Error: ADC capture %s has an unsupported size\n", path);
+        close(fd);
+        return -1;
+    }
+
+    base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        System_printf("Error: unable to map ADC capture %s\n", path);
+        return -1;
+    }
+
+    if (OdsDemo_adcReplayOpen(replay, base, (uint32_t)st.st_size, mode) < 0)
+    {
+        munmap(base, (size_t)st.st_size);
+        return -1;
+    }
+    replay->isFileMapped = 1U;
+
+    return 0;
+}
+#endif
+
+void OdsDemo_adcReplayClose(OdsDemo_adcReplay *replay)
+{
+#ifndef _TMS320C6X
+    if (replay->isFileMapped)
+    {
+        munmap((void *)replay->base, replay->size);
+    }
+#endif
+    memset((void *)replay, 0, sizeof(OdsDemo_adcReplay));
+}
+
+int32_t OdsDemo_adcReplayCheckCfg(const OdsDemo_adcReplay *replay,
+                                  const OdsDemo_DSS_DataPathObj *obj)
+{
+    const OdsDemo_adcCaptureHeader *hdr = replay->header;
+
+    if (hdr == NULL)
+    {
+        return -1;
+    }
+    if ((hdr->numAdcSamples != obj->numAdcSamples) ||
+        (hdr->numRxAntennas != obj->numRxAntennas) ||
+        (hdr->numTxAntennas != obj->numTxAntennas) ||
+        (hdr->numChirpsPerFrame != obj->numChirpsPerFrame) ||
+        (hdr->numChirpsPerChirpEvent != obj->numChirpsPerChirpEvent))
+    {
+        System_printf("Error: ADC capture %d samples %d Rx %d Tx %d chirps/%d per event does not match configuration\n",
+                      hdr->numAdcSamples, hdr->numRxAntennas, hdr->numTxAntennas,
+                      hdr->numChirpsPerFrame, hdr->numChirpsPerChirpEvent);
+        return -1;
+    }
+    return 0;
+}
+
+int32_t OdsDemo_adcReplayFrame(OdsDemo_adcReplay *replay,
+                               OdsDemo_DSS_DataPathObj *obj, uint32_t frameNum)
+{
+    const OdsDemo_adcCaptureHeader *hdr = replay->header;
+    cmplx16ReIm_t *savedADCdataBuf = obj->ADCdataBuf;
+    cmplx16ReIm_t *frame;
+    uint32_t startTicks, procTimeUs, periodUs;
+    uint32_t eventIdx, numEvents, eventSize;
+    uint16_t chirpIndex;
+
+    if ((hdr == NULL) || (frameNum >= hdr->numFrames))
+    {
+        System_printf("Error: ADC capture frame %d not available\n", frameNum);
+        return -1;
+    }
+
+    numEvents = hdr->numChirpsPerFrame / hdr->numChirpsPerChirpEvent;
+    eventSize = (uint32_t)hdr->numRxAntennas * hdr->numChirpsPerChirpEvent * hdr->numAdcSamples;
+
+    startTicks = OdsDemo_adcReplayGetTicks();
+
+    for (eventIdx = 0; eventIdx < numEvents; eventIdx++)
+    {
+        if (replay->eventFxn != NULL)
+        {
+            /* Generated source, the event is produced before it is consumed
+               and its time counts as processing time */
+            obj->ADCdataBuf = (cmplx16ReIm_t *)(uintptr_t)replay->eventFxn(replay->eventArg,
+                                                                            frameNum, eventIdx);
+        }
+        else
+        {
+            /* The processing chain only reads the ADC data (through EDMA), so
+               the frame is consumed in place from the mapping. */
+            frame = (cmplx16ReIm_t *)(uintptr_t)(replay->base + replay->frameIdx[frameNum].offset);
+            obj->ADCdataBuf = &frame[eventIdx * eventSize];
+        }
+        for (chirpIndex = 0; chirpIndex < obj->numChirpsPerChirpEvent; chirpIndex++)
+        {
+            OdsDemo_processChirp(obj, chirpIndex);
+        }
+    }
+    OdsDemo_dssAssert(obj->chirpCount == 0);
+
+    OdsDemo_waitEndOfChirps(obj);
+    OdsDemo_interFrameProcessing(obj);
+
+    obj->ADCdataBuf = savedADCdataBuf;
+
+    procTimeUs = (OdsDemo_adcReplayGetTicks() - startTicks) / OdsDemo_adcReplayTicksPerUs();
+    replay->stats.numFrames++;
+    replay->stats.totalProcTimeUs += procTimeUs;
+    if (procTimeUs > replay->stats.maxProcTimeUs)
+    {
+        replay->stats.maxProcTimeUs = procTimeUs;
+    }
+    if (procTimeUs < replay->stats.minProcTimeUs)
+    {
+        replay->stats.minProcTimeUs = procTimeUs;
+    }
+
+    if (replay->mode == ODS_ADC_REPLAY_PACED)
+    {
+        /* Use the recorded spacing to the next frame when the capture carries
+           time stamps, the nominal frame period otherwise */
+        periodUs = hdr->framePeriodUs;
+        if ((replay->frameIdx != NULL) && ((frameNum + 1U) < hdr->numFrames) &&
+            (replay->frameIdx[frameNum + 1U].timeStampUs > replay->frameIdx[frameNum].timeStampUs))
+        {
+            periodUs = replay->frameIdx[frameNum + 1U].timeStampUs -
+                       replay->frameIdx[frameNum].timeStampUs;
+        }
+
+        if (procTimeUs > periodUs)
+        {
+            replay->stats.numLateFrames++;
+        }
+        else
+        {
+            OdsDemo_adcReplayWait(startTicks, periodUs);
+        }
+    }
+
+    return 0;
+}
+
+int32_t OdsDemo_adcReplayRun(OdsDemo_adcReplay *replay, OdsDemo_DSS_DataPathObj *obj,
+                             uint32_t firstFrame, uint32_t numFrames,
+                             OdsDemo_adcReplayFrameDoneFxn frameDoneFxn, uintptr_t arg)
+{
+    uint32_t frameNum, lastFrame;
+
+    if (OdsDemo_adcReplayCheckCfg(replay, obj) < 0)
+    {
+        return -1;
+    }
+    if (firstFrame >= replay->header->numFrames)
+    {
+        return 0;
+    }
+
+    lastFrame = replay->header->numFrames;
+    if ((numFrames != 0) && ((firstFrame + numFrames) < lastFrame))
+    {
+        lastFrame = firstFrame + numFrames;
+    }
+
+    for (frameNum = firstFrame; frameNum < lastFrame; frameNum++)
+    {
+        if (OdsDemo_adcReplayFrame(replay, obj, frameNum) < 0)
+        {
+            return -1;
+        }
+        if (frameDoneFxn != NULL)
+        {
+            frameDoneFxn(obj, frameNum, arg);
+        }
+    }
+
+    return (int32_t)(lastFrame - firstFrame);
+}
@@ -0,0 +1,372 @@
+/**
+ *   @file  dss_adc_replay.h
+ *
+ *   @brief
+ *      Raw ADC capture format and frame replay driver.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_ADC_REPLAY_H
+#define DSS_ADC_REPLAY_H
+
+#include <stdint.h>
+#include "dss_data_path.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Capture file magic word ("ODSA" read as little endian) */
+#define ODS_ADC_CAPTURE_MAGIC           0x4153444FU
+
+/*! @brief Capture file format version written by this revision */
+#define ODS_ADC_CAPTURE_VERSION         1U
+
+/*! @brief Required alignment in bytes of every frame in the capture */
+#define ODS_ADC_CAPTURE_FRAME_ALIGN     8U
+
+/**
+ * @brief
+ *  Raw ADC capture file header
+ *
+ * @details
+ *  A capture is laid out as this header, a frame index of numFrames
+ *  @ref OdsDemo_adcCaptureFrameIdx entries at frameIndexOffset, and the frame
+ *  data. Each frame holds numChirpsPerFrame/numChirpsPerChirpEvent chirp
+ *  events back to back, and each chirp event is stored exactly as the ADC
+ *  buffer presents it with non-interleaved channels: for every enabled
+ *  receive channel, numChirpsPerChirpEvent chirps of numAdcSamples complex
+ *  16-bit samples. A chirp event can therefore be handed to the processing
+ *  chain in place of the ADC buffer without any reformatting.
+ *  All fields are little endian.
+ */
+typedef struct OdsDemo_adcCaptureHeader_t
+{
+    /*! @brief Must be @ref ODS_ADC_CAPTURE_MAGIC */
+    uint32_t    magic;
+
+    /*! @brief Format version, @ref ODS_ADC_CAPTURE_VERSION */
+    uint16_t    version;
+
+    /*! @brief Size of this header in bytes, allows fields to be appended */
+    uint16_t    headerSize;
+
+    /*! @brief Number of frames in the capture */
+    uint32_t    numFrames;
+
+    /*! @brief Byte offset of the frame index from the start of the capture */
+    uint32_t    frameIndexOffset;
+
+    /*! @brief Bytes of ADC data per frame */
+    uint32_t    frameSize;
+
+    /*! @brief Number of ADC samples per chirp */
+    uint16_t    numAdcSamples;
+
+    /*! @brief Number of enabled receive channels */
+    uint8_t     numRxAntennas;
+
+    /*! @brief Number of transmit antennas (TDM) */
+    uint8_t     numTxAntennas;
+
+    /*! @brief Number of chirps per frame */
+    uint16_t    numChirpsPerFrame;
+
+    /*! @brief Number of chirps per chirp event (ADC buffer chirp threshold) */
+    uint16_t    numChirpsPerChirpEvent;
+
+    /*! @brief Receive channel enable mask used during capture */
+    uint8_t     rxChannelEn;
+
+    /*! @brief Transmit channel enable mask used during capture */
+    uint8_t     txChannelEn;
+
+    /*! @brief ADC output format of adcbufCfg, only 0 (complex) is supported */
+    uint8_t     adcFmt;
+
+    /*! @brief IQ swap selection of adcbufCfg */
+    uint8_t     iqSwapSel;
+
+    /*! @brief Nominal frame periodicity in micro seconds */
+    uint32_t    framePeriodUs;
+
+    /*! @brief Profile start frequency (profileCfg units, informational) */
+    uint32_t    startFreqConst;
+
+    /*! @brief Profile frequency slope (profileCfg units, informational) */
+    int16_t     freqSlopeConst;
+
+    /*! @brief Profile ADC sampling rate in ksps (informational) */
+    uint16_t    digOutSampleRate;
+
+    /*! @brief Profile idle time (profileCfg units, informational) */
+    uint32_t    idleTimeConst;
+
+    /*! @brief Profile ramp end time (profileCfg units, informational) */
+    uint32_t    rampEndTime;
+
+    /*! @brief Reserved, written as 0 */
+    uint32_t    reserved[3];
+} OdsDemo_adcCaptureHeader;
+
+/**
+ * @brief
+ *  Raw ADC capture frame index entry
+ */
+typedef struct OdsDemo_adcCaptureFrameIdx_t
+{
+    /*! @brief Byte offset of the frame from the start of the capture */
+    uint32_t    offset;
+
+    /*! @brief Capture time of the frame start in micro seconds, relative to
+               the first frame. 0 for all frames means unknown, in which case
+               framePeriodUs is used for pacing */
+    uint32_t    timeStampUs;
+} OdsDemo_adcCaptureFrameIdx;
+
+/**
+ * @brief
+ *  Replay pacing
+ */
+typedef enum OdsDemo_adcReplayMode_e
+{
+    /*! @brief Frames are processed back to back as fast as possible */
+    ODS_ADC_REPLAY_FREE_RUNNING = 0,
+
+    /*! @brief Frame starts follow the recorded frame timing */
+    ODS_ADC_REPLAY_PACED
+} OdsDemo_adcReplayMode;
+
+/**
+ * @brief
+ *  Replay throughput statistics
+ *
+ * @details
+ *  Off-target the times are host times and do not represent the device.
+ */
+typedef struct OdsDemo_adcReplayStats_t
+{
+    /*! @brief Number of frames replayed */
+    uint32_t    numFrames;
+
+    /*! @brief Number of paced frames whose processing overran the frame period */
+    uint32_t    numLateFrames;
+
+    /*! @brief Accumulated processing time in micro seconds (excludes pacing) */
+    uint64_t    totalProcTimeUs;
+
+    /*! @brief Longest frame processing time in micro seconds */
+    uint32_t    maxProcTimeUs;
+
+    /*! @brief Shortest frame processing time in micro seconds */
+    uint32_t    minProcTimeUs;
+} OdsDemo_adcReplayStats;
+
+/*! @brief Produces chirp event eventIdx of frame frameNum in the capture
+           layout, for frame sources that generate data on demand. The returned
+           buffer only needs to stay valid until the next call. */
+typedef const cmplx16ReIm_t *(*OdsDemo_adcReplayEventFxn)(uintptr_t arg, uint32_t frameNum,
+                                                          uint32_t eventIdx);
+
+/**
+ * @brief
+ *  Replay driver instance
+ */
+typedef struct OdsDemo_adcReplay_t
+{
+    /*! @brief Start of the mapped capture */
+    const uint8_t                       *base;
+
+    /*! @brief Size of the mapped capture in bytes */
+    uint32_t                            size;
+
+    /*! @brief Capture header (points into the mapping) */
+    const OdsDemo_adcCaptureHeader      *header;
+
+    /*! @brief Capture frame index (points into the mapping), NULL for
+               generated sources */
+    const OdsDemo_adcCaptureFrameIdx    *frameIdx;
+
+    /*! @brief Chirp event source, NULL when replaying a capture */
+    OdsDemo_adcReplayEventFxn           eventFxn;
+
+    /*! @brief Chirp event source argument */
+    uintptr_t                           eventArg;
+
+    /*! @brief Copy of the header describing a generated source */
+    OdsDemo_adcCaptureHeader            sourceHeader;
+
+    /*! @brief Pacing mode */
+    OdsDemo_adcReplayMode               mode;
+
+    /*! @brief Throughput statistics */
+    OdsDemo_adcReplayStats              stats;
+
+#ifndef _TMS320C6X
+    /*! @brief True if the mapping was created by OdsDemo_adcReplayMapFile */
+    uint8_t                             isFileMapped;
+#endif
+} OdsDemo_adcReplay;
+
+/*! @brief Callback invoked after each replayed frame has been processed
+           (e.g. to send the detected objects) */
+typedef void (*OdsDemo_adcReplayFrameDoneFxn)(OdsDemo_DSS_DataPathObj *obj,
+                                              uint32_t frameNum, uintptr_t arg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Attaches the replay driver to a capture already resident in memory
+ *      (e.g. loaded into L3/DDR by the debugger) and validates its header
+ *      and frame index.
+ *
+ *  @param[out] replay  Replay instance
+ *  @param[in]  base    Start of the capture
+ *  @param[in]  size    Size of the capture in bytes
+ *  @param[in]  mode    Pacing mode
+ *
+ *  @retval
+ *      0 on success, -1 if the capture is malformed.
+ */
+int32_t OdsDemo_adcReplayOpen(OdsDemo_adcReplay *replay, const void *base,
+                              uint32_t size, OdsDemo_adcReplayMode mode);
+
+/**
+ *  @b Description
+ *  @n
+ *      Attaches the replay driver to a source that produces chirp events on
+ *      demand (e.g. the scene generator) instead of a capture in memory.
+ *      Frames are paced with framePeriodUs of the header.
+ *
+ *  @param[out] replay   Replay instance
+ *  @param[in]  header   Capture header describing the source; frameIndexOffset
+ *                       is ignored
+ *  @param[in]  eventFxn Chirp event source
+ *  @param[in]  arg      Chirp event source argument
+ *  @param[in]  mode     Pacing mode
+ *
+ *  @retval
+ *      0 on success, -1 if the layout is not supported.
+ */
+int32_t OdsDemo_adcReplayOpenSource(OdsDemo_adcReplay *replay,
+                                    const OdsDemo_adcCaptureHeader *header,
+                                    OdsDemo_adcReplayEventFxn eventFxn, uintptr_t arg,
+                                    OdsDemo_adcReplayMode mode);
+
+#ifndef _TMS320C6X
+/**
+ *  @b Description
+ *  @n
+ *      Maps a capture file read-only and attaches the replay driver to it.
+ *
+ *  @param[out] replay  Replay instance
+ *  @param[in]  path    Capture file
+ *  @param[in]  mode    Pacing mode
+ *
+ *  @retval
+ *      0 on success, -1 on error.
+ */
+int32_t OdsDemo_adcReplayMapFile(OdsDemo_adcReplay *replay, const char *path,
+                                 OdsDemo_adcReplayMode mode);
+#endif
+
+/**
+ *  @b Description
+ *  @n
+ *      Detaches the replay driver, unmapping the file if it was mapped by
+ *      OdsDemo_adcReplayMapFile.
+ *
+ *  @param[in]  replay  Replay instance
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_adcReplayClose(OdsDemo_adcReplay *replay);
+
+/**
+ *  @b Description
+ *  @n
+ *      Checks that the capture layout matches the configured data path
+ *      (samples, antennas, chirps and chirp threshold).
+ *
+ *  @param[in]  replay  Replay instance
+ *  @param[in]  obj     Configured data path object
+ *
+ *  @retval
+ *      0 if the capture can be replayed, -1 otherwise.
+ */
+int32_t OdsDemo_adcReplayCheckCfg(const OdsDemo_adcReplay *replay,
+                                  const OdsDemo_DSS_DataPathObj *obj);
+
+/**
+ *  @b Description
+ *  @n
+ *      Replays one frame: points ADCdataBuf at each chirp event of the frame
+ *      in turn, runs OdsDemo_processChirp for its chirps and then the inter
+ *      frame processing. In paced mode it returns no earlier than the
+ *      recorded start of the next frame.
+ *
+ *  @param[in]  replay   Replay instance
+ *  @param[in]  obj      Configured data path object
+ *  @param[in]  frameNum Frame to replay
+ *
+ *  @retval
+ *      0 on success, -1 if frameNum is out of range.
+ */
+int32_t OdsDemo_adcReplayFrame(OdsDemo_adcReplay *replay,
+                               OdsDemo_DSS_DataPathObj *obj, uint32_t frameNum);
+
+/**
+ *  @b Description
+ *  @n
+ *      Replays a range of frames after checking the configuration.
+ *
+ *  @param[in]  replay      Replay instance
+ *  @param[in]  obj         Configured data path object
+ *  @param[in]  firstFrame  First frame to replay
+ *  @param[in]  numFrames   Number of frames, 0 replays to the end of the capture
+ *  @param[in]  frameDoneFxn Optional per frame callback
+ *  @param[in]  arg         Callback argument
+ *
+ *  @retval
+ *      Number of frames replayed, -1 on error.
+ */
+int32_t OdsDemo_adcReplayRun(OdsDemo_adcReplay *replay, OdsDemo_DSS_DataPathObj *obj,
+                             uint32_t firstFrame, uint32_t numFrames,
+                             OdsDemo_adcReplayFrameDoneFxn frameDoneFxn, uintptr_t arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSS_ADC_REPLAY_H */
@@ -0,0 +1,2574 @@
+/**
+ *   @file  dss_benchmark.c
+ *
+ *   @brief
+ *      Per-stage microbenchmarks of the ODS signal chain.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "dss_benchmark.h"
+
+#ifdef ODS_BENCHMARK
+
+/* BIOS/XDC Include Files. */
+#include <xdc/std.h>
+#include <xdc/runtime/System.h>
+
+#ifdef _TMS320C6X
+#include <ti/utils/cycleprofiler/cycle_profiler.h>
+#include <ti/alg/mmwavelib/mmwavelib.h>
+#include "DSP_fft32x32.h"
+#include "DSP_fft16x16.h"
+#else
+/* Off-target the timings are those of the host and the kernel outputs those
+   of the functional stand-ins of dss_host_kernels.h, neither represents the
+   device. */
+#include <time.h>
+#include "dss_host_intrinsics.h"
+#include "dss_host_kernels.h"
+#endif
+
+/* ODS Demo Include Files */
+#include "dss_ods.h"
+#include "dss_data_path.h"
+#include "dss_range_fft.h"
+#include "dss_cfar.h"
+#include "dss_resources.h"
+
+/**************************************************************************
+ *************************** Local Definitions ****************************
+ **************************************************************************/
+
+/*! @brief Fixture sweeps the number of range bins */
+#define ODS_BENCH_DIM_RANGE     (1U << 0)
+/*! @brief Fixture sweeps the number of Doppler bins */
+#define ODS_BENCH_DIM_DOPPLER   (1U << 1)
+/*! @brief Fixture sweeps the number of receive antennas (one Tx) */
+#define ODS_BENCH_DIM_RX        (1U << 2)
+/*! @brief Fixture sweeps the virtual antenna layout (Rx x Tx) */
+#define ODS_BENCH_DIM_VIRT      (1U << 3)
+/*! @brief Fixture sweeps the number of CFAR detections */
+#define ODS_BENCH_DIM_OBJ       (1U << 4)
+
+/*! @brief Sweep point defaults for dimensions a fixture does not sweep */
+#define ODS_BENCH_DEF_RANGE_BINS    256U
+#define ODS_BENCH_DEF_DOPPLER_BINS  64U
+#define ODS_BENCH_DEF_NUM_OBJ       64U
+
+/*! @brief Number of DC range signature bins, the CLI maximum */
+#define ODS_BENCH_DC_SIG_NEG_BIN    (-(int32_t)DC_RANGE_SIGNATURE_COMP_MAX_BIN_SIZE / 2)
+#define ODS_BENCH_DC_SIG_POS_BIN    ((int32_t)DC_RANGE_SIGNATURE_COMP_MAX_BIN_SIZE / 2 - 1)
+
+/*! @brief CFAR settings of the default ODS profile */
+#define ODS_BENCH_CFAR_THRESHOLD        5120U
+#define ODS_BENCH_CFAR_DOPPLER_WIN      4U
+#define ODS_BENCH_CFAR_DOPPLER_GUARD    2U
+#define ODS_BENCH_CFAR_DOPPLER_SHIFT    3U
+#define ODS_BENCH_CFAR_RANGE_WIN        8U
+#define ODS_BENCH_CFAR_RANGE_GUARD      4U
+#define ODS_BENCH_CFAR_RANGE_SHIFT      4U
+
+/*! @brief Synthetic range lines of the CFAR detection quality comparison:
+           number of lines, targets per line (a group of people a few range
+           bins apart) and their SNR per virtual antenna in dB */
+#define ODS_BENCH_CFAR_QUAL_NUM_LINES   256U
+#define ODS_BENCH_CFAR_QUAL_NUM_TGT     4U
+#define ODS_BENCH_CFAR_QUAL_SNR_MIN_DB  14U
+#define ODS_BENCH_CFAR_QUAL_SNR_MAX_DB  26U
+/*! @brief Every other line has a clutter edge (a wall) after the targets,
+           raising the noise by this many dB */
+#define ODS_BENCH_CFAR_QUAL_EDGE_DB     10U
+/*! @brief log2 of the noise power of the synthetic range lines */
+#define ODS_BENCH_CFAR_QUAL_FLOOR_LOG2  20
+
+/*! @brief Range dependent CFAR thresholds: empty-room frames the tables are
+           calibrated on, frames with targets they are evaluated on, targets
+           per frame and their SNR per virtual antenna in dB, and the
+           calibration margin. Near range clutter has a texture common to the
+           virtual antennas whose log amplitude spreads by up to
+           ODS_BENCH_CFAR_THR_CLUTTER_SIGMA at range bin 0, falling to none at
+           ODS_BENCH_CFAR_THR_NEAR_BINS */
+#define ODS_BENCH_CFAR_THR_CALIB_FRAMES     8U
+#define ODS_BENCH_CFAR_THR_TEST_FRAMES      16U
+#define ODS_BENCH_CFAR_THR_NUM_TGT          16U
+#define ODS_BENCH_CFAR_THR_SNR_MIN_DB       8U
+#define ODS_BENCH_CFAR_THR_SNR_MAX_DB       20U
+#define ODS_BENCH_CFAR_THR_MARGIN           1024U
+#define ODS_BENCH_CFAR_THR_NEAR_BINS        32U
+#define ODS_BENCH_CFAR_THR_CLUTTER_SIGMA    1.0
+
+/*! @brief Random CFAR lists the indexed CFAR qualified and the staged
+           detection matrix peak grouping are checked against the list
+           walking ones on */
+#define ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS   256U
+
+/*! @brief Targets at random fractional range and Doppler bins the sub-bin
+           interpolation error is measured on */
+#define ODS_BENCH_SUB_BIN_NUM_TGT   256U
+
+#define ODS_BENCH_ALIGN(x,a)  (((x)+((a)-1))&~((a)-1))
+
+/* Sweeps, limited to what OdsDemo_parseProfileAndChirpConfig accepts:
+   power of 2 range and Doppler bins (Doppler at least 16), up to 4 Rx and
+   2 Tx antennas. Points that do not fit the data path heaps are skipped. */
+static const uint16_t gOdsBenchRangeSweep[]   = {64, 128, 256, 512, 1024};
+static const uint16_t gOdsBenchDopplerSweep[] = {16, 32, 64, 128, 256};
+static const uint8_t  gOdsBenchRxSweep[]      = {1, 2, 4};
+static const uint8_t  gOdsBenchVirtSweep[][2] = {{1, 1}, {2, 1}, {4, 1}, {4, 2}};
+static const uint16_t gOdsBenchObjSweep[]     = {16, 64, 256, 512, 1024, 2048};
+
+#define ODS_BENCH_NUM_ELEM(x)   (sizeof(x) / sizeof((x)[0]))
+
+/**
+ * @brief
+ *  Bump allocator over one of the data path heaps
+ */
+typedef struct OdsDemo_benchHeap_t
+{
+    /*! @brief Heap start */
+    uint8_t     *base;
+
+    /*! @brief Heap size */
+    uint32_t    size;
+
+    /*! @brief Bytes allocated */
+    uint32_t    used;
+
+    /*! @brief Set when an allocation did not fit */
+    uint32_t    failed;
+} OdsDemo_benchHeap;
+
+/**
+ * @brief
+ *  Time stamp, in ns and (when available) in CPU cycles
+ */
+typedef struct OdsDemo_benchTime_t
+{
+    uint64_t    ns;
+    uint64_t    cycles;
+} OdsDemo_benchTime;
+
+/**
+ * @brief
+ *  Stage fixture
+ */
+typedef struct OdsDemo_benchFixture_t
+{
+    /*! @brief Name */
+    const char  *name;
+
+    /*! @brief Swept dimensions, ODS_BENCH_DIM_xxx */
+    uint32_t    dims;
+
+    /*! @brief Prepares the inputs of the sweep point and returns the bytes
+               touched per op, or 0 if the point is not supported */
+    uint32_t    (*setupFxn)(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj);
+
+    /*! @brief Restores inputs consumed by the op (not timed), may be NULL */
+    void        (*prepareFxn)(OdsDemo_DSS_DataPathObj *obj);
+
+    /*! @brief One op */
+    void        (*opFxn)(OdsDemo_DSS_DataPathObj *obj);
+
+    /*! @brief Measures the accuracy of the op output against a full
+               precision reference in 0.01 dB, may be NULL */
+    int32_t     (*accuracyFxn)(OdsDemo_DSS_DataPathObj *obj);
+} OdsDemo_benchFixture;
+
+/**************************************************************************
+ *************************** Local Variables ******************************
+ **************************************************************************/
+
+static OdsDemo_DSS_DataPathObj  gOdsBenchObj;
+static MmwDemo_CliCfg_t         gOdsBenchCliCfg;
+static MmwDemo_CliCommonCfg_t   gOdsBenchCliCommonCfg;
+static OdsDemo_benchHeap        gOdsBenchL1, gOdsBenchL2, gOdsBenchL3;
+static OdsDemo_benchResult      gOdsBenchResults[ODS_BENCH_MAX_RESULTS];
+static uint32_t                 gOdsBenchNumResults;
+static uint32_t                 gOdsBenchSeed;
+
+/* Fixture state that is not part of the data path object */
+static uint32_t                 gOdsBenchNumObjRaw;
+static OdsDemo_subBinOffs_t    *gOdsBenchSubBin;
+static cmplx32ReIm_t            gOdsBenchVirtAnt[SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS];
+static cmplx16ReIm_t           *gOdsBenchRangeFftBatchIn;
+static cmplx32ReIm_t           *gOdsBenchRangeFftBatchScratch;
+static cmplx16ReIm_t           *gOdsBenchPackRef;
+static cmplx16ReIm_t           *gOdsBenchPackSrc;
+static uint8_t                 *gOdsBenchPackExp;
+static cmplx32ReIm_t           *gOdsBenchPackFftRef;
+static cmplx32ReIm_t           *gOdsBenchBpm;
+static OdsDemo_DSS_dataPathContext_t *gOdsBenchContext;
+
+/**************************************************************************
+ *************************** Helper Functions *****************************
+ **************************************************************************/
+
+static OdsDemo_benchTime OdsDemo_benchNow(void)
+{
+    OdsDemo_benchTime t;
+#ifdef _TMS320C6X
+    /* 32-bit cycle counter, only differences below the wrap are used */
+    t.cycles = Cycleprofiler_getTimeStamp();
+    t.ns     = 0;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    t.ns = (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#if defined(__i386__) || defined(__x86_64__)
+    t.cycles = __builtin_ia32_rdtsc();
+#else
+    t.cycles = 0;
+#endif
+#endif
+    return t;
+}
+
+static void OdsDemo_benchElapsed(OdsDemo_benchTime start, uint64_t *ns, uint64_t *cycles)
+{
+    OdsDemo_benchTime end = OdsDemo_benchNow();
+#ifdef _TMS320C6X
+    uint32_t c = (uint32_t)end.cycles - (uint32_t)start.cycles;
+
+    *cycles += c;
+    *ns     += ((uint64_t)c * 1000U) / DSP_CLOCK_MHZ;
+#else
+    *cycles += end.cycles - start.cycles;
+    *ns     += end.ns - start.ns;
+#endif
+}
+
+static void *OdsDemo_benchAlloc(OdsDemo_benchHeap *heap, uint32_t size)
+{
+    uint32_t offset = ODS_BENCH_ALIGN(heap->used, 8U);
+
+    if ((offset + size) > heap->size)
+    {
+        heap->failed = 1;
+        return NULL;
+    }
+    heap->used = offset + size;
+    return (void *)&heap->base[offset];
+}
+
+static uint32_t OdsDemo_benchRand(void)
+{
+    gOdsBenchSeed = gOdsBenchSeed * 1664525U + 1013904223U;
+    return gOdsBenchSeed >> 8;
+}
+
+/* Signal to error ratio in 0.01 dB, capped at 200 dB for an exact result */
+static int32_t OdsDemo_benchSqnrCdB(double sigPow, double errPow)
+{
+    if (errPow * 1e20 <= sigPow)
+    {
+        return 20000;
+    }
+    return (int32_t) (1000.0 * log10(sigPow / errPow));
+}
+
+/* Fills n complex 16-bit samples with low level noise plus a tone */
+static void OdsDemo_benchFillCmplx16(cmplx16ReIm_t *buf, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        buf[i].real = (int16_t)((OdsDemo_benchRand() & 0x3FFU) - 0x200 + ((i & 8U) ? 0x1000 : -0x1000));
+        buf[i].imag = (int16_t)((OdsDemo_benchRand() & 0x3FFU) - 0x200 + ((i & 4U) ? 0x1000 : -0x1000));
+    }
+}
+
+/* Fills a log2 magnitude line: noise floor around 0x1000 with a few peaks */
+static void OdsDemo_benchFillLog2Abs(uint16_t *buf, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        buf[i] = (uint16_t)(0x1000U + (OdsDemo_benchRand() & 0x1FFU));
+        if ((OdsDemo_benchRand() & 0xFU) == 0)
+        {
+            buf[i] += 0x1800U;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Allocates the buffers and tables shared by all fixtures from the data
+ *      path heaps, in the memory the live chain uses for them, and generates
+ *      windows and twiddles with OdsDemo_dataPathConfigFFTs.
+ *
+ *  @retval
+ *      0 on success, -1 if the sweep point does not fit.
+ */
+static int32_t OdsDemo_benchConfigPoint(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    uint32_t l1Used1D, l1Failed1D, l2Used1D, l2UsedCfar;
+    cmplx32ReIm_t *rangeFftScratch;
+
+    gOdsBenchL1.used   = 0;
+    gOdsBenchL1.failed = 0;
+    gOdsBenchL2.used   = 0;
+    gOdsBenchL2.failed = 0;
+    gOdsBenchL3.used   = 0;
+    gOdsBenchL3.failed = 0;
+    obj->maxNumDetObjRaw = MAX_DET_OBJECTS_RAW;
+    obj->maxNumDetObj    = MMW_MAX_OBJ_OUT;
+
+    /* L1: scratch */
+    obj->adcDataIn      = OdsDemo_benchAlloc(&gOdsBenchL1, 2 * obj->numRangeBins * sizeof(cmplx16ReIm_t));
+    /* rangeFftScratch overlays the 2D scratch like in the chain, and is
+       left out (fused range FFT not measured) if it does not fit */
+    l1Used1D   = gOdsBenchL1.used;
+    l1Failed1D = gOdsBenchL1.failed;
+    rangeFftScratch     = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numRangeBins * sizeof(cmplx32ReIm_t));
+    /* the batched range FFT buffers replace the ping/pong and the scratch */
+    gOdsBenchL1.used   = 0;
+    gOdsBenchRangeFftBatchIn      = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numRxAntennas * obj->numAdcSamples *
+                                                       sizeof(cmplx16ReIm_t));
+    gOdsBenchRangeFftBatchScratch = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numRxAntennas * obj->numRangeBins *
+                                                       sizeof(cmplx32ReIm_t));
+    if (gOdsBenchRangeFftBatchIn == NULL)
+    {
+        gOdsBenchRangeFftBatchScratch = NULL;
+    }
+    gOdsBenchL1.used   = l1Used1D;
+    gOdsBenchL1.failed = l1Failed1D;
+    obj->dstPingPong    = OdsDemo_benchAlloc(&gOdsBenchL1, 2 * obj->numDopplerBins * sizeof(cmplx16ReIm_t));
+    obj->fftOut2D       = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numDopplerBins * sizeof(cmplx32ReIm_t));
+    obj->windowingBuf2D = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numDopplerBins * sizeof(cmplx32ReIm_t));
+    obj->log2Abs        = OdsDemo_benchAlloc(&gOdsBenchL1, obj->numDopplerBins * sizeof(uint16_t));
+    obj->sumAbs         = OdsDemo_benchAlloc(&gOdsBenchL1, 2 * obj->numDopplerBins * sizeof(uint16_t));
+    obj->azimuthIn      = OdsDemo_benchAlloc(&gOdsBenchL1, (obj->numAngleBins + numVirtAnt) * sizeof(cmplx32ReIm_t));
+    obj->azimuthOut     = OdsDemo_benchAlloc(&gOdsBenchL1, 2 * obj->numAngleBins * sizeof(cmplx32ReIm_t));
+    obj->azimElevRowSpec = OdsDemo_benchAlloc(&gOdsBenchL1, 2 * ODS_ANT_GRID_NUM_ROWS * obj->numAngleBins * sizeof(float));
+    gOdsBenchL1.used = 0; /* detObj2DRaw overlays the 1D/2D scratch like in the chain */
+    obj->detObj2DRaw    = OdsDemo_benchAlloc(&gOdsBenchL1, MAX_DET_OBJECTS_RAW * sizeof(OdsDemo_objRaw_t));
+
+    /* L2: 1D output, CFAR buffers and tables */
+    l2Used1D = gOdsBenchL2.used;
+    obj->fftOut1D            = OdsDemo_benchAlloc(&gOdsBenchL2, 2 * obj->numRxAntennas * obj->numRangeBins * sizeof(cmplx16ReIm_t));
+    obj->cfarDetObjIndexBuf  = OdsDemo_benchAlloc(&gOdsBenchL2, MAX(obj->numRangeBins, obj->numDopplerBins) * sizeof(uint16_t));
+    obj->sumAbsRange         = OdsDemo_benchAlloc(&gOdsBenchL2, 2 * obj->numRangeBins * sizeof(uint16_t));
+    obj->detDopplerLines.dopplerLineMaskLen = MAX((obj->numDopplerBins >> 5), 1);
+    obj->detDopplerLines.dopplerLineMask = OdsDemo_benchAlloc(&gOdsBenchL2, obj->detDopplerLines.dopplerLineMaskLen *
+                                                              sizeof(uint32_t));
+    l2UsedCfar = gOdsBenchL2.used;
+    gOdsBenchL2.used = l2Used1D; /* peak grouping buffers overlay the 1D output and the CFAR buffers */
+    obj->peakGroupRows       = OdsDemo_benchAlloc(&gOdsBenchL2, ODS_PEAK_GROUP_NUM_ROW_SLOTS * obj->numDopplerBins *
+                                                  sizeof(uint16_t));
+    obj->peakGroupRangeEnd   = OdsDemo_benchAlloc(&gOdsBenchL2, (obj->numRangeBins + 1) * sizeof(uint16_t));
+    obj->peakGroupOrder      = OdsDemo_benchAlloc(&gOdsBenchL2, MAX_DET_OBJECTS_RAW * sizeof(uint16_t));
+    obj->peakGroupKeep       = OdsDemo_benchAlloc(&gOdsBenchL2, (MAX_DET_OBJECTS_RAW / 32) * sizeof(uint32_t));
+    /* the sub-bin offsets as well, left out of obj so that only the fixtures
+       that interpolate use them */
+    gOdsBenchSubBin          = OdsDemo_benchAlloc(&gOdsBenchL2, MMW_MAX_OBJ_OUT * sizeof(OdsDemo_subBinOffs_t));
+    gOdsBenchL2.used = MAX(gOdsBenchL2.used, l2UsedCfar);
+    obj->twiddle16x16_1D     = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numRangeBins * sizeof(cmplx16ReIm_t));
+    obj->twiddleRangeFft     = OdsDemo_benchAlloc(&gOdsBenchL2, ODS_RANGE_FFT_TWIDDLE_LEN(obj->numRangeBins) *
+                                                  sizeof(cmplx16ReIm_t));
+    obj->window1D            = OdsDemo_benchAlloc(&gOdsBenchL2, (obj->numAdcSamples / 2) * sizeof(int16_t));
+    obj->twiddle32x32_2D     = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numDopplerBins * sizeof(cmplx32ReIm_t));
+    obj->window2D            = OdsDemo_benchAlloc(&gOdsBenchL2, (obj->numDopplerBins / 2) * sizeof(int32_t));
+    obj->detObj2D            = OdsDemo_benchAlloc(&gOdsBenchL2, MMW_MAX_OBJ_OUT * sizeof(MmwDemo_detectedObj));
+    obj->azimuthTwiddle32x32 = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numAngleBins * sizeof(cmplx32ReIm_t));
+    obj->azimuthModCoefs     = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numDopplerBins * sizeof(cmplx16ImRe_t));
+    obj->dcRangeSigMean      = OdsDemo_benchAlloc(&gOdsBenchL2, SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL *
+                                                  DC_RANGE_SIGNATURE_COMP_MAX_BIN_SIZE * sizeof(cmplx32ImRe_t));
+    obj->azimElevDftCoefs    = OdsDemo_benchAlloc(&gOdsBenchL2, 2 * obj->numAngleBins * sizeof(float));
+    obj->azimElevSteerVec    = OdsDemo_benchAlloc(&gOdsBenchL2, 2 * ODS_ANT_GRID_STEER_LEN * obj->numAngleBins * sizeof(float));
+    obj->cfarOsHist          = OdsDemo_benchAlloc(&gOdsBenchL2, ODS_CFAR_OS_HIST_LEN * sizeof(uint16_t));
+
+    /* L3: detection matrix and clutter map */
+    obj->detMatrix           = OdsDemo_benchAlloc(&gOdsBenchL3, obj->numRangeBins * obj->numDopplerBins * sizeof(uint16_t));
+    obj->clutterMap          = OdsDemo_benchAlloc(&gOdsBenchL3, obj->numRangeBins * numVirtAnt * sizeof(cmplx32ReIm_t));
+
+    if (gOdsBenchL1.failed || gOdsBenchL2.failed || gOdsBenchL3.failed)
+    {
+        return -1;
+    }
+    memset((void *)obj->cfarOsHist, 0, ODS_CFAR_OS_HIST_LEN * sizeof(uint16_t));
+
+    /* both range FFT variants are measured, so both twiddle tables are generated */
+    obj->rangeFftScratch = NULL;
+    OdsDemo_dataPathConfigFFTs(obj);
+    obj->rangeFftScratch = rangeFftScratch;
+    if ((obj->rangeFftScratch != NULL) || (gOdsBenchRangeFftBatchScratch != NULL))
+    {
+        OdsDemo_rangeFftGenTwiddle(obj->twiddleRangeFft, obj->numRangeBins);
+    }
+    return 0;
+}
+
+/**************************************************************************
+ *************************** Fixtures *************************************
+ **************************************************************************/
+
+/* Range processing: windowing, zero padding and 16x16 FFT per Rx antenna,
+   as in OdsDemo_interChirpProcessing without the EDMA transfers */
+static uint32_t OdsDemo_benchRangeFftSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    OdsDemo_benchFillCmplx16(obj->adcDataIn, 2 * obj->numRangeBins);
+    return obj->numRxAntennas *
+           (2 * obj->numAdcSamples * sizeof(cmplx16ReIm_t) + (obj->numAdcSamples / 2) * sizeof(int16_t) +
+            (obj->numRangeBins - obj->numAdcSamples) * sizeof(cmplx16ReIm_t) +
+            3 * obj->numRangeBins * sizeof(cmplx16ReIm_t));
+}
+
+static void OdsDemo_benchRangeFftOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIndx;
+
+    for (antIndx = 0; antIndx < obj->numRxAntennas; antIndx++)
+    {
+        cmplx16ReIm_t *adcIn = &obj->adcDataIn[(antIndx & 1U) * obj->numRangeBins];
+
+        mmwavelib_windowing16x16_evenlen((int16_t *) adcIn, (int16_t *) obj->window1D,
+                                         obj->numAdcSamples);
+        memset((void *)&adcIn[obj->numAdcSamples], 0,
+               (obj->numRangeBins - obj->numAdcSamples) * sizeof(cmplx16ReIm_t));
+        DSP_fft16x16((int16_t *) obj->twiddle16x16_1D, obj->numRangeBins, (int16_t *) adcIn,
+                     (int16_t *) &obj->fftOut1D[obj->numRangeBins * antIndx]);
+    }
+}
+
+/* Range processing with the fused range FFT: windowing on load, implicit
+   zero padding and FFT in one call per Rx antenna */
+static uint32_t OdsDemo_benchRangeFftFusedSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    if (obj->rangeFftScratch == NULL)
+    {
+        return 0;
+    }
+    OdsDemo_benchFillCmplx16(obj->adcDataIn, 2 * obj->numRangeBins);
+    return obj->numRxAntennas *
+           (obj->numAdcSamples * sizeof(cmplx16ReIm_t) + (obj->numAdcSamples / 2) * sizeof(int16_t) +
+            2 * obj->numRangeBins * sizeof(cmplx32ReIm_t) + obj->numRangeBins * sizeof(cmplx16ReIm_t));
+}
+
+static void OdsDemo_benchRangeFftFusedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIndx;
+
+    for (antIndx = 0; antIndx < obj->numRxAntennas; antIndx++)
+    {
+        OdsDemo_rangeFftWin16x16(&obj->adcDataIn[(antIndx & 1U) * obj->numRangeBins], obj->window1D,
+                                 obj->numAdcSamples, obj->twiddleRangeFft, obj->rangeFftScratch,
+                                 obj->numRangeBins, &obj->fftOut1D[obj->numRangeBins * antIndx]);
+    }
+}
+
+/* Batched range processing: one fused range FFT call for all Rx antennas
+   of a chirp, as in OdsDemo_interChirpProcessing with rangeFftBatch set */
+static uint32_t OdsDemo_benchRangeFftBatchSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    if (gOdsBenchRangeFftBatchScratch == NULL)
+    {
+        return 0;
+    }
+    OdsDemo_benchFillCmplx16(gOdsBenchRangeFftBatchIn, obj->numRxAntennas * obj->numAdcSamples);
+    return obj->numRxAntennas *
+           (obj->numAdcSamples * sizeof(cmplx16ReIm_t) + 2 * obj->numRangeBins * sizeof(cmplx32ReIm_t) +
+            obj->numRangeBins * sizeof(cmplx16ReIm_t)) +
+           (obj->numAdcSamples / 2) * sizeof(int16_t);
+}
+
+static void OdsDemo_benchRangeFftBatchOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_rangeFftWin16x16Batch(gOdsBenchRangeFftBatchIn, obj->numRxAntennas, obj->window1D,
+                                  obj->numAdcSamples, obj->twiddleRangeFft, gOdsBenchRangeFftBatchScratch,
+                                  obj->numRangeBins, obj->fftOut1D, obj->numRangeBins);
+}
+
+/* DC range signature compensation, steady state (after calibration) */
+static uint32_t OdsDemo_benchDcRangeSigSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    OdsDemo_CalibDcRangeSigCfg *calibDcCfg = &obj->cliCfg->calibDcRangeSigCfg;
+    uint32_t numBins = ODS_BENCH_DC_SIG_POS_BIN - ODS_BENCH_DC_SIG_NEG_BIN + 1;
+
+    (void) numObj;
+    calibDcCfg->enabled        = 1;
+    calibDcCfg->negativeBinIdx = ODS_BENCH_DC_SIG_NEG_BIN;
+    calibDcCfg->positiveBinIdx = ODS_BENCH_DC_SIG_POS_BIN;
+    calibDcCfg->numAvgChirps   = 16;
+    obj->log2NumAvgChirps      = 4;
+    obj->dcRangeSigCalibCntr   = calibDcCfg->numAvgChirps * obj->numTxAntennas;
+    memset((void *)obj->dcRangeSigMean, 0,
+           obj->numTxAntennas * obj->numRxAntennas * numBins * sizeof(cmplx32ImRe_t));
+    OdsDemo_benchFillCmplx16(obj->fftOut1D, 2 * obj->numRxAntennas * obj->numRangeBins);
+
+    return obj->numRxAntennas * numBins * (2 * sizeof(cmplx16ReIm_t) + sizeof(cmplx32ImRe_t));
+}
+
+static void OdsDemo_benchDcRangeSigOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_dcRangeSignatureCompensation(obj, 0);
+}
+
+/* Doppler processing of one range bin: windowing, 32x32 FFT, log2 magnitude
+   and accumulation over the virtual antennas */
+static uint32_t OdsDemo_benchDopplerSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t d = obj->numDopplerBins;
+
+    (void) numObj;
+    OdsDemo_benchFillCmplx16(obj->dstPingPong, 2 * d);
+    return obj->numRxAntennas * obj->numTxAntennas *
+           (d * sizeof(cmplx16ReIm_t) + (d / 2) * sizeof(int32_t) + d * sizeof(cmplx32ReIm_t) +   /* windowing */
+            3 * d * sizeof(cmplx32ReIm_t) +                                                     /* FFT */
+            d * sizeof(cmplx32ReIm_t) + d * sizeof(uint16_t) +                                  /* log2Abs */
+            3 * d * sizeof(uint16_t));                                                          /* accumulate */
+}
+
+static void OdsDemo_benchDopplerOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx, idx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        mmwavelib_windowing16x32((int16_t *) &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins],
+                                 obj->window2D, (int32_t *) obj->windowingBuf2D, obj->numDopplerBins);
+        DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, obj->numDopplerBins,
+                     (int32_t *) obj->windowingBuf2D, (int32_t *) obj->fftOut2D);
+        mmwavelib_log2Abs32((int32_t *) obj->fftOut2D, obj->log2Abs, obj->numDopplerBins);
+        if (antIdx == 0)
+        {
+            for (idx = 0; idx < obj->numDopplerBins; idx++)
+            {
+                obj->sumAbs[idx] = obj->log2Abs[idx];
+            }
+        }
+        else
+        {
+            mmwavelib_accum16(obj->log2Abs, obj->sumAbs, obj->numDopplerBins);
+        }
+    }
+}
+
+/* Doppler processing of one range bin with the fused log2 magnitude and
+   accumulation kernels in place of mmwavelib_log2Abs32 and mmwavelib_accum16 */
+static uint32_t OdsDemo_benchDopplerFusedSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t d = obj->numDopplerBins;
+
+    (void) numObj;
+    OdsDemo_benchFillCmplx16(obj->dstPingPong, 2 * d);
+    return obj->numRxAntennas * obj->numTxAntennas *
+           (d * sizeof(cmplx16ReIm_t) + (d / 2) * sizeof(int32_t) + d * sizeof(cmplx32ReIm_t) +   /* windowing */
+            3 * d * sizeof(cmplx32ReIm_t) +                                                     /* FFT */
+            d * sizeof(cmplx32ReIm_t) + 2 * d * sizeof(uint16_t));                              /* log2Abs + accumulate */
+}
+
+static void OdsDemo_benchDopplerFusedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        mmwavelib_windowing16x32((int16_t *) &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins],
+                                 obj->window2D, (int32_t *) obj->windowingBuf2D, obj->numDopplerBins);
+        DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, obj->numDopplerBins,
+                     (int32_t *) obj->windowingBuf2D, (int32_t *) obj->fftOut2D);
+        if (antIdx == 0)
+        {
+            OdsDemo_log2Abs32Init(obj->fftOut2D, obj->sumAbs, obj->numDopplerBins);
+        }
+        else
+        {
+            OdsDemo_log2Abs32Accum(obj->fftOut2D, obj->sumAbs, obj->numDopplerBins);
+        }
+    }
+}
+
+/* Accumulated log2 magnitude of the fused kernels against the one of
+   mmwavelib_log2Abs32 and mmwavelib_accum16. Only a run on the device
+   compares against the library, the host build has a single precision
+   model of it in its place. */
+static int32_t OdsDemo_benchDopplerFusedAccuracy(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t d = obj->numDopplerBins;
+    double sigPow = 0, errPow = 0, err;
+    uint32_t idx;
+
+    OdsDemo_benchDopplerOp(obj);
+    memcpy(obj->log2Abs, obj->sumAbs, d * sizeof(uint16_t));
+    OdsDemo_benchDopplerFusedOp(obj);
+    for (idx = 0; idx < d; idx++)
+    {
+        err     = (double) obj->sumAbs[idx] - (double) obj->log2Abs[idx];
+        sigPow += (double) obj->log2Abs[idx] * obj->log2Abs[idx];
+        errPow += err * err;
+    }
+    return OdsDemo_benchSqnrCdB(sigPow, errPow);
+}
+
+/* Doppler processing of one range bin from the block floating point radar
+   cube: exponent normalisation and windowing on load, 32x32 FFT, log2
+   magnitude and accumulation over the virtual antennas */
+static uint32_t OdsDemo_benchDopplerBfpSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t d = obj->numDopplerBins;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    uint32_t idx;
+
+    obj->radarCubeExp = OdsDemo_benchAlloc(&gOdsBenchL3, numVirtAnt * d);
+    if (obj->radarCubeExp == NULL)
+    {
+        return 0;
+    }
+    obj->radarCubeExpNumBlocks  = 1;
+    obj->radarCubeExpBlockShift = OdsDemo_floorLog2(obj->numRangeBins);
+    for (idx = 0; idx < numVirtAnt * d; idx++)
+    {
+        obj->radarCubeExp[idx] = (uint8_t) (OdsDemo_benchRand() & 3U);
+    }
+    return OdsDemo_benchDopplerSetup(obj, numObj) + numVirtAnt * d;
+}
+
+static void OdsDemo_benchDopplerBfpOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx, idx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        OdsDemo_radarCubeBfpLoad(obj, &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins],
+                                 0, antIdx, 1, obj->windowingBuf2D);
+        DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, obj->numDopplerBins,
+                     (int32_t *) obj->windowingBuf2D, (int32_t *) obj->fftOut2D);
+        mmwavelib_log2Abs32((int32_t *) obj->fftOut2D, obj->log2Abs, obj->numDopplerBins);
+        if (antIdx == 0)
+        {
+            for (idx = 0; idx < obj->numDopplerBins; idx++)
+            {
+                obj->sumAbs[idx] = obj->log2Abs[idx];
+            }
+        }
+        else
+        {
+            mmwavelib_accum16(obj->log2Abs, obj->sumAbs, obj->numDopplerBins);
+        }
+    }
+}
+
+/* Packing of one chirp of 1D output to the 8-bit radar cube format */
+static uint32_t OdsDemo_benchRadarCubePackSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t n = obj->numRxAntennas * obj->numRangeBins;
+
+    (void) numObj;
+    gOdsBenchPackRef = OdsDemo_benchAlloc(&gOdsBenchL3, n * sizeof(cmplx16ReIm_t));
+    gOdsBenchPackExp = OdsDemo_benchAlloc(&gOdsBenchL3, n >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT);
+    if ((gOdsBenchPackRef == NULL) || (gOdsBenchPackExp == NULL))
+    {
+        return 0;
+    }
+    OdsDemo_benchFillCmplx16(gOdsBenchPackRef, n);
+    return n * (sizeof(cmplx16ReIm_t) + BYTES_PER_SAMP_1D_PACKED) +
+           (n >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT);
+}
+
+static void OdsDemo_benchRadarCubePackPrepare(OdsDemo_DSS_DataPathObj *obj)
+{
+    memcpy((void *)obj->fftOut1D, (void *)gOdsBenchPackRef,
+           obj->numRxAntennas * obj->numRangeBins * sizeof(cmplx16ReIm_t));
+}
+
+static void OdsDemo_benchRadarCubePackOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_radarCubePack(obj->fftOut1D, obj->numRxAntennas * obj->numRangeBins,
+                          ODS_RADAR_CUBE_PACK_BLOCK_SHIFT, gOdsBenchPackExp, 1);
+}
+
+static int32_t OdsDemo_benchRadarCubePackAccuracy(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t n = obj->numRxAntennas * obj->numRangeBins;
+    double sigPow = 0, errPow = 0, errReal, errImag;
+    uint32_t exp, idx;
+
+    OdsDemo_radarCubeUnpack(obj->fftOut1D, n);
+    for (idx = 0; idx < n; idx++)
+    {
+        exp     = gOdsBenchPackExp[idx >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT];
+        errReal = (double) (obj->fftOut1D[idx].real * (1 << exp) - gOdsBenchPackRef[idx].real);
+        errImag = (double) (obj->fftOut1D[idx].imag * (1 << exp) - gOdsBenchPackRef[idx].imag);
+        sigPow += (double) gOdsBenchPackRef[idx].real * gOdsBenchPackRef[idx].real +
+                  (double) gOdsBenchPackRef[idx].imag * gOdsBenchPackRef[idx].imag;
+        errPow += errReal * errReal + errImag * errImag;
+    }
+    return OdsDemo_benchSqnrCdB(sigPow, errPow);
+}
+
+/* Doppler processing of one range bin from the packed radar cube: unpack,
+   exponent normalisation and windowing on load, 32x32 FFT, log2 magnitude
+   and accumulation over the virtual antennas. The Doppler vectors are
+   packed in blocks of 16 chirps, the exponent a chirp gets from its 16
+   range bin block in the chain. */
+static uint32_t OdsDemo_benchDopplerPackedSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t d = obj->numDopplerBins;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    uint32_t bufIdx, antIdx, expIdx, idx;
+
+    obj->radarCubeExp = OdsDemo_benchAlloc(&gOdsBenchL3, numVirtAnt * d);
+    gOdsBenchPackRef  = OdsDemo_benchAlloc(&gOdsBenchL3, 2 * d * sizeof(cmplx16ReIm_t));
+    gOdsBenchPackSrc  = OdsDemo_benchAlloc(&gOdsBenchL3, 2 * d * sizeof(cmplx16ReIm_t));
+    gOdsBenchPackExp  = OdsDemo_benchAlloc(&gOdsBenchL3, 2 * (d >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT));
+    gOdsBenchPackFftRef = OdsDemo_benchAlloc(&gOdsBenchL3, d * sizeof(cmplx32ReIm_t));
+    if ((obj->radarCubeExp == NULL) || (gOdsBenchPackRef == NULL) || (gOdsBenchPackSrc == NULL) ||
+        (gOdsBenchPackExp == NULL) || (gOdsBenchPackFftRef == NULL))
+    {
+        return 0;
+    }
+    obj->radarCubeExpNumBlocks  = 1;
+    obj->radarCubeExpBlockShift = OdsDemo_floorLog2(obj->numRangeBins);
+
+    OdsDemo_benchFillCmplx16(gOdsBenchPackRef, 2 * d);
+    memcpy((void *)gOdsBenchPackSrc, (void *)gOdsBenchPackRef, 2 * d * sizeof(cmplx16ReIm_t));
+    for (bufIdx = 0; bufIdx < 2; bufIdx++)
+    {
+        OdsDemo_radarCubePack(&gOdsBenchPackSrc[bufIdx * d], d, ODS_RADAR_CUBE_PACK_BLOCK_SHIFT,
+                              &gOdsBenchPackExp[bufIdx * (d >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT)], 1);
+    }
+
+    /* exponent rows in the order OdsDemo_radarCubeBfpLoad looks them up */
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        expIdx = (obj->numTxAntennas == 2) ? (antIdx / 2 + (antIdx & 1U) * obj->numRxAntennas) : antIdx;
+        bufIdx = antIdx & 1U;
+        for (idx = 0; idx < d; idx++)
+        {
+            obj->radarCubeExp[expIdx * d + idx] =
+                gOdsBenchPackExp[bufIdx * (d >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT) +
+                                 (idx >> ODS_RADAR_CUBE_PACK_BLOCK_SHIFT)];
+        }
+    }
+    return OdsDemo_benchDopplerSetup(obj, numObj) + numVirtAnt * (d + 2 * d * BYTES_PER_SAMP_1D_PACKED);
+}
+
+static void OdsDemo_benchDopplerPackedPrepare(OdsDemo_DSS_DataPathObj *obj)
+{
+    memcpy((void *)obj->dstPingPong, (void *)gOdsBenchPackSrc,
+           2 * obj->numDopplerBins * BYTES_PER_SAMP_1D_PACKED);
+}
+
+static void OdsDemo_benchDopplerPackedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx, idx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    cmplx16ReIm_t *inpDoppFftBuf;
+
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        /* every antenna brings a freshly transferred packed buffer in the
+           chain, here the ping/pong are packed again after the first pair */
+        inpDoppFftBuf = &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins];
+        if (antIdx >= 2)
+        {
+            memcpy((void *)inpDoppFftBuf, (void *)&gOdsBenchPackSrc[(antIdx & 1U) * obj->numDopplerBins],
+                   obj->numDopplerBins * BYTES_PER_SAMP_1D_PACKED);
+        }
+        OdsDemo_radarCubeUnpack(inpDoppFftBuf, obj->numDopplerBins);
+        OdsDemo_radarCubeBfpLoad(obj, inpDoppFftBuf, 0, antIdx, 1, obj->windowingBuf2D);
+        DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, obj->numDopplerBins,
+                     (int32_t *) obj->windowingBuf2D, (int32_t *) obj->fftOut2D);
+        mmwavelib_log2Abs32((int32_t *) obj->fftOut2D, obj->log2Abs, obj->numDopplerBins);
+        if (antIdx == 0)
+        {
+            for (idx = 0; idx < obj->numDopplerBins; idx++)
+            {
+                obj->sumAbs[idx] = obj->log2Abs[idx];
+            }
+        }
+        else
+        {
+            mmwavelib_accum16(obj->log2Abs, obj->sumAbs, obj->numDopplerBins);
+        }
+    }
+}
+
+/* Doppler spectrum of the first virtual antenna against the one of the
+   16-bit radar cube */
+static int32_t OdsDemo_benchDopplerPackedAccuracy(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t d = obj->numDopplerBins;
+    cmplx32ReIm_t *ref = gOdsBenchPackFftRef;
+    double sigPow = 0, errPow = 0, errReal, errImag;
+    uint32_t idx;
+
+    OdsDemo_benchDopplerPackedPrepare(obj);
+    OdsDemo_radarCubeUnpack(obj->dstPingPong, d);
+    OdsDemo_radarCubeBfpLoad(obj, obj->dstPingPong, 0, 0, 0, obj->windowingBuf2D);
+    DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, d,
+                 (int32_t *) obj->windowingBuf2D, (int32_t *) obj->fftOut2D);
+
+    mmwavelib_windowing16x32((int16_t *) gOdsBenchPackRef, obj->window2D,
+                             (int32_t *) obj->windowingBuf2D, d);
+    DSP_fft32x32((int32_t *) obj->twiddle32x32_2D, d,
+                 (int32_t *) obj->windowingBuf2D, (int32_t *) ref);
+
+    for (idx = 0; idx < d; idx++)
+    {
+        errReal = (double) obj->fftOut2D[idx].real - (double) ref[idx].real;
+        errImag = (double) obj->fftOut2D[idx].imag - (double) ref[idx].imag;
+        sigPow += (double) ref[idx].real * ref[idx].real + (double) ref[idx].imag * ref[idx].imag;
+        errPow += errReal * errReal + errImag * errImag;
+    }
+    return OdsDemo_benchSqnrCdB(sigPow, errPow);
+}
+
+/* 2D input EDMA of one range bin: the Doppler vectors of all virtual antennas
+   fetched from the radar cube in L3 into the ping/pong buffers, as in
+   OdsDemo_interFrameProcessing but with nothing to overlap the transfers with,
+   so the op time is the EDMA wait time of the 2D stage for one range bin */
+static uint32_t OdsDemo_benchEdma2DFetchSetup(OdsDemo_DSS_DataPathObj *obj, uint8_t layout)
+{
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    if (gOdsBenchContext == NULL)
+    {
+        return 0;
+    }
+    obj->radarCube = OdsDemo_benchAlloc(&gOdsBenchL3, obj->numRangeBins * obj->numDopplerBins * numVirtAnt *
+                                        sizeof(cmplx16ReIm_t));
+    if (obj->radarCube == NULL)
+    {
+        return 0;
+    }
+    OdsDemo_benchFillCmplx16(obj->radarCube, obj->numRangeBins * obj->numDopplerBins * numVirtAnt);
+    obj->context                   = gOdsBenchContext;
+    obj->radarCubeSampleBytes      = sizeof(cmplx16ReIm_t);
+    obj->radarCubeLayoutCfg.layout = layout;
+    obj->numChirpsPerFrame         = obj->numDopplerBins * obj->numTxAntennas;
+    obj->numChirpsPerChirpEvent    = 1;
+    if (OdsDemo_dataPathConfigEdma(obj) < 0)
+    {
+        return 0;
+    }
+    return numVirtAnt * 2 * obj->numDopplerBins * sizeof(cmplx16ReIm_t);
+}
+
+static uint32_t OdsDemo_benchEdma2DFetchRangeMajorSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    return OdsDemo_benchEdma2DFetchSetup(obj, ODSDEMO_RADAR_CUBE_LAYOUT_RANGE_MAJOR);
+}
+
+static uint32_t OdsDemo_benchEdma2DFetchDopplerMajorSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    return OdsDemo_benchEdma2DFetchSetup(obj, ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR);
+}
+
+static void OdsDemo_benchEdma2DFetchOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    EDMA_Handle handle = obj->context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE];
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    uint32_t rangeIdx = obj->numRangeBins / 2;
+    uint32_t antIdx;
+
+    EDMA_setSourceAddress(handle, ODS_EDMA_CH_2D_IN_PING, (uint32_t) obj->radarCube +
+                          OdsDemo_radarCubeDopplerVecIdx(obj, rangeIdx, 0) * obj->radarCubeSampleBytes);
+    EDMA_setSourceAddress(handle, ODS_EDMA_CH_2D_IN_PONG, (uint32_t) obj->radarCube +
+                          OdsDemo_radarCubeDopplerVecIdx(obj, rangeIdx, 1) * obj->radarCubeSampleBytes);
+    EDMA_startDmaTransfer(handle, ODS_EDMA_CH_2D_IN_PING);
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        OdsDemo_dataPathWait2DInputData(obj, antIdx & 1U);
+        if (antIdx < (numVirtAnt - 1))
+        {
+            EDMA_startDmaTransfer(handle, (antIdx & 1U) ? ODS_EDMA_CH_2D_IN_PING : ODS_EDMA_CH_2D_IN_PONG);
+        }
+    }
+}
+
+/* Doppler compensation of the Pong spectrum and BPM decoding of one Ping/Pong
+   pair of Doppler spectra, bin after bin with OdsDemo_addDopplerCompensation
+   or in one pass over the bpmDopplerCompCoefs table */
+static uint32_t OdsDemo_benchBpmSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    gOdsBenchBpm = OdsDemo_benchAlloc(&gOdsBenchL2, 2 * obj->numDopplerBins * sizeof(cmplx32ReIm_t));
+    obj->bpmDopplerCompCoefs = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numDopplerBins * sizeof(cmplx16ImRe_t));
+    if (gOdsBenchL2.failed)
+    {
+        return 0;
+    }
+    obj->cliCfg->bpmCfg.isEnabled = 1;
+    OdsDemo_dataPathConfigFFTs(obj);
+    return obj->numDopplerBins * (4 * sizeof(cmplx32ReIm_t) + sizeof(cmplx16ImRe_t));
+}
+
+static void OdsDemo_benchBpmPrepare(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t i;
+
+    for (i = 0; i < 2 * obj->numDopplerBins; i++)
+    {
+        gOdsBenchBpm[i].real = (int32_t)(OdsDemo_benchRand() << 8) >> 8;
+        gOdsBenchBpm[i].imag = (int32_t)(OdsDemo_benchRand() << 8) >> 8;
+    }
+}
+
+static void OdsDemo_benchBpmScalarOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    cmplx32ReIm_t *bpmAPtr = &gOdsBenchBpm[0];
+    cmplx32ReIm_t *bpmBPtr = &gOdsBenchBpm[obj->numDopplerBins];
+    int32_t real, imag;
+    uint32_t idx;
+
+    for (idx = 0; idx < obj->numDopplerBins; idx++)
+    {
+        OdsDemo_addDopplerCompensation(idx,
+                                       (int32_t) obj->numDopplerBins,
+                                       (uint32_t *) obj->azimuthModCoefs,
+                                       (uint32_t *) &obj->azimuthModCoefsHalfBin,
+                                       (int64_t *) &bpmBPtr[idx],
+                                       1);
+        real = bpmAPtr[idx].real;
+        imag = bpmAPtr[idx].imag;
+        bpmAPtr[idx].real = (bpmAPtr[idx].real + bpmBPtr[idx].real)/2;
+        bpmAPtr[idx].imag = (bpmAPtr[idx].imag + bpmBPtr[idx].imag)/2;
+        bpmBPtr[idx].real = (real - bpmBPtr[idx].real)/2;
+        bpmBPtr[idx].imag = (imag - bpmBPtr[idx].imag)/2;
+    }
+}
+
+static void OdsDemo_benchBpmVectorOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_bpmDecodeDopplerComp(&gOdsBenchBpm[0], &gOdsBenchBpm[obj->numDopplerBins],
+                                 (uint32_t *) obj->bpmDopplerCompCoefs, obj->numDopplerBins);
+}
+
+/* Static clutter removal of one range bin over the virtual antennas, with the
+   clutter map update of the Doppler processing or reusing the map estimate as
+   the azimuth processing does */
+static uint32_t OdsDemo_benchClutterSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    (void) numObj;
+    obj->cliCfg->clutterRemovalCfg.enabled = 1;
+    obj->staticClutterCfg.enabled  = 1;
+    obj->staticClutterCfg.alphaQ15 = ONE_Q15 / 16;
+    obj->clutterMapValid = 1;
+    memset((void *)obj->clutterMap, 0, numVirtAnt * sizeof(cmplx32ReIm_t));
+    OdsDemo_benchFillCmplx16(obj->dstPingPong, 2 * obj->numDopplerBins);
+
+    return numVirtAnt * (2 * obj->numDopplerBins * sizeof(cmplx16ReIm_t) + sizeof(cmplx32ReIm_t));
+}
+
+static uint32_t OdsDemo_benchClutterUpdateSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    return OdsDemo_benchClutterSetup(obj, numObj) +
+           obj->numRxAntennas * obj->numTxAntennas * (obj->numDopplerBins * sizeof(cmplx16ReIm_t) + sizeof(cmplx32ReIm_t));
+}
+
+static void OdsDemo_benchClutterUpdateOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx;
+
+    for (antIdx = 0; antIdx < obj->numRxAntennas * obj->numTxAntennas; antIdx++)
+    {
+        OdsDemo_staticClutterRemoval(obj, &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins],
+                                     0, antIdx, 1);
+    }
+}
+
+static void OdsDemo_benchClutterReuseOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx;
+
+    for (antIdx = 0; antIdx < obj->numRxAntennas * obj->numTxAntennas; antIdx++)
+    {
+        OdsDemo_staticClutterRemoval(obj, &obj->dstPingPong[(antIdx & 1U) * obj->numDopplerBins],
+                                     0, antIdx, 0);
+    }
+}
+
+/* CFAR along Doppler (cyclic CA) on one range line */
+static uint32_t OdsDemo_benchCfarDopplerSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    OdsDemo_benchFillLog2Abs(obj->sumAbs, obj->numDopplerBins);
+    return obj->numDopplerBins * sizeof(uint16_t);
+}
+
+static void OdsDemo_benchCfarDopplerOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    mmwavelib_cfarCadBwrap(obj->sumAbs, obj->cfarDetObjIndexBuf, obj->numDopplerBins,
+                           ODS_BENCH_CFAR_THRESHOLD, ODS_BENCH_CFAR_DOPPLER_SHIFT,
+                           ODS_BENCH_CFAR_DOPPLER_GUARD, ODS_BENCH_CFAR_DOPPLER_WIN);
+}
+
+/* CFAR along range (SO/GO CA) on one Doppler line */
+static uint32_t OdsDemo_benchCfarRangeSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    (void) numObj;
+    OdsDemo_benchFillLog2Abs(obj->sumAbsRange, obj->numRangeBins);
+    return obj->numRangeBins * sizeof(uint16_t);
+}
+
+static void OdsDemo_benchCfarRangeOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    mmwavelib_cfarCadB_SOGO(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                            MMW_NOISE_AVG_MODE_CFAR_CASO, ODS_BENCH_CFAR_THRESHOLD,
+                            ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                            ODS_BENCH_CFAR_RANGE_WIN);
+}
+
+/* Ordered statistic CFAR on the same lines */
+static void OdsDemo_benchCfarOsDopplerOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarOsWrap(obj->sumAbs, obj->cfarDetObjIndexBuf, obj->numDopplerBins,
+                       ODS_BENCH_CFAR_THRESHOLD, ODS_BENCH_CFAR_DOPPLER_GUARD,
+                       ODS_BENCH_CFAR_DOPPLER_WIN, obj->cfarOsHist);
+}
+
+static void OdsDemo_benchCfarOsRangeOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarOs(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                   ODS_BENCH_CFAR_THRESHOLD, NULL, ODS_BENCH_CFAR_RANGE_GUARD,
+                   ODS_BENCH_CFAR_RANGE_WIN, obj->cfarOsHist);
+}
+
+/* CFAR along range (SO/GO CA) with a threshold offset per range bin */
+static uint32_t OdsDemo_benchCfarRangeThrSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t rangeIdx;
+
+    obj->cfarThrOffsRange = OdsDemo_benchAlloc(&gOdsBenchL2, obj->numRangeBins * sizeof(int16_t));
+    if (gOdsBenchL2.failed)
+    {
+        return 0;
+    }
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        obj->cfarThrOffsRange[rangeIdx] = (int16_t)((OdsDemo_benchRand() & 0x3FFU) - 0x200);
+    }
+    return OdsDemo_benchCfarRangeSetup(obj, numObj) + obj->numRangeBins * sizeof(int16_t);
+}
+
+static void OdsDemo_benchCfarRangeThrOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarCaSogo(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                       MMW_NOISE_AVG_MODE_CFAR_CASO, ODS_BENCH_CFAR_THRESHOLD, obj->cfarThrOffsRange,
+                       ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                       ODS_BENCH_CFAR_RANGE_WIN);
+}
+
+/* Detection over the whole detection matrix: CFAR along Doppler on every
+   range bin and along range on the flagged Doppler lines (gathered by the
+   CPU instead of the EDMA), or the two dimensional CFAR with its summed
+   area table */
+static uint32_t OdsDemo_benchCfarFrameSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t rangeIdx;
+
+    (void) numObj;
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        OdsDemo_benchFillLog2Abs(&obj->detMatrix[rangeIdx * obj->numDopplerBins], obj->numDopplerBins);
+    }
+    return 2 * obj->numRangeBins * obj->numDopplerBins * sizeof(uint16_t);
+}
+
+static void OdsDemo_benchCfar1DFrameOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t rangeIdx, dopplerLine, numDet, numLines = 0;
+
+    OdsDemo_resetDopplerLines(&obj->detDopplerLines);
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        numDet = mmwavelib_cfarCadBwrap(&obj->detMatrix[rangeIdx * obj->numDopplerBins],
+                                        obj->cfarDetObjIndexBuf, obj->numDopplerBins,
+                                        ODS_BENCH_CFAR_THRESHOLD, ODS_BENCH_CFAR_DOPPLER_SHIFT,
+                                        ODS_BENCH_CFAR_DOPPLER_GUARD, ODS_BENCH_CFAR_DOPPLER_WIN);
+        numLines += OdsDemo_setDopplerLines(&obj->detDopplerLines, obj->cfarDetObjIndexBuf, numDet);
+    }
+    while (numLines-- > 0)
+    {
+        dopplerLine = OdsDemo_getDopplerLine(&obj->detDopplerLines);
+        for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+        {
+            obj->sumAbsRange[rangeIdx] = obj->detMatrix[rangeIdx * obj->numDopplerBins + dopplerLine];
+        }
+        mmwavelib_cfarCadB_SOGO(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                MMW_NOISE_AVG_MODE_CFAR_CA, ODS_BENCH_CFAR_THRESHOLD,
+                                ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                                ODS_BENCH_CFAR_RANGE_WIN);
+    }
+}
+
+static uint32_t OdsDemo_benchCfarCa2DSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t satLen;
+
+    obj->cfar2DSatDopplerPad = ODS_BENCH_CFAR_DOPPLER_GUARD + ODS_BENCH_CFAR_DOPPLER_WIN;
+    satLen = ODS_CFAR_2D_SAT_LEN(obj->numRangeBins, obj->numDopplerBins, obj->cfar2DSatDopplerPad);
+    obj->cfar2DSat = OdsDemo_benchAlloc(&gOdsBenchL3, satLen * sizeof(uint32_t));
+    if (gOdsBenchL3.failed)
+    {
+        return 0;
+    }
+    /* plus the table written once and read four times per window */
+    return OdsDemo_benchCfarFrameSetup(obj, numObj) + 9 * satLen * sizeof(uint32_t);
+}
+
+static void OdsDemo_benchCfarCa2DOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarCa2DCfg cfg;
+    uint32_t dopplerIdx;
+
+    cfg.guardLenRange   = ODS_BENCH_CFAR_RANGE_GUARD;
+    cfg.noiseLenRange   = ODS_BENCH_CFAR_RANGE_WIN;
+    cfg.guardLenDoppler = ODS_BENCH_CFAR_DOPPLER_GUARD;
+    cfg.noiseLenDoppler = ODS_BENCH_CFAR_DOPPLER_WIN;
+    cfg.threshold       = ODS_BENCH_CFAR_THRESHOLD;
+    cfg.rangeThrOffs    = NULL;
+    OdsDemo_cfarCa2DBuildSat(obj->detMatrix, obj->numRangeBins, obj->numDopplerBins,
+                             obj->cfar2DSatDopplerPad, obj->cfar2DSat);
+    for (dopplerIdx = 0; dopplerIdx < obj->numDopplerBins; dopplerIdx++)
+    {
+        OdsDemo_cfarCa2DLine(obj->detMatrix, obj->cfar2DSat, obj->numRangeBins, obj->numDopplerBins,
+                             obj->cfar2DSatDopplerPad, dopplerIdx, &cfg, obj->cfarDetObjIndexBuf);
+    }
+}
+
+/* Active Doppler lines: numObj of the Doppler bins flagged by the CFAR in
+   Doppler direction, marked and iterated once. The reference walks the mask
+   bit by bit and tests and sets every index, as the data path did before
+   the bit scan. */
+static uint32_t gOdsBenchNumDopplerLines;
+
+static uint32_t OdsDemo_benchDopplerLinesSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t dopplerIdx, numLeft = numObj;
+
+    if (numObj > obj->numDopplerBins)
+    {
+        return 0;
+    }
+
+    /* numObj distinct lines drawn uniformly, in increasing order like the
+       CFAR output */
+    gOdsBenchNumDopplerLines = numObj;
+    for (dopplerIdx = 0; (dopplerIdx < obj->numDopplerBins) && (numLeft > 0); dopplerIdx++)
+    {
+        if ((OdsDemo_benchRand() % (obj->numDopplerBins - dopplerIdx)) < numLeft)
+        {
+            obj->cfarDetObjIndexBuf[numObj - numLeft] = (uint16_t) dopplerIdx;
+            numLeft--;
+        }
+    }
+    return numObj * sizeof(uint16_t) + 2 * obj->detDopplerLines.dopplerLineMaskLen * sizeof(uint32_t);
+}
+
+static void OdsDemo_benchDopplerLinesWalkOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_1D_DopplerLines_t *lines = &obj->detDopplerLines;
+    uint32_t detIdx, index = 0, numLines = 0;
+
+    OdsDemo_resetDopplerLines(lines);
+    for (detIdx = 0; detIdx < gOdsBenchNumDopplerLines; detIdx++)
+    {
+        if (!OdsDemo_isSetDopplerLine(lines, obj->cfarDetObjIndexBuf[detIdx]))
+        {
+            OdsDemo_setDopplerLine(lines, obj->cfarDetObjIndexBuf[detIdx]);
+            numLines++;
+        }
+    }
+    while (numLines-- > 0)
+    {
+        while (((lines->dopplerLineMask[index >> 5] >> (index & 31)) & 0x1) == 0)
+        {
+            index++;
+        }
+        obj->sumAbsRange[numLines] = (uint16_t) index++;
+    }
+}
+
+static void OdsDemo_benchDopplerLinesScanOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t numLines;
+
+    OdsDemo_resetDopplerLines(&obj->detDopplerLines);
+    numLines = OdsDemo_setDopplerLines(&obj->detDopplerLines, obj->cfarDetObjIndexBuf,
+                                       gOdsBenchNumDopplerLines);
+    while (numLines-- > 0)
+    {
+        obj->sumAbsRange[numLines] = (uint16_t) OdsDemo_getDopplerLine(&obj->detDopplerLines);
+    }
+}
+
+/* Peak grouping: detection matrix with noise and clusters of peaks, CFAR
+   list ordered like the chain produces it (Doppler line, then range) */
+static uint32_t OdsDemo_benchPeakGroupingSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t i, r, d, n;
+    uint16_t *cell;
+
+    if (numObj > MAX_DET_OBJECTS_RAW)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < obj->numRangeBins * obj->numDopplerBins; i++)
+    {
+        obj->detMatrix[i] = (uint16_t)(0x1000U + (OdsDemo_benchRand() & 0x1FFU));
+    }
+
+    /* clusters of 2x2 cells with the peak at the lower corner */
+    for (i = 0; i < numObj / 4; i++)
+    {
+        r = 1 + OdsDemo_benchRand() % (obj->numRangeBins - 2);
+        d = OdsDemo_benchRand() % (obj->numDopplerBins - 1);
+        cell = &obj->detMatrix[r * obj->numDopplerBins + d];
+        cell[0]                       = 0x3000;
+        cell[1]                       = 0x2C00;
+        cell[obj->numDopplerBins]     = 0x2E00;
+        cell[obj->numDopplerBins + 1] = 0x2A00;
+    }
+
+    /* CFAR list: every cell above the noise, Doppler-major */
+    n = 0;
+    for (d = 0; d < obj->numDopplerBins; d++)
+    {
+        for (r = 0; r < obj->numRangeBins; r++)
+        {
+            if ((obj->detMatrix[r * obj->numDopplerBins + d] > 0x2000U) && (n < MAX_DET_OBJECTS_RAW))
+            {
+                obj->detObj2DRaw[n].rangeIdx   = r;
+                obj->detObj2DRaw[n].dopplerIdx = d;
+                obj->detObj2DRaw[n].peakVal    = obj->detMatrix[r * obj->numDopplerBins + d];
+                n++;
+            }
+        }
+    }
+    gOdsBenchNumObjRaw = n;
+
+    return n * sizeof(OdsDemo_objRaw_t) + MIN(n, MMW_MAX_OBJ_OUT) * sizeof(MmwDemo_detectedObj);
+}
+
+static uint32_t OdsDemo_benchPeakGroupingDetMatrixSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t bytes = OdsDemo_benchPeakGroupingSetup(obj, numObj);
+
+    /* plus the 3x3 neighbourhood read from the detection matrix */
+    return bytes + gOdsBenchNumObjRaw * 9 * sizeof(uint16_t);
+}
+
+static void OdsDemo_benchPeakGroupingDetMatrixOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarPeakGrouping(obj->detObj2D, obj->detObj2DRaw, gOdsBenchNumObjRaw,
+                             obj->detMatrix, obj->numDopplerBins,
+                             obj->numRangeBins - 1, 0, 1, 1,
+                             obj->maxNumDetObj, &obj->numDetObjDropped);
+}
+
+#ifdef ODS_PEAK_GROUPING_STAGED
+/* Detection matrix based peak grouping with the detection matrix rows
+   staged in L2 by EDMA, on the same detections */
+static uint32_t OdsDemo_benchPeakGroupingStagedSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t bytes;
+
+    if (gOdsBenchContext == NULL)
+    {
+        return 0;
+    }
+    bytes = OdsDemo_benchPeakGroupingDetMatrixSetup(obj, numObj);
+    obj->context                   = gOdsBenchContext;
+    obj->numChirpsPerFrame         = obj->numDopplerBins * obj->numTxAntennas;
+    obj->numChirpsPerChirpEvent    = 1;
+    obj->cliCfg->peakGroupingCfg.minRangeIndex        = 0;
+    obj->cliCfg->peakGroupingCfg.maxRangeIndex        = obj->numRangeBins - 1;
+    obj->cliCfg->peakGroupingCfg.inDopplerDirectionEn = 1;
+    obj->cliCfg->peakGroupingCfg.inRangeDirectionEn   = 1;
+    if ((bytes == 0) || (OdsDemo_dataPathConfigEdma(obj) < 0))
+    {
+        return 0;
+    }
+    return bytes;
+}
+
+static void OdsDemo_benchPeakGroupingStagedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarPeakGroupingStaged(obj, gOdsBenchNumObjRaw);
+}
+#endif
+
+static void OdsDemo_benchPeakGroupingCfarQualifiedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarPeakGroupingCfarQualified(obj->detObj2D, obj->detObj2DRaw, gOdsBenchNumObjRaw,
+                                          obj->numDopplerBins,
+                                          obj->numRangeBins - 1, 0, 1, 1,
+                                          obj->maxNumDetObj, &obj->numDetObjDropped);
+}
+
+static void OdsDemo_benchPeakGroupingCfarQualifiedIdxOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarPeakGroupingCfarQualifiedIndexed(obj->detObj2D, obj->detObj2DRaw, gOdsBenchNumObjRaw,
+                                                 obj->numDopplerBins,
+                                                 obj->numRangeBins - 1, 0, 1, 1,
+                                                 obj->maxNumDetObj, &obj->numDetObjDropped);
+}
+
+/* Sub-bin interpolation of the first CFAR detections of the peak grouping
+   fixture, up to the output list capacity */
+static uint32_t OdsDemo_benchSubBinInterpSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t i;
+
+    if ((numObj > MMW_MAX_OBJ_OUT) || (OdsDemo_benchPeakGroupingSetup(obj, numObj) == 0))
+    {
+        return 0;
+    }
+    obj->numDetObj = MIN(gOdsBenchNumObjRaw, numObj);
+    for (i = 0; i < obj->numDetObj; i++)
+    {
+        obj->detObj2D[i].rangeIdx   = obj->detObj2DRaw[i].rangeIdx;
+        obj->detObj2D[i].dopplerIdx = DOPPLER_IDX_TO_SIGNED(obj->detObj2DRaw[i].dopplerIdx, obj->numDopplerBins);
+    }
+    obj->detObjSubBin = gOdsBenchSubBin;
+
+    /* the object, 5 detection matrix cells and the offsets */
+    return obj->numDetObj * (sizeof(MmwDemo_detectedObj) + 5 * sizeof(uint16_t) + sizeof(OdsDemo_subBinOffs_t));
+}
+
+static void OdsDemo_benchSubBinInterpOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_detObjSubBinInterp(obj);
+}
+
+/* 2D (azimuth/elevation) angle estimation of one object on the 64x64 grid:
+   peak search with the full FFT, the pruned DFT and the steering vector
+   search, and the complete estimation (peak + coordinates) with the integer
+   bin peak, the steering vector search and the variant the chain is built with */
+static uint32_t OdsDemo_benchAngleFill(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t antIdx, numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    if (numVirtAnt != 8)
+    {
+        return 0;
+    }
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        gOdsBenchVirtAnt[antIdx].real = (int32_t)(OdsDemo_benchRand() & 0xFFFFFU) - 0x80000;
+        gOdsBenchVirtAnt[antIdx].imag = (int32_t)(OdsDemo_benchRand() & 0xFFFFFU) - 0x80000;
+    }
+    obj->detObj2D[0].rangeIdx = obj->numRangeBins / 4;
+    obj->rangeResolution      = 0.044f;
+    obj->xyzOutputQFormat     = 9;
+    return 1;
+}
+
+static uint32_t OdsDemo_benchAngleFullFftSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t gridBytes = obj->numAngleBins * obj->numAngleBins * sizeof(cmplx32ReIm_t);
+    uint32_t lineBytes = obj->numAngleBins * sizeof(cmplx32ReIm_t);
+
+    (void) numObj;
+    if (OdsDemo_benchAngleFill(obj) == 0)
+    {
+        return 0;
+    }
+    /* grid clear + (3 row + numAngleBins column) FFTs with gather/scatter + peak search */
+    return gridBytes + (3 + obj->numAngleBins) * 7 * lineBytes + gridBytes;
+}
+
+static uint32_t OdsDemo_benchAnglePrunedSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t specBytes = 2 * ODS_ANT_GRID_NUM_ROWS * obj->numAngleBins * sizeof(float);
+
+    (void) numObj;
+    if (OdsDemo_benchAngleFill(obj) == 0)
+    {
+        return 0;
+    }
+    /* antennas + coefficients + row spectra written, and read back for every
+       evaluated azimuth bin (all of them at worst) */
+    return obj->numRxAntennas * obj->numTxAntennas * sizeof(cmplx32ReIm_t) +
+           2 * obj->numAngleBins * sizeof(float) + 2 * specBytes;
+}
+
+static uint32_t OdsDemo_benchAngleSteerSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+    uint32_t numCoarseBins = obj->numAngleBins / ODS_ANGLE_COARSE_STEP;
+    uint32_t steerBytes = 2 * ODS_ANT_GRID_STEER_LEN * sizeof(float);
+
+    (void) numObj;
+    if (OdsDemo_benchAngleFill(obj) == 0)
+    {
+        return 0;
+    }
+    /* antennas + coarse steering vectors + coarse row spectra written and read
+       back per elevation bin + 6 steering vectors per ascent step (2 steps) */
+    return obj->numRxAntennas * obj->numTxAntennas * sizeof(cmplx32ReIm_t) +
+           2 * numCoarseBins * steerBytes +
+           (1 + numCoarseBins) * 2 * ODS_ANT_GRID_NUM_ROWS * numCoarseBins * sizeof(float) +
+           2 * 6 * steerBytes;
+}
+
+static uint32_t OdsDemo_benchAngleGridSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+#ifdef ODS_ANGLE_2D_FULL_FFT
+    return OdsDemo_benchAngleFullFftSetup(obj, numObj);
+#else
+    return OdsDemo_benchAnglePrunedSetup(obj, numObj);
+#endif
+}
+
+static uint32_t OdsDemo_benchAngleSetup(OdsDemo_DSS_DataPathObj *obj, uint32_t numObj)
+{
+#ifdef ODS_ANGLE_2D_GRID_SEARCH
+    return OdsDemo_benchAngleGridSetup(obj, numObj);
+#else
+    return OdsDemo_benchAngleSteerSetup(obj, numObj);
+#endif
+}
+
+static void OdsDemo_benchAnglePrepare(OdsDemo_DSS_DataPathObj *obj)
+{
+    memcpy((void *)obj->azimuthIn, (void *)gOdsBenchVirtAnt,
+           obj->numRxAntennas * obj->numTxAntennas * sizeof(cmplx32ReIm_t));
+}
+
+static void OdsDemo_benchAngleFullFftOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    int32_t rowIdx, colIdx;
+
+    OdsDemo_angle2DPeakFullFft(obj, &rowIdx, &colIdx);
+}
+
+static void OdsDemo_benchAnglePrunedOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    int32_t rowIdx, colIdx;
+
+    OdsDemo_angle2DPeakPruned(obj, &rowIdx, &colIdx);
+}
+
+static void OdsDemo_benchAngleSteerPeakOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    float rowIdx, colIdx;
+
+    OdsDemo_angle2DPeakSteerSearch(obj, &rowIdx, &colIdx);
+}
+
+static void OdsDemo_benchAngleGridOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_angleEstimationAzimElevGrid(obj, 0);
+}
+
+static void OdsDemo_benchAngleSteerOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_angleEstimationAzimElevSteer(obj, 0);
+}
+
+static void OdsDemo_benchAngleOp(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_angleEstimationAzimElev(obj, 0);
+}
+
+static const OdsDemo_benchFixture gOdsBenchFixtures[] =
+{
+    {"rangeFft",         ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_RX,
+        OdsDemo_benchRangeFftSetup,              NULL, OdsDemo_benchRangeFftOp},
+    {"rangeFftFused",    ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_RX,
+        OdsDemo_benchRangeFftFusedSetup,         NULL, OdsDemo_benchRangeFftFusedOp},
+    {"rangeFftBatch",    ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_RX,
+        OdsDemo_benchRangeFftBatchSetup,         NULL, OdsDemo_benchRangeFftBatchOp},
+    {"radarCubePack",    ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_RX,
+        OdsDemo_benchRadarCubePackSetup,         OdsDemo_benchRadarCubePackPrepare, OdsDemo_benchRadarCubePackOp,
+        OdsDemo_benchRadarCubePackAccuracy},
+    {"dcRangeSigComp",   ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchDcRangeSigSetup,            NULL, OdsDemo_benchDcRangeSigOp},
+    {"dopplerLog2Accum", ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchDopplerSetup,               NULL, OdsDemo_benchDopplerOp},
+    {"dopplerFusedAccum", ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchDopplerFusedSetup,          NULL, OdsDemo_benchDopplerFusedOp,
+        OdsDemo_benchDopplerFusedAccuracy},
+    {"dopplerBfpAccum",  ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchDopplerBfpSetup,            NULL, OdsDemo_benchDopplerBfpOp},
+    {"dopplerPackedAccum", ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchDopplerPackedSetup,         OdsDemo_benchDopplerPackedPrepare, OdsDemo_benchDopplerPackedOp,
+        OdsDemo_benchDopplerPackedAccuracy},
+    {"edma2DFetchRangeMaj", ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchEdma2DFetchRangeMajorSetup, NULL, OdsDemo_benchEdma2DFetchOp},
+    {"edma2DFetchDopplerMaj", ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchEdma2DFetchDopplerMajorSetup, NULL, OdsDemo_benchEdma2DFetchOp},
+    {"bpmDecodeScalar",  ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchBpmSetup,                   OdsDemo_benchBpmPrepare, OdsDemo_benchBpmScalarOp},
+    {"bpmDecodeVector",  ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchBpmSetup,                   OdsDemo_benchBpmPrepare, OdsDemo_benchBpmVectorOp},
+    {"clutterUpdate",    ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchClutterUpdateSetup,         NULL, OdsDemo_benchClutterUpdateOp},
+    {"clutterReuse",     ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_VIRT,
+        OdsDemo_benchClutterSetup,               NULL, OdsDemo_benchClutterReuseOp},
+    {"cfarCadBwrap",     ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchCfarDopplerSetup,           NULL, OdsDemo_benchCfarDopplerOp},
+    {"cfarCadB_SOGO",    ODS_BENCH_DIM_RANGE,
+        OdsDemo_benchCfarRangeSetup,             NULL, OdsDemo_benchCfarRangeOp},
+    {"cfarCaSogoThr",    ODS_BENCH_DIM_RANGE,
+        OdsDemo_benchCfarRangeThrSetup,          NULL, OdsDemo_benchCfarRangeThrOp},
+    {"cfarOsWrap",       ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchCfarDopplerSetup,           NULL, OdsDemo_benchCfarOsDopplerOp},
+    {"cfarOs",           ODS_BENCH_DIM_RANGE,
+        OdsDemo_benchCfarRangeSetup,             NULL, OdsDemo_benchCfarOsRangeOp},
+    {"cfar1DFrame",      ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchCfarFrameSetup,             NULL, OdsDemo_benchCfar1DFrameOp},
+    {"cfarCa2DFrame",    ODS_BENCH_DIM_RANGE | ODS_BENCH_DIM_DOPPLER,
+        OdsDemo_benchCfarCa2DSetup,              NULL, OdsDemo_benchCfarCa2DOp},
+    {"dopplerLinesWalk", ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchDopplerLinesSetup,          NULL, OdsDemo_benchDopplerLinesWalkOp},
+    {"dopplerLinesScan", ODS_BENCH_DIM_DOPPLER | ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchDopplerLinesSetup,          NULL, OdsDemo_benchDopplerLinesScanOp},
+    {"peakGroupDetMat",  ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchPeakGroupingDetMatrixSetup, NULL, OdsDemo_benchPeakGroupingDetMatrixOp},
+#ifdef ODS_PEAK_GROUPING_STAGED
+    {"peakGroupDetMatStaged", ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchPeakGroupingStagedSetup,    NULL, OdsDemo_benchPeakGroupingStagedOp},
+#endif
+    {"peakGroupCfarQual", ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchPeakGroupingSetup,          NULL, OdsDemo_benchPeakGroupingCfarQualifiedOp},
+    {"peakGroupCfarQualIdx", ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchPeakGroupingSetup,          NULL, OdsDemo_benchPeakGroupingCfarQualifiedIdxOp},
+    {"subBinInterp",     ODS_BENCH_DIM_OBJ,
+        OdsDemo_benchSubBinInterpSetup,          NULL, OdsDemo_benchSubBinInterpOp},
+    {"angle2DPeakFullFft", 0,
+        OdsDemo_benchAngleFullFftSetup,          OdsDemo_benchAnglePrepare, OdsDemo_benchAngleFullFftOp},
+    {"angle2DPeakPruned", 0,
+        OdsDemo_benchAnglePrunedSetup,           OdsDemo_benchAnglePrepare, OdsDemo_benchAnglePrunedOp},
+    {"angle2DPeakSteer", 0,
+        OdsDemo_benchAngleSteerSetup,            OdsDemo_benchAnglePrepare, OdsDemo_benchAngleSteerPeakOp},
+    {"angleAzimElevGrid", 0,
+        OdsDemo_benchAngleGridSetup,             OdsDemo_benchAnglePrepare, OdsDemo_benchAngleGridOp},
+    {"angleAzimElevSteer", 0,
+        OdsDemo_benchAngleSteerSetup,            OdsDemo_benchAnglePrepare, OdsDemo_benchAngleSteerOp},
+    {"angleAzimElev64",  0,
+        OdsDemo_benchAngleSetup,                 OdsDemo_benchAnglePrepare, OdsDemo_benchAngleOp},
+};
+
+/**************************************************************************
+ *************************** Runner ***************************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs one fixture at one sweep point and appends the result.
+ */
+static void OdsDemo_benchRunPoint(const OdsDemo_benchFixture *fixture, uint32_t numRangeBins,
+                                  uint32_t numDopplerBins, uint32_t numRxAntennas,
+                                  uint32_t numTxAntennas, uint32_t numObj)
+{
+    OdsDemo_DSS_DataPathObj *obj = &gOdsBenchObj;
+    OdsDemo_benchResult *result;
+    OdsDemo_benchTime start;
+    uint64_t ns = 0, cycles = 0;
+    uint32_t bytes, iter;
+
+    if (gOdsBenchNumResults >= ODS_BENCH_MAX_RESULTS)
+    {
+        return;
+    }
+
+    memset((void *)obj, 0, sizeof(OdsDemo_DSS_DataPathObj));
+    memset((void *)&gOdsBenchCliCfg, 0, sizeof(gOdsBenchCliCfg));
+    memset((void *)&gOdsBenchCliCommonCfg, 0, sizeof(gOdsBenchCliCommonCfg));
+    obj->cliCfg         = &gOdsBenchCliCfg;
+    obj->cliCommonCfg   = &gOdsBenchCliCommonCfg;
+    obj->numRangeBins   = numRangeBins;
+    obj->numAdcSamples  = numRangeBins;
+    obj->numDopplerBins = numDopplerBins;
+    obj->numRxAntennas  = numRxAntennas;
+    obj->numTxAntennas  = numTxAntennas;
+    obj->numAngleBins   = ODS_NUM_ANGLE_BINS;
+    obj->numVirtualAntAzim = numRxAntennas * numTxAntennas;
+
+    if (OdsDemo_benchConfigPoint(obj) < 0)
+    {
+        System_printf("bench %s R%d D%d %dx%d: skipped, does not fit the data path heaps\n",
+                      fixture->name, numRangeBins, numDopplerBins, numRxAntennas, numTxAntennas);
+        return;
+    }
+
+    gOdsBenchSeed = 1;
+    bytes = fixture->setupFxn(obj, numObj);
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    /* warm up caches and code */
+    if (fixture->prepareFxn != NULL)
+    {
+        fixture->prepareFxn(obj);
+    }
+    fixture->opFxn(obj);
+
+    for (iter = 0; iter < ODS_BENCH_NUM_ITER; iter++)
+    {
+        if (fixture->prepareFxn != NULL)
+        {
+            fixture->prepareFxn(obj);
+        }
+        start = OdsDemo_benchNow();
+        fixture->opFxn(obj);
+        OdsDemo_benchElapsed(start, &ns, &cycles);
+    }
+
+    result = &gOdsBenchResults[gOdsBenchNumResults++];
+    strncpy(result->name, fixture->name, ODS_BENCH_NAME_LEN - 1);
+    result->name[ODS_BENCH_NAME_LEN - 1] = '\0';
+    result->numRangeBins   = numRangeBins;
+    result->numDopplerBins = numDopplerBins;
+    result->numRxAntennas  = numRxAntennas;
+    result->numTxAntennas  = numTxAntennas;
+    result->numObj         = numObj;
+    result->nsPerOp        = (uint32_t)(ns / ODS_BENCH_NUM_ITER);
+    result->cyclesPerOp    = (uint32_t)(cycles / ODS_BENCH_NUM_ITER);
+    result->bytesPerOp     = bytes;
+    result->sqnrCdB        = 0;
+    if (fixture->accuracyFxn != NULL)
+    {
+        result->sqnrCdB    = fixture->accuracyFxn(obj);
+    }
+}
+
+static void OdsDemo_benchRunFixture(const OdsDemo_benchFixture *fixture)
+{
+    uint16_t defRange[1]   = {ODS_BENCH_DEF_RANGE_BINS};
+    uint16_t defDoppler[1] = {ODS_BENCH_DEF_DOPPLER_BINS};
+    uint8_t  defVirt[1][2] = {{SYS_COMMON_NUM_RX_CHANNEL, SYS_COMMON_NUM_TX_ANTENNAS}};
+    uint16_t defObj[1]     = {ODS_BENCH_DEF_NUM_OBJ};
+    const uint16_t *rangeSweep = defRange, *dopplerSweep = defDoppler, *objSweep = defObj;
+    uint32_t numRange = 1, numDoppler = 1, numAnt = 1, numObj = 1;
+    uint32_t r, d, a, o, rx, tx;
+
+    if (fixture->dims & ODS_BENCH_DIM_RANGE)
+    {
+        rangeSweep = gOdsBenchRangeSweep;
+        numRange   = ODS_BENCH_NUM_ELEM(gOdsBenchRangeSweep);
+    }
+    if (fixture->dims & ODS_BENCH_DIM_DOPPLER)
+    {
+        dopplerSweep = gOdsBenchDopplerSweep;
+        numDoppler   = ODS_BENCH_NUM_ELEM(gOdsBenchDopplerSweep);
+    }
+    if (fixture->dims & ODS_BENCH_DIM_RX)
+    {
+        numAnt = ODS_BENCH_NUM_ELEM(gOdsBenchRxSweep);
+    }
+    else if (fixture->dims & ODS_BENCH_DIM_VIRT)
+    {
+        numAnt = ODS_BENCH_NUM_ELEM(gOdsBenchVirtSweep);
+    }
+    if (fixture->dims & ODS_BENCH_DIM_OBJ)
+    {
+        objSweep = gOdsBenchObjSweep;
+        numObj   = ODS_BENCH_NUM_ELEM(gOdsBenchObjSweep);
+    }
+
+    for (r = 0; r < numRange; r++)
+    {
+        for (d = 0; d < numDoppler; d++)
+        {
+            for (a = 0; a < numAnt; a++)
+            {
+                if (fixture->dims & ODS_BENCH_DIM_RX)
+                {
+                    rx = gOdsBenchRxSweep[a];
+                    tx = 1;
+                }
+                else if (fixture->dims & ODS_BENCH_DIM_VIRT)
+                {
+                    rx = gOdsBenchVirtSweep[a][0];
+                    tx = gOdsBenchVirtSweep[a][1];
+                }
+                else
+                {
+                    rx = defVirt[0][0];
+                    tx = defVirt[0][1];
+                }
+                for (o = 0; o < numObj; o++)
+                {
+                    OdsDemo_benchRunPoint(fixture, rangeSweep[r], dopplerSweep[d], rx, tx, objSweep[o]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Looks a result up in the baseline file and reports it if it got
+ *      slower than ODS_BENCH_REGRESSION_PCT. Cycles are compared when both
+ *      sides have them, time otherwise.
+ *
+ *  @retval
+ *      1 if the result regressed, 0 otherwise.
+ */
+static uint32_t OdsDemo_benchCompare(FILE *baseline, const OdsDemo_benchResult *result)
+{
+    char line[160];
+    char name[ODS_BENCH_NAME_LEN];
+    unsigned int r, d, rx, tx, o, ns, cycles, bytes;
+    uint32_t cur, ref;
+
+    rewind(baseline);
+    while (fgets(line, sizeof(line), baseline) != NULL)
+    {
+        if ((line[0] == '#') ||
+            (sscanf(line, "%23[^,],%u,%u,%u,%u,%u,%u,%u,%u", name, &r, &d, &rx, &tx, &o,
+                    &ns, &cycles, &bytes) != 9))
+        {
+            continue;
+        }
+        if ((strcmp(name, result->name) != 0) || (r != result->numRangeBins) ||
+            (d != result->numDopplerBins) || (rx != result->numRxAntennas) ||
+            (tx != result->numTxAntennas) || (o != result->numObj))
+        {
+            continue;
+        }
+
+        if ((cycles != 0) && (result->cyclesPerOp != 0))
+        {
+            cur = result->cyclesPerOp;
+            ref = cycles;
+        }
+        else
+        {
+            cur = result->nsPerOp;
+            ref = ns;
+        }
+        if ((uint64_t)cur * 100U > (uint64_t)ref * (100U + ODS_BENCH_REGRESSION_PCT))
+        {
+            System_printf("bench REGRESSION %s R%d D%d %dx%d N%d: %d -> %d\n",
+                          result->name, result->numRangeBins, result->numDopplerBins,
+                          result->numRxAntennas, result->numTxAntennas, result->numObj,
+                          ref, cur);
+            return 1;
+        }
+        return 0;
+    }
+    System_printf("bench %s R%d D%d %dx%d N%d: not in baseline\n",
+                  result->name, result->numRangeBins, result->numDopplerBins,
+                  result->numRxAntennas, result->numTxAntennas, result->numObj);
+    return 0;
+}
+
+/* log2|x| in Q8 of one virtual antenna: a target of amplitude amp plus
+   complex Gaussian noise of amplitude noiseAmp, both relative to the floor */
+static uint32_t OdsDemo_benchCfarQualCell(double amp, double noiseAmp)
+{
+    double u1  = ((double)OdsDemo_benchRand() + 1.0) / 16777217.0;
+    double u2  = (double)OdsDemo_benchRand() / 16777216.0;
+    double mag = noiseAmp * sqrt(-log(u1));
+    double re  = amp + mag * cos(2.0 * PI_ * u2);
+    double im  = mag * sin(2.0 * PI_ * u2);
+    double q8  = 128.0 * (log10(re * re + im * im) / log10(2.0) + ODS_BENCH_CFAR_QUAL_FLOOR_LOG2);
+
+    return (q8 > 0.0) ? (uint32_t)q8 : 0U;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Compares the detection quality of the range CFAR modes on synthetic
+ *      range lines: the accumulated log2 magnitude of the virtual antennas
+ *      with ODS_BENCH_CFAR_QUAL_NUM_TGT targets a few range bins apart, the
+ *      multi-person case in which the targets raise the cell averaging
+ *      noise estimate of their neighbours, and every other line a clutter
+ *      edge behind them, at which the smallest-of average false alarms. A
+ *      target counts as detected if a detection is within one range bin of
+ *      it, every other detection is a false alarm.
+ */
+static void OdsDemo_benchCfarQuality(void)
+{
+    static const char *modeName[] = {"CA", "CAGO", "CASO", "OS"};
+    OdsDemo_DSS_DataPathObj *obj = &gOdsBenchObj;
+    uint16_t tgtIdx[ODS_BENCH_CFAR_QUAL_NUM_TGT];
+    double   tgtAmp[ODS_BENCH_CFAR_QUAL_NUM_TGT];
+    uint32_t numDetected[MMW_NOISE_AVG_MODE_CFAR_OS + 1U];
+    uint32_t numFalse[MMW_NOISE_AVG_MODE_CFAR_OS + 1U];
+    uint32_t numVirtAnt = SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS;
+    uint32_t line, mode, t, i, ant, numDet, cell, hit, edgeIdx;
+    double   edgeAmp = pow(10.0, (double)ODS_BENCH_CFAR_QUAL_EDGE_DB / 20.0);
+    uint32_t snrSpan = ODS_BENCH_CFAR_QUAL_SNR_MAX_DB - ODS_BENCH_CFAR_QUAL_SNR_MIN_DB + 1U;
+
+    memset((void *)obj, 0, sizeof(OdsDemo_DSS_DataPathObj));
+    memset((void *)&gOdsBenchCliCfg, 0, sizeof(gOdsBenchCliCfg));
+    memset((void *)&gOdsBenchCliCommonCfg, 0, sizeof(gOdsBenchCliCommonCfg));
+    obj->cliCfg         = &gOdsBenchCliCfg;
+    obj->cliCommonCfg   = &gOdsBenchCliCommonCfg;
+    obj->numRangeBins   = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numAdcSamples  = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numDopplerBins = ODS_BENCH_DEF_DOPPLER_BINS;
+    obj->numRxAntennas  = SYS_COMMON_NUM_RX_CHANNEL;
+    obj->numTxAntennas  = SYS_COMMON_NUM_TX_ANTENNAS;
+    obj->numAngleBins   = ODS_NUM_ANGLE_BINS;
+    obj->numVirtualAntAzim = numVirtAnt;
+    if (OdsDemo_benchConfigPoint(obj) < 0)
+    {
+        return;
+    }
+
+    memset((void *)numDetected, 0, sizeof(numDetected));
+    memset((void *)numFalse, 0, sizeof(numFalse));
+    for (line = 0; line < ODS_BENCH_CFAR_QUAL_NUM_LINES; line++)
+    {
+        tgtIdx[0] = (uint16_t)(ODS_BENCH_CFAR_RANGE_WIN + OdsDemo_benchRand() % (obj->numRangeBins / 2U));
+        for (t = 0; t < ODS_BENCH_CFAR_QUAL_NUM_TGT; t++)
+        {
+            if (t > 0)
+            {
+                tgtIdx[t] = tgtIdx[t - 1] + 2U + (uint16_t)(OdsDemo_benchRand() % 6U);
+            }
+            tgtAmp[t] = pow(10.0, (double)(ODS_BENCH_CFAR_QUAL_SNR_MIN_DB + OdsDemo_benchRand() % snrSpan) / 20.0);
+        }
+        edgeIdx = (line & 1U) ? (tgtIdx[ODS_BENCH_CFAR_QUAL_NUM_TGT - 1U] + 2U * ODS_BENCH_CFAR_RANGE_WIN) :
+                                obj->numRangeBins;
+        for (cell = 0; cell < obj->numRangeBins; cell++)
+        {
+            double amp = 0.0;
+
+            for (t = 0; t < ODS_BENCH_CFAR_QUAL_NUM_TGT; t++)
+            {
+                amp = (tgtIdx[t] == cell) ? tgtAmp[t] : amp;
+            }
+            obj->sumAbsRange[cell] = 0;
+            for (ant = 0; ant < numVirtAnt; ant++)
+            {
+                obj->sumAbsRange[cell] += (uint16_t)OdsDemo_benchCfarQualCell(amp, (cell < edgeIdx) ? 1.0 : edgeAmp);
+            }
+        }
+
+        for (mode = 0; mode <= MMW_NOISE_AVG_MODE_CFAR_OS; mode++)
+        {
+            if (mode == MMW_NOISE_AVG_MODE_CFAR_OS)
+            {
+                numDet = OdsDemo_cfarOs(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                        ODS_BENCH_CFAR_THRESHOLD, NULL, ODS_BENCH_CFAR_RANGE_GUARD,
+                                        ODS_BENCH_CFAR_RANGE_WIN, obj->cfarOsHist);
+            }
+            else
+            {
+                numDet = mmwavelib_cfarCadB_SOGO(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                                 mode, ODS_BENCH_CFAR_THRESHOLD,
+                                                 ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                                                 ODS_BENCH_CFAR_RANGE_WIN);
+            }
+            for (t = 0; t < ODS_BENCH_CFAR_QUAL_NUM_TGT; t++)
+            {
+                hit = 0;
+                for (i = 0; i < numDet; i++)
+                {
+                    hit |= (abs((int32_t)obj->cfarDetObjIndexBuf[i] - (int32_t)tgtIdx[t]) <= 1);
+                }
+                numDetected[mode] += hit;
+            }
+            for (i = 0; i < numDet; i++)
+            {
+                hit = 0;
+                for (t = 0; t < ODS_BENCH_CFAR_QUAL_NUM_TGT; t++)
+                {
+                    hit |= (abs((int32_t)obj->cfarDetObjIndexBuf[i] - (int32_t)tgtIdx[t]) <= 1);
+                }
+                numFalse[mode] += (hit == 0);
+            }
+        }
+    }
+
+    for (mode = 0; mode <= MMW_NOISE_AVG_MODE_CFAR_OS; mode++)
+    {
+        System_printf("bench cfarQuality %s: %d of %d targets detected, %d false alarms in %d lines\n",
+                      modeName[mode], numDetected[mode],
+                      ODS_BENCH_CFAR_QUAL_NUM_LINES * ODS_BENCH_CFAR_QUAL_NUM_TGT,
+                      numFalse[mode], ODS_BENCH_CFAR_QUAL_NUM_LINES);
+    }
+}
+
+/* Detection matrix frame of the range dependent threshold check: the
+   accumulated log2 magnitude of the virtual antennas with the near range
+   clutter texture and numTgt targets at random cells, returned in tgtCell */
+static void OdsDemo_benchCfarThrFrame(OdsDemo_DSS_DataPathObj *obj, uint32_t *tgtCell, uint32_t numTgt)
+{
+    double   tgtAmp[ODS_BENCH_CFAR_THR_NUM_TGT];
+    uint32_t numVirtAnt = SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS;
+    uint32_t snrSpan = ODS_BENCH_CFAR_THR_SNR_MAX_DB - ODS_BENCH_CFAR_THR_SNR_MIN_DB + 1U;
+    uint32_t rangeIdx, dopplerIdx, cell, ant, t;
+    double   sigma, u1, u2, texture, amp;
+
+    for (t = 0; t < numTgt; t++)
+    {
+        tgtCell[t] = OdsDemo_benchRand() % (obj->numRangeBins * obj->numDopplerBins);
+        tgtAmp[t]  = pow(10.0, (double)(ODS_BENCH_CFAR_THR_SNR_MIN_DB + OdsDemo_benchRand() % snrSpan) / 20.0);
+    }
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        sigma = (rangeIdx < ODS_BENCH_CFAR_THR_NEAR_BINS) ?
+                (ODS_BENCH_CFAR_THR_CLUTTER_SIGMA * (ODS_BENCH_CFAR_THR_NEAR_BINS - rangeIdx) /
+                 ODS_BENCH_CFAR_THR_NEAR_BINS) : 0.0;
+        for (dopplerIdx = 0; dopplerIdx < obj->numDopplerBins; dopplerIdx++)
+        {
+            cell = rangeIdx * obj->numDopplerBins + dopplerIdx;
+            u1 = ((double)OdsDemo_benchRand() + 1.0) / 16777217.0;
+            u2 = (double)OdsDemo_benchRand() / 16777216.0;
+            texture = exp(sigma * sqrt(-2.0 * log(u1)) * cos(2.0 * PI_ * u2));
+            amp = 0.0;
+            for (t = 0; t < numTgt; t++)
+            {
+                amp = (tgtCell[t] == cell) ? tgtAmp[t] : amp;
+            }
+            obj->detMatrix[cell] = 0;
+            for (ant = 0; ant < numVirtAnt; ant++)
+            {
+                obj->detMatrix[cell] += (uint16_t)OdsDemo_benchCfarQualCell(amp, texture);
+            }
+        }
+    }
+}
+
+/* CFAR along Doppler on every range bin and along range on every Doppler
+   bin of the frame, with or without the threshold tables of obj. A cell
+   both passes detect counts as detected target if it is one of tgtCell and
+   as false alarm otherwise. */
+static void OdsDemo_benchCfarThrDetect(OdsDemo_DSS_DataPathObj *obj, uint8_t *dopplerDet, uint32_t useTables,
+                                       const uint32_t *tgtCell, uint32_t numTgt,
+                                       uint32_t *numDetected, uint32_t *numFalse)
+{
+    uint32_t rangeIdx, dopplerIdx, numDet, i, t, cell, hit;
+    int32_t  thr;
+
+    memset((void *)dopplerDet, 0, obj->numRangeBins * obj->numDopplerBins);
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        thr = (int32_t) ODS_BENCH_CFAR_THRESHOLD + (useTables ? obj->cfarThrOffsDoppler[rangeIdx] : 0);
+        numDet = mmwavelib_cfarCadBwrap(&obj->detMatrix[rangeIdx * obj->numDopplerBins],
+                                        obj->cfarDetObjIndexBuf, obj->numDopplerBins,
+                                        (thr > 0) ? (uint32_t) thr : 0U, ODS_BENCH_CFAR_DOPPLER_SHIFT,
+                                        ODS_BENCH_CFAR_DOPPLER_GUARD, ODS_BENCH_CFAR_DOPPLER_WIN);
+        for (i = 0; i < numDet; i++)
+        {
+            dopplerDet[rangeIdx * obj->numDopplerBins + obj->cfarDetObjIndexBuf[i]] = 1;
+        }
+    }
+    for (dopplerIdx = 0; dopplerIdx < obj->numDopplerBins; dopplerIdx++)
+    {
+        for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+        {
+            obj->sumAbsRange[rangeIdx] = obj->detMatrix[rangeIdx * obj->numDopplerBins + dopplerIdx];
+        }
+        if (useTables)
+        {
+            numDet = OdsDemo_cfarCaSogo(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                        MMW_NOISE_AVG_MODE_CFAR_CA, ODS_BENCH_CFAR_THRESHOLD,
+                                        obj->cfarThrOffsRange, ODS_BENCH_CFAR_RANGE_SHIFT,
+                                        ODS_BENCH_CFAR_RANGE_GUARD, ODS_BENCH_CFAR_RANGE_WIN);
+        }
+        else
+        {
+            numDet = mmwavelib_cfarCadB_SOGO(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                             MMW_NOISE_AVG_MODE_CFAR_CA, ODS_BENCH_CFAR_THRESHOLD,
+                                             ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                                             ODS_BENCH_CFAR_RANGE_WIN);
+        }
+        for (i = 0; i < numDet; i++)
+        {
+            cell = obj->cfarDetObjIndexBuf[i] * obj->numDopplerBins + dopplerIdx;
+            if (dopplerDet[cell])
+            {
+                hit = 0;
+                for (t = 0; t < numTgt; t++)
+                {
+                    hit |= (tgtCell[t] == cell);
+                }
+                *numDetected += hit;
+                *numFalse += (hit == 0);
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Checks the range dependent CFAR thresholds. The range CFAR kernels
+ *      with a random threshold table must detect the same cells as the
+ *      kernels without one run cell by cell with the threshold of the cell.
+ *      Then both threshold tables are calibrated on empty-room frames whose
+ *      near range clutter false alarms at the fixed threshold, and the
+ *      detections and false alarms of frames with targets are reported with
+ *      the fixed threshold and with the calibrated tables.
+ */
+static void OdsDemo_benchCfarThrTable(void)
+{
+    static int16_t  thrOffsRange[ODS_BENCH_DEF_RANGE_BINS];
+    static int16_t  thrOffsDoppler[ODS_BENCH_DEF_RANGE_BINS];
+    static uint32_t calibAccum[ODS_BENCH_DEF_RANGE_BINS];
+    static uint8_t  dopplerDet[ODS_BENCH_DEF_RANGE_BINS * ODS_BENCH_DEF_DOPPLER_BINS];
+    OdsDemo_DSS_DataPathObj *obj = &gOdsBenchObj;
+    uint16_t refOut[ODS_BENCH_DEF_RANGE_BINS];
+    uint32_t tgtCell[ODS_BENCH_CFAR_THR_NUM_TGT];
+    uint32_t numDetected[2], numFalse[2];
+    uint32_t numVirtAnt = SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS;
+    uint32_t line, mode, cell, numDet, numRef, detIdx, frame, rangeIdx, useTables;
+    uint32_t lineMismatch, numMismatch = 0;
+
+    memset((void *)obj, 0, sizeof(OdsDemo_DSS_DataPathObj));
+    memset((void *)&gOdsBenchCliCfg, 0, sizeof(gOdsBenchCliCfg));
+    memset((void *)&gOdsBenchCliCommonCfg, 0, sizeof(gOdsBenchCliCommonCfg));
+    obj->cliCfg         = &gOdsBenchCliCfg;
+    obj->cliCommonCfg   = &gOdsBenchCliCommonCfg;
+    obj->numRangeBins   = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numAdcSamples  = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numDopplerBins = ODS_BENCH_DEF_DOPPLER_BINS;
+    obj->numRxAntennas  = SYS_COMMON_NUM_RX_CHANNEL;
+    obj->numTxAntennas  = SYS_COMMON_NUM_TX_ANTENNAS;
+    obj->numAngleBins   = ODS_NUM_ANGLE_BINS;
+    obj->numVirtualAntAzim = numVirtAnt;
+    if (OdsDemo_benchConfigPoint(obj) < 0)
+    {
+        return;
+    }
+    while ((1U << obj->log2NumDopplerBins) < obj->numDopplerBins)
+    {
+        obj->log2NumDopplerBins++;
+    }
+
+    /* table against cell by cell thresholds, the three cell averages and OS */
+    for (line = 0; line < ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS; line++)
+    {
+        OdsDemo_benchFillLog2Abs(obj->sumAbsRange, obj->numRangeBins);
+        for (cell = 0; cell < obj->numRangeBins; cell++)
+        {
+            thrOffsRange[cell] = (int16_t)((OdsDemo_benchRand() & 0x7FFU) - 0x400);
+        }
+        mode = line % (MMW_NOISE_AVG_MODE_CFAR_OS + 1U);
+        if (mode == MMW_NOISE_AVG_MODE_CFAR_OS)
+        {
+            numDet = OdsDemo_cfarOs(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                    ODS_BENCH_CFAR_THRESHOLD, thrOffsRange, ODS_BENCH_CFAR_RANGE_GUARD,
+                                    ODS_BENCH_CFAR_RANGE_WIN, obj->cfarOsHist);
+        }
+        else
+        {
+            numDet = OdsDemo_cfarCaSogo(obj->sumAbsRange, obj->cfarDetObjIndexBuf, obj->numRangeBins,
+                                        mode, ODS_BENCH_CFAR_THRESHOLD, thrOffsRange,
+                                        ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                                        ODS_BENCH_CFAR_RANGE_WIN);
+        }
+        detIdx = 0;
+        lineMismatch = 0;
+        for (cell = 0; cell < obj->numRangeBins; cell++)
+        {
+            if (mode == MMW_NOISE_AVG_MODE_CFAR_OS)
+            {
+                numRef = OdsDemo_cfarOs(obj->sumAbsRange, refOut, obj->numRangeBins,
+                                        ODS_BENCH_CFAR_THRESHOLD + thrOffsRange[cell], NULL,
+                                        ODS_BENCH_CFAR_RANGE_GUARD, ODS_BENCH_CFAR_RANGE_WIN, obj->cfarOsHist);
+            }
+            else
+            {
+                numRef = mmwavelib_cfarCadB_SOGO(obj->sumAbsRange, refOut, obj->numRangeBins,
+                                                 mode, ODS_BENCH_CFAR_THRESHOLD + thrOffsRange[cell],
+                                                 ODS_BENCH_CFAR_RANGE_SHIFT, ODS_BENCH_CFAR_RANGE_GUARD,
+                                                 ODS_BENCH_CFAR_RANGE_WIN);
+            }
+            while ((numRef > 0) && (refOut[numRef - 1] > cell))
+            {
+                numRef--;
+            }
+            if ((numRef > 0) && (refOut[numRef - 1] == cell))
+            {
+                lineMismatch |= (detIdx >= numDet) || (obj->cfarDetObjIndexBuf[detIdx] != cell);
+                detIdx++;
+            }
+        }
+        numMismatch += lineMismatch | (detIdx != numDet);
+    }
+    System_printf("bench cfarThrTable: %d of %d lines differ from the cell by cell threshold\n",
+                  numMismatch, ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS);
+
+    /* calibration on empty-room frames */
+    obj->cliCfg->cfarCfgRange.thresholdScale   = ODS_BENCH_CFAR_THRESHOLD;
+    obj->cliCfg->cfarCfgDoppler.thresholdScale = ODS_BENCH_CFAR_THRESHOLD;
+    obj->cfarThrCalibCfg.numFrames = ODS_BENCH_CFAR_THR_CALIB_FRAMES;
+    obj->cfarThrCalibCfg.margin    = ODS_BENCH_CFAR_THR_MARGIN;
+    obj->cfarThrCalibFramesLeft    = ODS_BENCH_CFAR_THR_CALIB_FRAMES;
+    obj->cfarThrOffsRange          = thrOffsRange;
+    obj->cfarThrOffsDoppler        = thrOffsDoppler;
+    obj->cfarThrCalibAccum         = calibAccum;
+    memset((void *)calibAccum, 0, sizeof(calibAccum));
+    for (frame = 0; frame < ODS_BENCH_CFAR_THR_CALIB_FRAMES; frame++)
+    {
+        OdsDemo_benchCfarThrFrame(obj, tgtCell, 0);
+        for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+        {
+            OdsDemo_cfarThrCalibAccum(obj, &obj->detMatrix[rangeIdx * obj->numDopplerBins], rangeIdx);
+        }
+        OdsDemo_cfarThrCalibFrameDone(obj);
+    }
+
+    memset((void *)numDetected, 0, sizeof(numDetected));
+    memset((void *)numFalse, 0, sizeof(numFalse));
+    for (frame = 0; frame < ODS_BENCH_CFAR_THR_TEST_FRAMES; frame++)
+    {
+        OdsDemo_benchCfarThrFrame(obj, tgtCell, ODS_BENCH_CFAR_THR_NUM_TGT);
+        for (useTables = 0; useTables < 2; useTables++)
+        {
+            OdsDemo_benchCfarThrDetect(obj, dopplerDet, useTables, tgtCell, ODS_BENCH_CFAR_THR_NUM_TGT,
+                                       &numDetected[useTables], &numFalse[useTables]);
+        }
+    }
+    for (useTables = 0; useTables < 2; useTables++)
+    {
+        System_printf("bench cfarThrTable %s: %d of %d targets detected, %d false alarms in %d frames\n",
+                      useTables ? "calibrated" : "fixed", numDetected[useTables],
+                      ODS_BENCH_CFAR_THR_TEST_FRAMES * ODS_BENCH_CFAR_THR_NUM_TGT,
+                      numFalse[useTables], ODS_BENCH_CFAR_THR_TEST_FRAMES);
+    }
+}
+
+/* Magnitude of the n-point DFT of a unit tone at freq bins from the DFT bin,
+   with the Blackman (range) or the Hanning (Doppler) window of the chain */
+static double OdsDemo_benchWindowedToneMag(double freq, uint32_t n, uint32_t blackman)
+{
+    double re = 0, im = 0, w, ph;
+    uint32_t m;
+
+    for (m = 0; m < n; m++)
+    {
+        ph = 2.0 * PI_ * m / (n - 1);
+        w  = blackman ? (0.42 - 0.5 * cos(ph) + 0.08 * cos(2.0 * ph)) : (0.5 - 0.5 * cos(ph));
+        re += w * cos(2.0 * PI_ * freq * m / n);
+        im += w * sin(2.0 * PI_ * freq * m / n);
+    }
+    return sqrt(re * re + im * im);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Measures the sub-bin interpolation error on targets at random
+ *      fractional range and Doppler bins. The detection matrix cells around
+ *      each target hold the accumulated Q8 log2 magnitude of the virtual
+ *      antennas of the windowed tone, and the RMS error of the interpolated
+ *      and of the integer bin indices is reported in thousandths of a bin.
+ */
+static void OdsDemo_benchSubBinAccuracy(void)
+{
+    OdsDemo_DSS_DataPathObj *obj = &gOdsBenchObj;
+    uint32_t numVirtAnt = SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS;
+    uint32_t t, r, d, rangeIdx, dopplerIdx;
+    double rangeFreq, dopplerFreq, rangeMag[3], dopplerMag[3], err;
+    double errSub[2] = {0, 0}, errInt[2] = {0, 0};
+
+    memset((void *)obj, 0, sizeof(OdsDemo_DSS_DataPathObj));
+    memset((void *)&gOdsBenchCliCfg, 0, sizeof(gOdsBenchCliCfg));
+    memset((void *)&gOdsBenchCliCommonCfg, 0, sizeof(gOdsBenchCliCommonCfg));
+    obj->cliCfg         = &gOdsBenchCliCfg;
+    obj->cliCommonCfg   = &gOdsBenchCliCommonCfg;
+    obj->numRangeBins   = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numAdcSamples  = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numDopplerBins = ODS_BENCH_DEF_DOPPLER_BINS;
+    obj->numRxAntennas  = SYS_COMMON_NUM_RX_CHANNEL;
+    obj->numTxAntennas  = SYS_COMMON_NUM_TX_ANTENNAS;
+    obj->numAngleBins   = ODS_NUM_ANGLE_BINS;
+    obj->numVirtualAntAzim = numVirtAnt;
+    if (OdsDemo_benchConfigPoint(obj) < 0)
+    {
+        return;
+    }
+    obj->detObjSubBin = gOdsBenchSubBin;
+    obj->numDetObj    = 1;
+
+    for (t = 0; t < ODS_BENCH_SUB_BIN_NUM_TGT; t++)
+    {
+        rangeFreq   = 2.0 + (obj->numRangeBins - 4U) * (double) (OdsDemo_benchRand() & 0xFFFFU) / 65536.0;
+        dopplerFreq = obj->numDopplerBins * (double) (OdsDemo_benchRand() & 0xFFFFU) / 65536.0;
+        rangeIdx    = (uint32_t) floor(rangeFreq + 0.5);
+        dopplerIdx  = (uint32_t) floor(dopplerFreq + 0.5) & (obj->numDopplerBins - 1U);
+
+        for (r = 0; r < 3; r++)
+        {
+            rangeMag[r]   = OdsDemo_benchWindowedToneMag(rangeFreq - (rangeIdx + r - 1.0), obj->numAdcSamples, 1);
+            dopplerMag[r] = OdsDemo_benchWindowedToneMag(dopplerFreq - (floor(dopplerFreq + 0.5) + r - 1.0),
+                                                         obj->numDopplerBins, 0);
+        }
+        for (r = 0; r < 3; r++)
+        {
+            for (d = 0; d < 3; d++)
+            {
+                obj->detMatrix[(rangeIdx + r - 1U) * obj->numDopplerBins +
+                               ((dopplerIdx + d - 1U) & (obj->numDopplerBins - 1U))] =
+                    (uint16_t) floor(numVirtAnt * 256.0 * log2(rangeMag[r] * dopplerMag[d]) + 0.5);
+            }
+        }
+
+        obj->detObj2D[0].rangeIdx   = rangeIdx;
+        obj->detObj2D[0].dopplerIdx = DOPPLER_IDX_TO_SIGNED(dopplerIdx, obj->numDopplerBins);
+        OdsDemo_detObjSubBinInterp(obj);
+
+        err = rangeIdx + obj->detObjSubBin[0].rangeOffs / (double) (1 << ODS_SUB_BIN_QFORMAT) - rangeFreq;
+        errSub[0] += err * err;
+        err = rangeIdx - rangeFreq;
+        errInt[0] += err * err;
+        err = floor(dopplerFreq + 0.5) + obj->detObjSubBin[0].dopplerOffs / (double) (1 << ODS_SUB_BIN_QFORMAT) -
+              dopplerFreq;
+        errSub[1] += err * err;
+        err = floor(dopplerFreq + 0.5) - dopplerFreq;
+        errInt[1] += err * err;
+    }
+
+    System_printf("bench subBinInterp: rms error range %d, Doppler %d (integer bins %d, %d) thousandths of a bin\n",
+                  (int32_t) (1000.0 * sqrt(errSub[0] / ODS_BENCH_SUB_BIN_NUM_TGT)),
+                  (int32_t) (1000.0 * sqrt(errSub[1] / ODS_BENCH_SUB_BIN_NUM_TGT)),
+                  (int32_t) (1000.0 * sqrt(errInt[0] / ODS_BENCH_SUB_BIN_NUM_TGT)),
+                  (int32_t) (1000.0 * sqrt(errInt[1] / ODS_BENCH_SUB_BIN_NUM_TGT)));
+}
+
+/* Checks an output list capped to maxNumObjCap objects against the complete
+   output of the same CFAR list: the capped list holds the strongest objects
+   of the complete one in CFAR order and counts the others as dropped.
+   Returns 1 on a mismatch. */
+static uint32_t OdsDemo_benchObjCapMismatch(const MmwDemo_detectedObj *fullOut, uint32_t numFull,
+                                            const MmwDemo_detectedObj *capOut, uint32_t numCap,
+                                            uint32_t numDropped, uint32_t maxNumObjCap,
+                                            uint32_t numDopplerBins)
+{
+    uint32_t i, k = 0, minKept = 0xFFFFU, maxDropped = 0;
+
+    if ((numCap != MIN(numFull, maxNumObjCap)) || (numDropped != (numFull - numCap)))
+    {
+        return 1;
+    }
+    /* both lists are in CFAR order, so the capped one is a subsequence */
+    for (i = 0; i < numFull; i++)
+    {
+        if ((k < numCap) &&
+            (capOut[k].rangeIdx == fullOut[i].rangeIdx) &&
+            (DOPPLER_IDX_TO_UNSIGNED(capOut[k].dopplerIdx, numDopplerBins) ==
+             DOPPLER_IDX_TO_UNSIGNED(fullOut[i].dopplerIdx, numDopplerBins)) &&
+            (capOut[k].peakVal == fullOut[i].peakVal))
+        {
+            minKept = MIN(minKept, fullOut[i].peakVal);
+            k++;
+        }
+        else
+        {
+            maxDropped = MAX(maxDropped, fullOut[i].peakVal);
+        }
+    }
+    return (k != numCap) || (maxDropped > minKept);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the indexed and the list walking CFAR qualified peak grouping,
+ *      and the staged and the kernel reading detection matrix peak grouping,
+ *      on random CFAR lists and reports the lists on which the outputs
+ *      differ. The lists are ordered like the detection chain produces them,
+ *      with a random Doppler size, cell occupancy, range limits and grouping
+ *      directions, and peak values drawn from a narrow span so that equal
+ *      neighbours are frequent. The detection matrix holds the peak values
+ *      of the listed cells and values from the same span elsewhere.
+ *      The staged grouping is skipped without an EDMA context.
+ *      The CFAR qualified grouping is also run with a random object
+ *      capacity up to the default one, and the lists on which it does not
+ *      keep the strongest objects of the complete output in CFAR order are
+ *      reported.
+ */
+static void OdsDemo_benchPeakGroupingEquivalence(void)
+{
+    static MmwDemo_detectedObj refOut[MMW_MAX_OBJ_OUT];
+    static MmwDemo_detectedObj fullOut[MAX_DET_OBJECTS_RAW];
+    OdsDemo_DSS_DataPathObj *obj = &gOdsBenchObj;
+    uint32_t list, r, d, n, i, occupancy, minRange, maxRange, dirs;
+    uint32_t numRef, numIdx, numMismatch = 0;
+#ifdef ODS_PEAK_GROUPING_STAGED
+    uint32_t numMismatchStaged = 0;
+#endif
+    uint32_t numDropped, numDroppedCap, numFull, maxNumObjCap, numMismatchCap = 0;
+
+    memset((void *)obj, 0, sizeof(OdsDemo_DSS_DataPathObj));
+    memset((void *)&gOdsBenchCliCfg, 0, sizeof(gOdsBenchCliCfg));
+    memset((void *)&gOdsBenchCliCommonCfg, 0, sizeof(gOdsBenchCliCommonCfg));
+    obj->cliCfg         = &gOdsBenchCliCfg;
+    obj->cliCommonCfg   = &gOdsBenchCliCommonCfg;
+    obj->numRangeBins   = ODS_BENCH_DEF_RANGE_BINS;
+    obj->numAdcSamples  = ODS_BENCH_DEF_RANGE_BINS;
+    /* buffers for the largest Doppler size of the lists */
+    obj->numDopplerBins = gOdsBenchDopplerSweep[ODS_BENCH_NUM_ELEM(gOdsBenchDopplerSweep) - 1];
+    obj->numRxAntennas  = SYS_COMMON_NUM_RX_CHANNEL;
+    obj->numTxAntennas  = SYS_COMMON_NUM_TX_ANTENNAS;
+    obj->numAngleBins   = ODS_NUM_ANGLE_BINS;
+    obj->numVirtualAntAzim = SYS_COMMON_NUM_RX_CHANNEL * SYS_COMMON_NUM_TX_ANTENNAS;
+    if (OdsDemo_benchConfigPoint(obj) < 0)
+    {
+        return;
+    }
+
+    for (list = 0; list < ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS; list++)
+    {
+        obj->numDopplerBins = gOdsBenchDopplerSweep[OdsDemo_benchRand() % ODS_BENCH_NUM_ELEM(gOdsBenchDopplerSweep)];
+        occupancy = 1U + OdsDemo_benchRand() % 64U;
+        minRange  = OdsDemo_benchRand() % 8U;
+        maxRange  = obj->numRangeBins - 1U - OdsDemo_benchRand() % 8U;
+        dirs      = OdsDemo_benchRand() & 3U;
+
+        n = 0;
+        for (d = 0; d < obj->numDopplerBins; d++)
+        {
+            for (r = 0; r < obj->numRangeBins; r++)
+            {
+                obj->detMatrix[r * obj->numDopplerBins + d] = (uint16_t)(0x2000U + (OdsDemo_benchRand() & 0x1FU));
+                if (((OdsDemo_benchRand() & 0xFFU) < occupancy) && (n < MAX_DET_OBJECTS_RAW))
+                {
+                    obj->detObj2DRaw[n].rangeIdx   = r;
+                    obj->detObj2DRaw[n].dopplerIdx = d;
+                    obj->detObj2DRaw[n].peakVal    = obj->detMatrix[r * obj->numDopplerBins + d];
+                    n++;
+                }
+            }
+        }
+
+        numRef = OdsDemo_cfarPeakGroupingCfarQualified(refOut, obj->detObj2DRaw, n, obj->numDopplerBins,
+                                                       maxRange, minRange, dirs >> 1, dirs & 1U,
+                                                       MMW_MAX_OBJ_OUT, &numDropped);
+        numIdx = OdsDemo_cfarPeakGroupingCfarQualifiedIndexed(obj->detObj2D, obj->detObj2DRaw, n,
+                                                              obj->numDopplerBins, maxRange, minRange,
+                                                              dirs >> 1, dirs & 1U,
+                                                              MMW_MAX_OBJ_OUT, &numDroppedCap);
+        for (i = 0; (i < numRef) && (numIdx == numRef); i++)
+        {
+            if ((refOut[i].rangeIdx != obj->detObj2D[i].rangeIdx) ||
+                (refOut[i].dopplerIdx != obj->detObj2D[i].dopplerIdx) ||
+                (refOut[i].peakVal != obj->detObj2D[i].peakVal))
+            {
+                break;
+            }
+        }
+        numMismatch += (numIdx != numRef) || (i < numRef) || (numDroppedCap != numDropped);
+
+        /* strongest-first selection, against the complete output */
+        numFull = OdsDemo_cfarPeakGroupingCfarQualified(fullOut, obj->detObj2DRaw, n, obj->numDopplerBins,
+                                                        maxRange, minRange, dirs >> 1, dirs & 1U,
+                                                        MAX_DET_OBJECTS_RAW, &numDroppedCap);
+        maxNumObjCap = 1U + OdsDemo_benchRand() % MMW_MAX_OBJ_OUT;
+        numIdx = OdsDemo_cfarPeakGroupingCfarQualified(obj->detObj2D, obj->detObj2DRaw, n,
+                                                       obj->numDopplerBins, maxRange, minRange,
+                                                       dirs >> 1, dirs & 1U,
+                                                       maxNumObjCap, &numDroppedCap);
+        numMismatchCap += OdsDemo_benchObjCapMismatch(fullOut, numFull, obj->detObj2D, numIdx,
+                                                      numDroppedCap, maxNumObjCap, obj->numDopplerBins);
+
+#ifdef ODS_PEAK_GROUPING_STAGED
+        if (gOdsBenchContext == NULL)
+        {
+            continue;
+        }
+        obj->context                = gOdsBenchContext;
+        obj->numChirpsPerFrame      = obj->numDopplerBins * obj->numTxAntennas;
+        obj->numChirpsPerChirpEvent = 1;
+        obj->cliCfg->peakGroupingCfg.minRangeIndex        = minRange;
+        obj->cliCfg->peakGroupingCfg.maxRangeIndex        = maxRange;
+        obj->cliCfg->peakGroupingCfg.inDopplerDirectionEn = dirs >> 1;
+        obj->cliCfg->peakGroupingCfg.inRangeDirectionEn   = dirs & 1U;
+        if (OdsDemo_dataPathConfigEdma(obj) < 0)
+        {
+            numMismatchStaged++;
+            continue;
+        }
+        numRef = OdsDemo_cfarPeakGrouping(refOut, obj->detObj2DRaw, n, obj->detMatrix, obj->numDopplerBins,
+                                          maxRange, minRange, dirs >> 1, dirs & 1U,
+                                          MMW_MAX_OBJ_OUT, &numDropped);
+        numIdx = OdsDemo_cfarPeakGroupingStaged(obj, n);
+        for (i = 0; (i < numRef) && (numIdx == numRef); i++)
+        {
+            if ((refOut[i].rangeIdx != obj->detObj2D[i].rangeIdx) ||
+                (refOut[i].dopplerIdx != obj->detObj2D[i].dopplerIdx) ||
+                (refOut[i].peakVal != obj->detObj2D[i].peakVal))
+            {
+                break;
+            }
+        }
+        numMismatchStaged += (numIdx != numRef) || (i < numRef) || (obj->numDetObjDropped != numDropped);
+#endif
+    }
+
+    System_printf("bench peakGroupEquivalence: %d of %d random CFAR lists differ\n",
+                  numMismatch, ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS);
+#ifdef ODS_PEAK_GROUPING_STAGED
+    if (gOdsBenchContext != NULL)
+    {
+        System_printf("bench peakGroupEquivalence staged: %d of %d random CFAR lists differ\n",
+                      numMismatchStaged, ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS);
+    }
+#endif
+    System_printf("bench peakGroupEquivalence objCap: %d of %d random CFAR lists differ\n",
+                  numMismatchCap, ODS_BENCH_PEAK_GROUP_EQ_NUM_LISTS);
+}
+
+/**************************************************************************
+ *************************** Exported Functions ***************************
+ **************************************************************************/
+
+int32_t OdsDemo_benchRun(OdsDemo_DSS_dataPathContext_t *context, const char *resultPath,
+                         const char *baselinePath)
+{
+    const OdsDemo_benchResult *result;
+    FILE *out = NULL, *baseline = NULL;
+    uint32_t i, numRegressions = 0;
+    int32_t retVal;
+
+    gOdsBenchL1.base = &gMmwL1[0];
+    gOdsBenchL1.size = MMW_L1_HEAP_SIZE;
+    gOdsBenchL2.base = &gOdsL2[0];
+    gOdsBenchL2.size = MMW_L2_HEAP_SIZE;
+    gOdsBenchL3.base = &gOdsL3[0];
+    gOdsBenchL3.size = L3_HEAP_SIZE;
+    gOdsBenchNumResults = 0;
+    gOdsBenchContext = context;
+
+    for (i = 0; i < ODS_BENCH_NUM_ELEM(gOdsBenchFixtures); i++)
+    {
+        OdsDemo_benchRunFixture(&gOdsBenchFixtures[i]);
+    }
+    OdsDemo_benchCfarQuality();
+    OdsDemo_benchPeakGroupingEquivalence();
+    OdsDemo_benchSubBinAccuracy();
+    OdsDemo_benchCfarThrTable();
+
+    if (resultPath != NULL)
+    {
+        out = fopen(resultPath, "w");
+        if (out == NULL)
+        {
+            System_printf("Error: unable to write benchmark results to %s\n", resultPath);
+        }
+        else
+        {
+            fprintf(out, "# name,rangeBins,dopplerBins,rxAnt,txAnt,numObj,nsPerOp,cyclesPerOp,bytesPerOp,sqnrCdB\n");
+        }
+    }
+    if (baselinePath != NULL)
+    {
+        baseline = fopen(baselinePath, "r");
+        if (baseline == NULL)
+        {
+            System_printf("bench: no baseline %s, not comparing\n", baselinePath);
+        }
+    }
+
+    for (i = 0; i < gOdsBenchNumResults; i++)
+    {
+        result = &gOdsBenchResults[i];
+        System_printf("bench %s R%d D%d %dx%d N%d: %d ns/op %d cycles/op %d bytes/op\n",
+                      result->name, result->numRangeBins, result->numDopplerBins,
+                      result->numRxAntennas, result->numTxAntennas, result->numObj,
+                      result->nsPerOp, result->cyclesPerOp, result->bytesPerOp);
+        if (result->sqnrCdB != 0)
+        {
+            System_printf("bench %s R%d D%d %dx%d N%d: SQNR %d.%02d dB\n",
+                          result->name, result->numRangeBins, result->numDopplerBins,
+                          result->numRxAntennas, result->numTxAntennas, result->numObj,
+                          result->sqnrCdB / 100, abs(result->sqnrCdB % 100));
+        }
+        if (out != NULL)
+        {
+            fprintf(out, "%s,%u,%u,%u,%u,%u,%u,%u,%u,%d\n", result->name,
+                    (unsigned int)result->numRangeBins, (unsigned int)result->numDopplerBins,
+                    (unsigned int)result->numRxAntennas, (unsigned int)result->numTxAntennas,
+                    (unsigned int)result->numObj, (unsigned int)result->nsPerOp,
+                    (unsigned int)result->cyclesPerOp, (unsigned int)result->bytesPerOp,
+                    (int)result->sqnrCdB);
+        }
+        if (baseline != NULL)
+        {
+            numRegressions += OdsDemo_benchCompare(baseline, result);
+        }
+    }
+
+    if (out != NULL)
+    {
+        fclose(out);
+    }
+    if (baseline != NULL)
+    {
+        fclose(baseline);
+        System_printf("bench: %d regression(s) against %s\n", numRegressions, baselinePath);
+    }
+
+    retVal = (int32_t)numRegressions;
+    if ((resultPath != NULL) && (out == NULL))
+    {
+        retVal = -1;
+    }
+    return retVal;
+}
+
+const OdsDemo_benchResult *OdsDemo_benchGetResults(uint32_t *numResults)
+{
+    *numResults = gOdsBenchNumResults;
+    return gOdsBenchResults;
+}
+
+#endif /* ODS_BENCHMARK */
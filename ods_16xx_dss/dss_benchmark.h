@@ -0,0 +1,157 @@
+/**
+ *   @file  dss_benchmark.h
+ *
+ *   @brief
+ *      Per-stage microbenchmarks of the ODS signal chain.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_BENCHMARK_H
+#define DSS_BENCHMARK_H
+
+#include <stdint.h>
+#include "dss_data_path.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* If the following define is uncommented, the DSS init task runs the stage
+   benchmarks once after the data path has been initialized (and before any
+   configuration arrives from the MSS, since the benchmarks borrow the data
+   path L1/L2/L3 heaps). Results are printed and written to
+   ODS_BENCH_RESULT_FILE; if ODS_BENCH_BASELINE_FILE can be opened the results
+   are compared against it. Files are accessed through the debugger (CIO).
+   The EDMA fixtures use the data path EDMA instance, which is free until
+   the first configuration arrives. host/makefile builds the same benchmarks
+   as a 32-bit host program, with the EDMA modelled by dss_host_edma.c. */
+//#define ODS_BENCHMARK
+
+/*! @brief File the results are written to, a copy of it is a valid baseline */
+#define ODS_BENCH_RESULT_FILE           "ods_bench_result.csv"
+
+/*! @brief Baseline the results are compared against */
+#define ODS_BENCH_BASELINE_FILE         "ods_bench_baseline.csv"
+
+/*! @brief Number of timed iterations per sweep point */
+#define ODS_BENCH_NUM_ITER              32U
+
+/*! @brief Slow down (in percent) over the baseline reported as a regression */
+#define ODS_BENCH_REGRESSION_PCT        10U
+
+/*! @brief Maximum number of sweep points over all fixtures */
+#define ODS_BENCH_MAX_RESULTS           320U
+
+/*! @brief Maximum fixture name length including terminator */
+#define ODS_BENCH_NAME_LEN              24U
+
+/**
+ * @brief
+ *  Result of one fixture at one sweep point
+ *
+ * @details
+ *  One op is the unit of work the chain repeats: one chirp for the range
+ *  FFT and the DC range signature compensation, one range bin for the
+ *  Doppler processing, one CFAR line, one frame worth of peak grouping and
+ *  one detected object for the angle estimation. bytesPerOp counts the bytes
+ *  read and written by the kernels of the op, each buffer once per kernel
+ *  call.
+ */
+typedef struct OdsDemo_benchResult_t
+{
+    /*! @brief Fixture name */
+    char        name[ODS_BENCH_NAME_LEN];
+
+    /*! @brief Number of range bins of the sweep point */
+    uint16_t    numRangeBins;
+
+    /*! @brief Number of Doppler bins of the sweep point */
+    uint16_t    numDopplerBins;
+
+    /*! @brief Number of receive antennas of the sweep point */
+    uint8_t     numRxAntennas;
+
+    /*! @brief Number of transmit antennas of the sweep point */
+    uint8_t     numTxAntennas;
+
+    /*! @brief Number of CFAR detections fed to peak grouping */
+    uint16_t    numObj;
+
+    /*! @brief Average time per op in ns */
+    uint32_t    nsPerOp;
+
+    /*! @brief Average CPU cycles per op (0 if not available) */
+    uint32_t    cyclesPerOp;
+
+    /*! @brief Bytes touched per op */
+    uint32_t    bytesPerOp;
+
+    /*! @brief Signal to error ratio of the op output against a full
+               precision reference in 0.01 dB (0 if not measured) */
+    int32_t     sqnrCdB;
+} OdsDemo_benchResult;
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs every fixture over its sweep, reports the results and compares
+ *      them with a baseline.
+ *
+ *  @param[in]  context       Data path context whose EDMA handle the EDMA
+ *                            fixtures use, NULL to skip them
+ *  @param[in]  resultPath    File to write the results to, NULL to only print
+ *  @param[in]  baselinePath  Baseline to compare against, NULL to skip
+ *
+ *  @retval
+ *      Number of regressions against the baseline, -1 on error.
+ */
+int32_t OdsDemo_benchRun(OdsDemo_DSS_dataPathContext_t *context, const char *resultPath,
+                         const char *baselinePath);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the results of the last OdsDemo_benchRun.
+ *
+ *  @param[out] numResults  Number of valid results
+ *
+ *  @retval
+ *      Pointer to the result array.
+ */
+const OdsDemo_benchResult *OdsDemo_benchGetResults(uint32_t *numResults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSS_BENCHMARK_H */
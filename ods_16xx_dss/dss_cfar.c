@@ -0,0 +1,532 @@
+/**
+ *   @file  dss_cfar.c
+ *
+ *   @brief
+ *      CFAR detectors of the ODS data path that are not part of mmwavelib.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* On the C674x the intrinsics are compiler built-ins */
+#ifndef _TMS320C6X
+#include "dss_host_intrinsics.h"
+#endif
+
+#include "dss_cfar.h"
+
+/**************************************************************************
+ *************************** Local Definitions ****************************
+ **************************************************************************/
+
+/**
+ * @brief
+ *  Sliding order statistic
+ *
+ * @details
+ *  Histogram of the training cells with the bin the last search ended in and
+ *  the number of cells below it, so that the next search starts from there.
+ */
+typedef struct OdsDemo_cfarOsState_t
+{
+    /*! @brief Histogram, ODS_CFAR_OS_HIST_LEN */
+    uint16_t   *hist;
+
+    /*! @brief Bin of the last order statistic */
+    uint32_t    bin;
+
+    /*! @brief Number of cells in the bins below bin */
+    uint32_t    numBelow;
+} OdsDemo_cfarOsState;
+
+/*! @brief Number of cells whose thresholds are computed before they are compared */
+#define ODS_CFAR_OS_BLOCK_LEN   16U
+
+/*! @brief Threshold of a cell that can not be detected, the largest cell value */
+#define ODS_CFAR_OS_NO_DET      0xFFFF
+
+/**************************************************************************
+ *************************** Local Functions ******************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Adds a training cell to the histogram.
+ */
+static inline void OdsDemo_cfarOsAdd(OdsDemo_cfarOsState *state, uint16_t cell)
+{
+    uint32_t bin = (uint32_t) cell >> ODS_CFAR_OS_HIST_SHIFT;
+
+    state->hist[bin]++;
+    state->numBelow += (bin < state->bin);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Removes a training cell from the histogram.
+ */
+static inline void OdsDemo_cfarOsRemove(OdsDemo_cfarOsState *state, uint16_t cell)
+{
+    uint32_t bin = (uint32_t) cell >> ODS_CFAR_OS_HIST_SHIFT;
+
+    state->hist[bin]--;
+    state->numBelow -= (bin < state->bin);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Order statistic of the given rank (0 for the smallest cell), as the
+ *      centre of its bin. The search walks from the bin of the previous
+ *      call, which is close since the window only changed by a few cells.
+ *      rank must be below the number of cells in the histogram.
+ */
+static inline uint32_t OdsDemo_cfarOsSelect(OdsDemo_cfarOsState *state, uint32_t rank)
+{
+    while (state->numBelow > rank)
+    {
+        state->bin--;
+        state->numBelow -= state->hist[state->bin];
+    }
+    while ((state->numBelow + state->hist[state->bin]) <= rank)
+    {
+        state->numBelow += state->hist[state->bin];
+        state->bin++;
+    }
+    return (state->bin << ODS_CFAR_OS_HIST_SHIFT) + (1U << (ODS_CFAR_OS_HIST_SHIFT - 1U));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Rank of the order statistic among numCells training cells, numCells > 0.
+ */
+static inline uint32_t OdsDemo_cfarOsRank(uint32_t numCells)
+{
+    uint32_t k = (numCells * ODS_CFAR_OS_RANK_Q8) >> 8;
+
+    return (k > 0U) ? (k - 1U) : 0U;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Compares num cells of the line from base with their thresholds and
+ *      appends the indices of the cells above to out. The index is always
+ *      stored and the count only advanced on a detection, out[numDet] is
+ *      within the line since numDet does not exceed the cell index.
+ *
+ *  @retval
+ *      Number of detected cells
+ */
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+static inline uint32_t OdsDemo_cfarOsDetect(const uint16_t * restrict inp, const int32_t * restrict thr,
+                                            uint32_t base, uint32_t num, uint16_t * restrict out)
+{
+    uint32_t i = 0, mask, numDet = 0;
+
+    /* four cells a step, the mask holds one bit per detected cell */
+    for (; i + 4U <= num; i += 4U)
+    {
+        __m128i x = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *) &inp[base + i]));
+        __m128i t = _mm_loadu_si128((const __m128i *) &thr[i]);
+
+        mask = (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, t)));
+        out[numDet] = (uint16_t) (base + i);
+        numDet += mask & 1U;
+        out[numDet] = (uint16_t) (base + i + 1U);
+        numDet += (mask >> 1) & 1U;
+        out[numDet] = (uint16_t) (base + i + 2U);
+        numDet += (mask >> 2) & 1U;
+        out[numDet] = (uint16_t) (base + i + 3U);
+        numDet += mask >> 3;
+    }
+    for (; i < num; i++)
+    {
+        out[numDet] = (uint16_t) (base + i);
+        numDet += ((int32_t) inp[base + i] > thr[i]);
+    }
+    return numDet;
+}
+#else
+static inline uint32_t OdsDemo_cfarOsDetect(const uint16_t * restrict inp, const int32_t * restrict thr,
+                                            uint32_t base, uint32_t num, uint16_t * restrict out)
+{
+    uint32_t i, numDet = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        out[numDet] = (uint16_t) (base + i);
+        numDet += ((int32_t) inp[base + i] > thr[i]);
+    }
+    return numDet;
+}
+#endif
+
+/**************************************************************************
+ *************************** CFAR Functions *******************************
+ **************************************************************************/
+
+uint32_t OdsDemo_cfarOsWrap(const uint16_t * restrict inp, uint16_t * restrict out, uint32_t len,
+                            uint32_t const1, uint32_t guardLen, uint32_t noiseLen,
+                            uint16_t * restrict hist)
+{
+    OdsDemo_cfarOsState state;
+    int32_t  thr[ODS_CFAR_OS_BLOCK_LEN];
+    uint32_t span = guardLen + noiseLen;
+    uint32_t rank = OdsDemo_cfarOsRank(2U * noiseLen);
+    uint32_t idx, k, base, num, noise, numDet = 0;
+    uint32_t leftOut, leftIn, rightOut, rightIn;
+
+    if ((noiseLen == 0U) || (span >= len))
+    {
+        return 0;
+    }
+
+    state.hist     = hist;
+    state.bin      = 0;
+    state.numBelow = 0;
+
+    /* training cells of cell 0 */
+    for (k = guardLen + 1U; k <= span; k++)
+    {
+        OdsDemo_cfarOsAdd(&state, inp[len - k]);
+        OdsDemo_cfarOsAdd(&state, inp[k]);
+    }
+
+    /* cells leaving and entering the window on the move to the next cell */
+    leftOut  = len - span;
+    leftIn   = len - guardLen;
+    rightOut = guardLen + 1U;
+    rightIn  = span + 1U;
+    for (base = 0; base < len; base += num)
+    {
+        /* the order statistic walk is serial, the comparison is done a
+         * block at a time; thresholds above the largest cell are clamped */
+        num = ((len - base) < ODS_CFAR_OS_BLOCK_LEN) ? (len - base) : ODS_CFAR_OS_BLOCK_LEN;
+        for (idx = 0; idx < num; idx++)
+        {
+            noise = OdsDemo_cfarOsSelect(&state, rank) + const1;
+            thr[idx] = (int32_t) ((noise < (uint32_t) ODS_CFAR_OS_NO_DET) ? noise : (uint32_t) ODS_CFAR_OS_NO_DET);
+
+            leftIn   = (leftIn   == len) ? 0U : leftIn;
+            rightOut = (rightOut == len) ? 0U : rightOut;
+            rightIn  = (rightIn  == len) ? 0U : rightIn;
+            OdsDemo_cfarOsRemove(&state, inp[leftOut]);
+            OdsDemo_cfarOsAdd(&state, inp[leftIn]);
+            OdsDemo_cfarOsRemove(&state, inp[rightOut]);
+            OdsDemo_cfarOsAdd(&state, inp[rightIn]);
+            leftOut  = (leftOut  == len - 1U) ? 0U : (leftOut + 1U);
+            leftIn++;
+            rightOut++;
+            rightIn++;
+        }
+        numDet += OdsDemo_cfarOsDetect(inp, thr, base, num, &out[numDet]);
+    }
+
+    /* the window is back to the one of cell 0 */
+    for (k = guardLen + 1U; k <= span; k++)
+    {
+        OdsDemo_cfarOsRemove(&state, inp[len - k]);
+        OdsDemo_cfarOsRemove(&state, inp[k]);
+    }
+    return numDet;
+}
+
+uint32_t OdsDemo_cfarOs(const uint16_t * restrict inp, uint16_t * restrict out, uint32_t len,
+                        uint32_t const1, const int16_t * restrict thrOffs,
+                        uint32_t guardLen, uint32_t noiseLen, uint16_t * restrict hist)
+{
+    OdsDemo_cfarOsState state;
+    int32_t  span = (int32_t) (guardLen + noiseLen);
+    int32_t  guard = (int32_t) guardLen;
+    int32_t  n = (int32_t) len;
+    int32_t  thr[ODS_CFAR_OS_BLOCK_LEN];
+    int32_t  base, num, idx, k, noise;
+    uint32_t numCells = 0, numDet = 0;
+
+    if (noiseLen == 0U)
+    {
+        return 0;
+    }
+
+    state.hist     = hist;
+    state.bin      = 0;
+    state.numBelow = 0;
+
+    /* training cells of cell 0, on the right only */
+    for (k = guard + 1; (k <= span) && (k < n); k++)
+    {
+        OdsDemo_cfarOsAdd(&state, inp[k]);
+        numCells++;
+    }
+
+    for (base = 0; base < n; base += num)
+    {
+        /* the order statistic walk is serial, the comparison is done a block at a time */
+        num = ((n - base) < (int32_t) ODS_CFAR_OS_BLOCK_LEN) ? (n - base) : (int32_t) ODS_CFAR_OS_BLOCK_LEN;
+        for (idx = base; idx < base + num; idx++)
+        {
+            noise = ODS_CFAR_OS_NO_DET;
+            if (numCells > 0U)
+            {
+                noise = (int32_t) OdsDemo_cfarOsSelect(&state, OdsDemo_cfarOsRank(numCells)) +
+                        (int32_t) const1 + ((thrOffs != NULL) ? thrOffs[idx] : 0);
+            }
+            thr[idx - base] = noise;
+
+            /* move the window to the next cell */
+            if (idx - span >= 0)
+            {
+                OdsDemo_cfarOsRemove(&state, inp[idx - span]);
+                numCells--;
+            }
+            if (idx - guard >= 0)
+            {
+                OdsDemo_cfarOsAdd(&state, inp[idx - guard]);
+                numCells++;
+            }
+            if (idx + guard + 1 < n)
+            {
+                OdsDemo_cfarOsRemove(&state, inp[idx + guard + 1]);
+                numCells--;
+            }
+            if (idx + span + 1 < n)
+            {
+                OdsDemo_cfarOsAdd(&state, inp[idx + span + 1]);
+                numCells++;
+            }
+        }
+        numDet += OdsDemo_cfarOsDetect(inp, thr, (uint32_t) base, (uint32_t) num, &out[numDet]);
+    }
+
+    /* training cells of cell len, on the left only */
+    for (k = guard + 1; k <= span; k++)
+    {
+        if (n - k >= 0)
+        {
+            OdsDemo_cfarOsRemove(&state, inp[n - k]);
+        }
+    }
+    return numDet;
+}
+
+uint32_t OdsDemo_cfarCaSogo(const uint16_t * restrict inp, uint16_t * restrict out, uint32_t len,
+                            uint32_t cfarType, uint32_t const1, const int16_t * restrict thrOffs,
+                            uint32_t const2, uint32_t guardLen, uint32_t noiseLen)
+{
+    int32_t  span = (int32_t) (guardLen + noiseLen);
+    int32_t  guard = (int32_t) guardLen;
+    int32_t  n = (int32_t) len;
+    int32_t  idx, k;
+    uint32_t sumLeft = 0, sumRight = 0, left, right, noise, numDet = 0;
+
+    /* training cells of cell 0, on the right only */
+    for (k = guard + 1; (k <= span) && (k < n); k++)
+    {
+        sumRight += inp[k];
+    }
+
+    for (idx = 0; idx < n; idx++)
+    {
+        /* a side counts once all its training cells are on the line */
+        left  = (idx >= span) ? sumLeft : 0U;
+        right = (idx + span < n) ? sumRight : 0U;
+        left  = (idx >= span) ? left : right;
+        right = (idx + span < n) ? right : left;
+
+        if (cfarType == ODS_CFAR_CAGO)
+        {
+            noise = 2U * ((left > right) ? left : right);
+        }
+        else if (cfarType == ODS_CFAR_CASO)
+        {
+            noise = 2U * ((left < right) ? left : right);
+        }
+        else
+        {
+            noise = left + right;
+        }
+
+        if ((int32_t) inp[idx] > (int32_t) ((noise >> const2) + const1) + thrOffs[idx])
+        {
+            out[numDet++] = (uint16_t) idx;
+        }
+
+        /* move the window to the next cell */
+        if (idx - span >= 0)
+        {
+            sumLeft -= inp[idx - span];
+        }
+        if (idx - guard >= 0)
+        {
+            sumLeft += inp[idx - guard];
+        }
+        if (idx + guard + 1 < n)
+        {
+            sumRight -= inp[idx + guard + 1];
+        }
+        if (idx + span + 1 < n)
+        {
+            sumRight += inp[idx + span + 1];
+        }
+    }
+    return numDet;
+}
+
+void OdsDemo_cfarThrTableExpand(const uint16_t *pointIdx, const int16_t *pointOffs,
+                                uint32_t numPoints, int16_t * restrict table, uint32_t len)
+{
+    uint32_t idx, p = 0;
+    int32_t  num, den;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        if (numPoints == 0U)
+        {
+            table[idx] = 0;
+            continue;
+        }
+        while ((p + 1U < numPoints) && (idx >= pointIdx[p + 1U]))
+        {
+            p++;
+        }
+        if ((idx <= pointIdx[p]) || (p + 1U == numPoints))
+        {
+            table[idx] = pointOffs[p];
+        }
+        else
+        {
+            /* rounded to the nearest, halves away from zero */
+            num = ((int32_t) pointOffs[p + 1U] - pointOffs[p]) * (int32_t) (idx - pointIdx[p]);
+            den = (int32_t) pointIdx[p + 1U] - pointIdx[p];
+            num = (num >= 0) ? ((2 * num + den) / (2 * den)) : -((den - 2 * num) / (2 * den));
+            table[idx] = (int16_t) (pointOffs[p] + num);
+        }
+    }
+}
+
+void OdsDemo_cfarCa2DBuildSat(const uint16_t * restrict detMatrix, uint32_t numRangeBins,
+                              uint32_t numDopplerBins, uint32_t dopplerPad, uint32_t * restrict sat)
+{
+    uint32_t width = numDopplerBins + 2U * dopplerPad + 1U;
+    uint32_t rangeIdx, col, dopplerIdx, rowSum;
+    uint32_t firstDopplerIdx = (numDopplerBins - (dopplerPad % numDopplerBins)) % numDopplerBins;
+    const uint16_t *row;
+    const uint32_t *satPrev;
+    uint32_t *satRow;
+
+    for (col = 0; col < width; col++)
+    {
+        sat[col] = 0;
+    }
+
+    for (rangeIdx = 0; rangeIdx < numRangeBins; rangeIdx++)
+    {
+        row     = &detMatrix[rangeIdx * numDopplerBins];
+        satPrev = &sat[rangeIdx * width];
+        satRow  = &sat[(rangeIdx + 1U) * width];
+
+        satRow[0]  = 0;
+        rowSum     = 0;
+        dopplerIdx = firstDopplerIdx;
+        for (col = 1; col < width; col++)
+        {
+            rowSum += row[dopplerIdx];
+            satRow[col] = satPrev[col] + rowSum;
+            dopplerIdx = (dopplerIdx == numDopplerBins - 1U) ? 0U : (dopplerIdx + 1U);
+        }
+    }
+}
+
+uint32_t OdsDemo_cfarCa2DLine(const uint16_t * restrict detMatrix, const uint32_t * restrict sat,
+                              uint32_t numRangeBins, uint32_t numDopplerBins,
+                              uint32_t dopplerPad, uint32_t dopplerIdx,
+                              const OdsDemo_cfarCa2DCfg *cfg, uint16_t * restrict out)
+{
+    uint32_t width = numDopplerBins + 2U * dopplerPad + 1U;
+    uint32_t spanRange = (uint32_t) cfg->guardLenRange + cfg->noiseLenRange;
+    uint32_t spanDoppler = (uint32_t) cfg->guardLenDoppler + cfg->noiseLenDoppler;
+    uint32_t guardRange = cfg->guardLenRange;
+    uint32_t threshold = cfg->threshold;
+    uint32_t outerCols = 2U * spanDoppler + 1U;
+    uint32_t guardCols = 2U * cfg->guardLenDoppler + 1U;
+    /* columns of the window in the padded table, the cell is at dopplerIdx + dopplerPad */
+    uint32_t outerLeft  = dopplerIdx + dopplerPad - spanDoppler;
+    uint32_t outerRight = outerLeft + outerCols;
+    uint32_t guardLeft  = dopplerIdx + dopplerPad - cfg->guardLenDoppler;
+    uint32_t guardRight = guardLeft + guardCols;
+    uint32_t rangeIdx, outerTop, outerBottom, guardTop, guardBottom;
+    uint32_t sum, numCells, cell, numDet = 0;
+    int32_t  thr;
+    const uint32_t *t0, *t1, *g0, *g1;
+
+    for (rangeIdx = 0; rangeIdx < numRangeBins; rangeIdx++)
+    {
+        outerTop    = (rangeIdx > spanRange) ? (rangeIdx - spanRange) : 0U;
+        outerBottom = (rangeIdx + spanRange + 1U < numRangeBins) ? (rangeIdx + spanRange + 1U) : numRangeBins;
+        guardTop    = (rangeIdx > guardRange) ? (rangeIdx - guardRange) : 0U;
+        guardBottom = (rangeIdx + guardRange + 1U < numRangeBins) ? (rangeIdx + guardRange + 1U) : numRangeBins;
+
+        t0 = &sat[outerTop * width];
+        t1 = &sat[outerBottom * width];
+        g0 = &sat[guardTop * width];
+        g1 = &sat[guardBottom * width];
+        sum = (t1[outerRight] - t1[outerLeft] - t0[outerRight] + t0[outerLeft]) -
+              (g1[guardRight] - g1[guardLeft] - g0[guardRight] + g0[guardLeft]);
+        numCells = (outerBottom - outerTop) * outerCols - (guardBottom - guardTop) * guardCols;
+
+        if (cfg->rangeThrOffs != NULL)
+        {
+            thr = (int32_t) cfg->threshold + cfg->rangeThrOffs[rangeIdx];
+            threshold = (thr > 0) ? (uint32_t) thr : 0U;
+        }
+
+        /* cell > sum / numCells + threshold, without the division */
+        cell = detMatrix[rangeIdx * numDopplerBins + dopplerIdx];
+        if ((numCells > 0U) && (cell > threshold) && ((cell - threshold) * numCells > sum))
+        {
+            out[numDet++] = (uint16_t) rangeIdx;
+        }
+    }
+    return numDet;
+}
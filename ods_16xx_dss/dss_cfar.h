@@ -0,0 +1,265 @@
+/**
+ *   @file  dss_cfar.h
+ *
+ *   @brief
+ *      CFAR detectors of the ODS data path that are not part of mmwavelib.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_CFAR_H
+#define DSS_CFAR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Right shift from a log2 magnitude sample to its bin in the order
+           statistic histogram. A bin is 1/16 of a log2 unit (0.38 dB) of the
+           antenna average for 4 virtual antennas, 1/32 (0.19 dB) for 8 */
+#define ODS_CFAR_OS_HIST_SHIFT  6U
+
+/*! @brief Number of bins of the order statistic histogram, covering the
+           16-bit log2 magnitude range */
+#define ODS_CFAR_OS_HIST_LEN    (0x10000U >> ODS_CFAR_OS_HIST_SHIFT)
+
+/*! @brief Rank of the order statistic as a fraction of the training cells in
+           Q8, 3/4 is the usual choice for a few interfering targets in the
+           window */
+#define ODS_CFAR_OS_RANK_Q8     192U
+
+/*! @brief Noise averages of @ref OdsDemo_cfarCaSogo, the values of the
+           mmwavelib CFAR types */
+#define ODS_CFAR_CA             0U
+#define ODS_CFAR_CAGO           1U
+#define ODS_CFAR_CASO           2U
+
+/**
+ *  @b Description
+ *  @n
+ *      Ordered statistic CFAR with cyclic wrap, the OS counterpart of
+ *      mmwavelib_cfarCadBwrap. The noise estimate of a cell is the training
+ *      cell of rank ODS_CFAR_OS_RANK_Q8 of the noiseLen cells on either side
+ *      of the guard cells, so a few strong cells in the window (other
+ *      targets) do not raise the threshold as they do with cell averaging.
+ *
+ *      The order statistic is kept in a histogram of the training cells that
+ *      is updated by four cells when the window slides and searched from the
+ *      bin of the previous cell, so the cost per cell does not depend on the
+ *      window length. The estimate is the centre of its histogram bin,
+ *      within 2^(ODS_CFAR_OS_HIST_SHIFT - 1) of the exact order statistic.
+ *
+ *  @param[in]     inp       Input line (log2 magnitude)
+ *  @param[out]    out       Indices of the detected cells
+ *  @param[in]     len       Number of cells
+ *  @param[in]     const1    Detection threshold added to the noise estimate
+ *  @param[in]     guardLen  One sided number of guard cells
+ *  @param[in]     noiseLen  One sided number of training cells,
+ *                           guardLen + noiseLen < len
+ *  @param[in,out] hist      Histogram, ODS_CFAR_OS_HIST_LEN, must be all zero
+ *                           and is all zero on return
+ *
+ *  @retval
+ *      Number of detected cells
+ */
+uint32_t OdsDemo_cfarOsWrap(const uint16_t *inp, uint16_t *out, uint32_t len,
+                            uint32_t const1, uint32_t guardLen, uint32_t noiseLen,
+                            uint16_t *hist);
+
+/**
+ *  @b Description
+ *  @n
+ *      Ordered statistic CFAR without wrap, the OS counterpart of
+ *      mmwavelib_cfarCadB_SOGO. Near the edges the training cells beyond the
+ *      line are left out and the rank is taken of the cells that remain.
+ *      Otherwise as @ref OdsDemo_cfarOsWrap, with an optional threshold
+ *      offset per cell.
+ *
+ *  @param[in]     inp       Input line (log2 magnitude)
+ *  @param[out]    out       Indices of the detected cells
+ *  @param[in]     len       Number of cells
+ *  @param[in]     const1    Detection threshold added to the noise estimate
+ *  @param[in]     thrOffs   Threshold offset of every cell added to const1,
+ *                           NULL for none
+ *  @param[in]     guardLen  One sided number of guard cells
+ *  @param[in]     noiseLen  One sided number of training cells
+ *  @param[in,out] hist      Histogram, ODS_CFAR_OS_HIST_LEN, must be all zero
+ *                           and is all zero on return
+ *
+ *  @retval
+ *      Number of detected cells
+ */
+uint32_t OdsDemo_cfarOs(const uint16_t *inp, uint16_t *out, uint32_t len,
+                        uint32_t const1, const int16_t *thrOffs,
+                        uint32_t guardLen, uint32_t noiseLen, uint16_t *hist);
+
+/**
+ *  @b Description
+ *  @n
+ *      Cell averaging CFAR without wrap with a threshold offset per cell,
+ *      otherwise the same detections as mmwavelib_cfarCadB_SOGO: the noise
+ *      estimate is the sum of the noiseLen training cells on either side
+ *      (the larger or smaller side twice for CAGO and CASO) shifted right
+ *      by const2, and near the edges the side that is available counts
+ *      twice. The two sums slide along the line, two cells in and two out
+ *      per cell.
+ *
+ *  @param[in]  inp       Input line (log2 magnitude)
+ *  @param[out] out       Indices of the detected cells
+ *  @param[in]  len       Number of cells
+ *  @param[in]  cfarType  ODS_CFAR_CA, ODS_CFAR_CAGO or ODS_CFAR_CASO
+ *  @param[in]  const1    Detection threshold added to the noise estimate
+ *  @param[in]  thrOffs   Threshold offset of every cell added to const1
+ *  @param[in]  const2    Right shift of the training cell sum,
+ *                        log2(2 * noiseLen)
+ *  @param[in]  guardLen  One sided number of guard cells
+ *  @param[in]  noiseLen  One sided number of training cells
+ *
+ *  @retval
+ *      Number of detected cells
+ */
+uint32_t OdsDemo_cfarCaSogo(const uint16_t *inp, uint16_t *out, uint32_t len,
+                            uint32_t cfarType, uint32_t const1, const int16_t *thrOffs,
+                            uint32_t const2, uint32_t guardLen, uint32_t noiseLen);
+
+/**
+ *  @b Description
+ *  @n
+ *      Expands a piecewise linear threshold offset into one offset per
+ *      range bin. The offset is interpolated between the points, rounded to
+ *      the nearest integer, and held before the first and after the last
+ *      point.
+ *
+ *  @param[in]  pointIdx   Range bins of the points, increasing
+ *  @param[in]  pointOffs  Offsets at the points
+ *  @param[in]  numPoints  Number of points, 0 for an all zero table
+ *  @param[out] table      Offset per range bin
+ *  @param[in]  len        Number of range bins
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_cfarThrTableExpand(const uint16_t *pointIdx, const int16_t *pointOffs,
+                                uint32_t numPoints, int16_t *table, uint32_t len);
+
+/**
+ * @brief
+ *  Window of the two dimensional CA-CFAR
+ *
+ * @details
+ *  The training cells of a cell are the rectangle of noiseLen + guardLen
+ *  cells on either side in range and Doppler around it, without the guard
+ *  rectangle of guardLen cells on either side, which includes the cell.
+ */
+typedef struct OdsDemo_cfarCa2DCfg_t
+{
+    /*! @brief One sided number of guard cells along range */
+    uint8_t     guardLenRange;
+
+    /*! @brief One sided number of training cells along range */
+    uint8_t     noiseLenRange;
+
+    /*! @brief One sided number of guard cells along Doppler */
+    uint8_t     guardLenDoppler;
+
+    /*! @brief One sided number of training cells along Doppler */
+    uint8_t     noiseLenDoppler;
+
+    /*! @brief Detection threshold added to the noise estimate */
+    uint16_t    threshold;
+
+    /*! @brief Threshold offset of every range bin added to threshold, NULL
+               for none */
+    const int16_t *rangeThrOffs;
+} OdsDemo_cfarCa2DCfg;
+
+/*! @brief Number of entries of the summed area table of @ref OdsDemo_cfarCa2DBuildSat */
+#define ODS_CFAR_2D_SAT_LEN(numRangeBins, numDopplerBins, dopplerPad) \
+    (((numRangeBins) + 1U) * ((numDopplerBins) + 2U * (dopplerPad) + 1U))
+
+/**
+ *  @b Description
+ *  @n
+ *      Builds the summed area table of the detection matrix for
+ *      @ref OdsDemo_cfarCa2DLine. Entry (r, c) is the sum of the cells of the
+ *      range bins below r and the Doppler columns below c of the matrix
+ *      extended by dopplerPad cyclically wrapped Doppler bins on either side,
+ *      so that the sum over any rectangle of the matrix is four look-ups.
+ *      The sums are modulo 2^32, which keeps the rectangle sums exact.
+ *
+ *  @param[in]  detMatrix       Detection matrix, numDopplerBins per range bin
+ *  @param[in]  numRangeBins    Number of range bins
+ *  @param[in]  numDopplerBins  Number of Doppler bins
+ *  @param[in]  dopplerPad      Largest one sided Doppler window (guard plus
+ *                              training cells) the table is used with
+ *  @param[out] sat             Summed area table, ODS_CFAR_2D_SAT_LEN entries
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_cfarCa2DBuildSat(const uint16_t *detMatrix, uint32_t numRangeBins,
+                              uint32_t numDopplerBins, uint32_t dopplerPad, uint32_t *sat);
+
+/**
+ *  @b Description
+ *  @n
+ *      Two dimensional cell averaging CFAR of the cells of one Doppler bin,
+ *      with the training window evaluated from the summed area table in
+ *      constant time per cell. The window wraps along Doppler. Along range
+ *      the training cells beyond the matrix are left out, and the noise
+ *      estimate is the mean of the training cells that remain.
+ *
+ *  @param[in]  detMatrix       Detection matrix, numDopplerBins per range bin
+ *  @param[in]  sat             Summed area table from @ref OdsDemo_cfarCa2DBuildSat
+ *  @param[in]  numRangeBins    Number of range bins
+ *  @param[in]  numDopplerBins  Number of Doppler bins
+ *  @param[in]  dopplerPad      dopplerPad of the summed area table, at least
+ *                              guardLenDoppler + noiseLenDoppler
+ *  @param[in]  dopplerIdx      Doppler bin
+ *  @param[in]  cfg             Window and threshold
+ *  @param[out] out             Range indices of the detected cells
+ *
+ *  @retval
+ *      Number of detected cells
+ */
+uint32_t OdsDemo_cfarCa2DLine(const uint16_t *detMatrix, const uint32_t *sat,
+                              uint32_t numRangeBins, uint32_t numDopplerBins,
+                              uint32_t dopplerPad, uint32_t dopplerIdx,
+                              const OdsDemo_cfarCa2DCfg *cfg, uint16_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSS_CFAR_H */
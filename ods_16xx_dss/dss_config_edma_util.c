@@ -186,7 +186,7 @@ int32_t EDMAutil_configType2a(EDMA_Handle handle,
     config.paramSetConfig.destinationBindex = (int16_t)(numDopplerBins * numTxAnt * numRxAnt * sampleLenInBytes);
 
     config.paramSetConfig.sourceCindex = (int16_t)(numRangeBins * sampleLenInBytes);
-    config.paramSetConfig.destinationCindex = (int16_t)(numDopplerBins * sampleLenInBytes);
+    config.paramSetConfig.destinationCindex = (int16_t)(numDopplerBins * numTxAnt * sampleLenInBytes);
 
     config.paramSetConfig.linkAddress = EDMA_NULL_LINK_ADDRESS;
     config.paramSetConfig.transferType = (uint8_t)EDMA3_SYNC_AB;
@@ -117,9 +117,11 @@ int32_t EDMAutil_configType1(EDMA_Handle handle,
  *     between subsequent complex samples. The EDMA can be configured for multiple
  *     such transfers, so that subsequent initiations of the EDMA channel, initiate
  *     these subsequent transfers. The number of such multiple transfers is
- *     defined by Ccnt. For subsequent transfers the start pointer of the
- *     destination buffer increments by one sample (sampleLenInBytes).
- *     The source buffer remains the same across subsequent transfers.
+ *     defined by Ccnt, one per Rx antenna. For subsequent Rx antennas the start
+ *     pointer of the destination buffer increments by numTxAnt Doppler vectors,
+ *     so that the vectors of the Tx antennas interleave. The transfers of all Rx
+ *     antennas are chained to one trigger; the destination of the next chirp
+ *     (one sample further) is set before it is triggered.
  *     Note that the EDMA is programmed as an "AB-Synchronized transfer".
  *
  *     The ParamSet (parameter set) into which the EDMA is programmed is the same
@@ -78,6 +78,7 @@
 #include <ti/drivers/soc/soc.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h>
 
+#ifdef _TMS320C6X
 #include <ti/alg/mmwavelib/mmwavelib.h>
 
 /* C64P dsplib (fixed point part for C674X) */
@@ -93,15 +94,22 @@
 #pragma diag_suppress 48
 #include <ti/mathlib/mathlib.h>
 #pragma diag_pop
+#else
+/* Off-target build: intrinsics, mathlib, dsplib and mmwavelib are provided
+ * by portable C versions, see dss_host_intrinsics.h and dss_host_kernels.h.
+ * The library stand-ins are not bit exact, see dss_host_kernels.h */
+#include "dss_host_intrinsics.h"
+#include "dss_host_kernels.h"
+#endif
 
 #include "dss_ods.h"
 #include "dss_data_path.h"
+#include "dss_range_fft.h"
+#include "dss_cfar.h"
 #include "dss_config_edma_util.h"
 #include "dss_resources.h"
 #include <ti/demo/utils/rx_ch_bias_measure.h>
 
-#define ODS_NUM_ANGLE_BINS 64
-
 /** @brief Lookup table for Twiddle table generation and DFT single bin DFT calculation.
  * It contains 256 complex exponentials e(k) = cos(2*pi*k/1024)+j*sin(2*pi*k/1024), k=0,...,255,
  * Imaginary values are in even, and real values are in odd locations. Values are in Q31 format,
@@ -424,22 +432,18 @@ int32_t OdsDemo_gen_twiddle_fft16x16_fast(short *w, int32_t n)
 
 #define MMW_ADCBUF_SIZE     0x4000U
 
-/*! @brief L2 heap used for allocating buffers in L2 SRAM,
-    mostly scratch buffers */
-#define MMW_L2_HEAP_SIZE    0x6000U
-
-/*! @brief L1 heap used for allocating buffers in L1D SRAM,
-    mostly scratch buffers */
-#define MMW_L1_HEAP_SIZE    0x4000U
-
-#define DOA_2D_STORAGE_SIZE (ODS_NUM_ANGLE_BINS*ODS_NUM_ANGLE_BINS*sizeof(cmplx32ReIm_t))
-#define L3_HEAP_SIZE        (SOC_XWR16XX_DSS_L3RAM_SIZE - DOA_2D_STORAGE_SIZE)
-
 /*! L3 RAM buffer */
 #pragma DATA_SECTION(gOdsL3, ".l3data");
 #pragma DATA_ALIGN(gOdsL3, 8);
 uint8_t gOdsL3[L3_HEAP_SIZE];
 
+/*! Static clutter maps are kept across frames and therefore not overlaid between
+    sub-frames, they are stacked from the top of gOdsL3 in sub-frame order.
+    Start of the lowest map and end of the overlaid L3 buffers of all sub-frames
+    configured so far */
+static uint32_t gOdsL3ClutterMapStart;
+static uint32_t gOdsL3OverlayEnd;
+
 /*! DOA-2A storage buffer */
 #pragma DATA_SECTION(DOA_2D_storage, ".l3data");
 cmplx32ReIm_t DOA_2D_storage[ODS_NUM_ANGLE_BINS][ODS_NUM_ANGLE_BINS];
@@ -472,6 +476,11 @@ uint8_t gMmwL1[MMW_L1_HEAP_SIZE];
  * point DFT, otherwise FFT function from DSP lib*/
 #define MMW_USE_SINGLE_POINT_DFT
 
+/*! If ODS_USE_FUSED_RANGE_FFT is defined the range FFT windows the ADC samples
+ * and zero pads them inside the FFT (OdsDemo_rangeFftWin16x16) when its scratch
+ * fits in L1, otherwise windowing, zero padding and FFT from DSP lib run in turn */
+#define ODS_USE_FUSED_RANGE_FFT
+
 void OdsDemo_genWindow(void *win,
                         uint32_t windowDatumType,
                         uint32_t winLen,
@@ -503,6 +512,7 @@ void OdsDemo_resetDopplerLines(OdsDemo_1D_DopplerLines_t * ths)
 {
     memset((void *) ths->dopplerLineMask, 0 , ths->dopplerLineMaskLen * sizeof(uint32_t));
     ths->currentIndex = 0;
+    ths->currentBits = 0;
 }
 
 /**
@@ -520,6 +530,66 @@ void OdsDemo_setDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t dopplerInd
     ths->dopplerLineMask[word] |= (0x1 << bit);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      ORs a set of line bits into one word of the Doppler line bit mask.
+ *
+ *  @retval
+ *      Number of lines that were not active before
+ */
+static inline uint32_t OdsDemo_orDopplerLineWord(OdsDemo_1D_DopplerLines_t * ths,
+                                                 uint32_t word, uint32_t bits)
+{
+    uint32_t newBits = bits & ~ths->dopplerLineMask[word];
+
+    ths->dopplerLineMask[word] |= bits;
+    /* population count: bit count per byte, summed by a dot product */
+    return _dotpu4(_bitc4(newBits), 0x01010101U);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sets the bits of a list of Doppler lines in the Doppler line bit mask,
+ *      typically the output of the CFAR in Doppler direction of one range bin.
+ *      The bits of consecutive indices falling in the same mask word are
+ *      gathered in a register and ORed into the mask at once, so sorted
+ *      indices cost one mask read and write per word instead of a test and a
+ *      set per index. Indices in any order give the same result.
+ *      @sa OdsDemo_resetDopplerLines
+ *
+ *  @param[in,out] ths          Active Doppler lines
+ *  @param[in]     dopplerIndex Doppler indices
+ *  @param[in]     num          Number of indices
+ *
+ *  @retval
+ *      Number of Doppler lines that were not active before the call
+ */
+uint32_t OdsDemo_setDopplerLines(OdsDemo_1D_DopplerLines_t * ths, const uint16_t *dopplerIndex,
+                                 uint32_t num)
+{
+    uint32_t idx, word;
+    uint32_t curWord = 0;
+    uint32_t bits = 0;
+    uint32_t numNew = 0;
+
+    for (idx = 0; idx < num; idx++)
+    {
+        word = dopplerIndex[idx] >> 5;
+        if (word != curWord)
+        {
+            numNew += OdsDemo_orDopplerLineWord(ths, curWord, bits);
+            curWord = word;
+            bits = 0;
+        }
+        bits |= 1U << (dopplerIndex[idx] & 31U);
+    }
+    numNew += OdsDemo_orDopplerLineWord(ths, curWord, bits);
+
+    return numNew;
+}
+
 /**
  *  @b Description
  *  @n
@@ -530,19 +600,10 @@ void OdsDemo_setDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t dopplerInd
  */
 uint32_t OdsDemo_isSetDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t index)
 {
-    uint32_t dopplerLineStat;
     uint32_t word = index >> 5;
     uint32_t bit = index & 31;
 
-    if(ths->dopplerLineMask[word] & (0x1 << bit))
-    {
-        dopplerLineStat = 1;
-    }
-    else
-    {
-        dopplerLineStat = 0;
-    }
-    return dopplerLineStat;
+    return (ths->dopplerLineMask[word] >> bit) & 0x1;
 }
 
 /**
@@ -550,30 +611,45 @@ uint32_t OdsDemo_isSetDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t inde
  *  @n
  *      Gets the Doppler index from the Doppler line bit mask, starting from the
  *      smallest active Doppler lin (bin). Subsequent calls return the next
- *      active Doppler line. @sa OdsDemo_resetDopplerLines
+ *      active Doppler line. The mask must not change between a reset and the
+ *      last call. @sa OdsDemo_resetDopplerLines
+ *
+ *      Inactive lines are skipped a mask word at a time and the active line
+ *      is located in its word with a leftmost bit detection on the isolated
+ *      lowest set bit, so the cost does not depend on the distance to the
+ *      previous active line.
  *
  */
 int32_t OdsDemo_getDopplerLine(OdsDemo_1D_DopplerLines_t * ths)
 {
-    uint32_t index = ths->currentIndex;
-    uint32_t word = index >> 5;
-    uint32_t bit = index & 31;
+    uint32_t word = ths->currentIndex;
+    uint32_t bits = ths->currentBits;
+    uint32_t index;
 
-    while (((ths->dopplerLineMask[word] >> bit) & 0x1) == 0)
+    while (bits == 0)
     {
-        index++;
-        bit++;
-        if (bit == 32)
+        if (word >= ths->dopplerLineMaskLen)
+        {
+            OdsDemo_dssAssert(0);
+        }
+        bits = ths->dopplerLineMask[word];
+        if (bits == 0)
         {
             word++;
-            bit = 0;
-            if (word >= ths->dopplerLineMaskLen)
-            {
-                OdsDemo_dssAssert(0);
-            }
         }
     }
-    ths->currentIndex = index + 1;
+
+    /* bits & -bits keeps the lowest set bit only */
+    index = (word << 5) + 31 - _lmbd(1, bits & (0U - bits));
+
+    /* clear it, moving to the next word once the last one is returned */
+    bits &= bits - 1;
+    if (bits == 0)
+    {
+        word++;
+    }
+    ths->currentBits = bits;
+    ths->currentIndex = word;
     return index;
 }
 
@@ -593,6 +669,107 @@ uint32_t OdsDemo_pow2roundup (uint32_t x)
     return result;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Offset of the vertex of the parabola through three equally spaced
+ *      points at -1, 0 and +1, MmwDemo_quadFit in closed form. Returns 0 if
+ *      the parabola has no maximum, and limits the offset to +/- half a bin.
+ *
+ *  @param[in]  yPrev   Value at -1
+ *  @param[in]  yPeak   Value at 0
+ *  @param[in]  yNext   Value at +1
+ *
+ *  @retval
+ *      Fractional offset of the peak
+ */
+static float OdsDemo_quadFitPeakOffset(float yPrev, float yPeak, float yNext)
+{
+    float curv = yPrev - 2.0f * yPeak + yNext;
+    float offset;
+
+    if (curv >= 0)
+    {
+        return 0;
+    }
+    offset = 0.5f * (yPrev - yNext) / curv;
+
+    return MAX(MIN(offset, 0.5f), -0.5f);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Refines the range and Doppler indices of the detected objects to a
+ *      fraction of a bin with a parabola through the detection matrix at the
+ *      object and at its two neighbours in each dimension. The detection
+ *      matrix is a log2 magnitude, so this fits a Gaussian to the window main
+ *      lobe, which is closer to its shape than a parabola in linear scale.
+ *      The detection matrix cells are read in place from L3, three per
+ *      dimension and object.
+ *
+ *  @param[in,out] obj  Pointer to data path object, detObj2D in, detObjSubBin out
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_detObjSubBinInterp(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint16_t *detMatrix = obj->detMatrix;
+    uint32_t numDopplerBins = obj->numDopplerBins;
+    uint32_t numRangeBins = obj->numRangeBins;
+    uint32_t i, rangeIdx, dopplerIdx;
+    uint16_t *cell;
+    float offset;
+
+    for (i = 0; i < obj->numDetObj; i++)
+    {
+        rangeIdx = obj->detObj2D[i].rangeIdx;
+        dopplerIdx = DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[i].dopplerIdx, numDopplerBins);
+        cell = &detMatrix[rangeIdx * numDopplerBins + dopplerIdx];
+
+        offset = OdsDemo_quadFitPeakOffset((float) detMatrix[rangeIdx * numDopplerBins +
+                                                             ((dopplerIdx - 1) & (numDopplerBins - 1))],
+                                           (float) cell[0],
+                                           (float) detMatrix[rangeIdx * numDopplerBins +
+                                                             ((dopplerIdx + 1) & (numDopplerBins - 1))]);
+        obj->detObjSubBin[i].dopplerOffs = (int16_t) ROUND(offset * (1 << ODS_SUB_BIN_QFORMAT));
+
+        offset = 0;
+        if ((rangeIdx > 0) && (rangeIdx < (numRangeBins - 1)))
+        {
+            offset = OdsDemo_quadFitPeakOffset((float) cell[-(int32_t) numDopplerBins],
+                                               (float) cell[0],
+                                               (float) cell[numDopplerBins]);
+        }
+        obj->detObjSubBin[i].rangeOffs = (int16_t) ROUND(offset * (1 << ODS_SUB_BIN_QFORMAT));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Range index of a detected object, with its sub-bin offset when the
+ *      sub-bin interpolation is enabled.
+ *
+ *  @param[in] obj                Pointer to data path object
+ *
+ *  @param[in] objIndex           Detected object index
+ *
+ *  @retval
+ *      Range index
+ */
+static float OdsDemo_detObjRangeIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex)
+{
+    float rangeIdx = (float) obj->detObj2D[objIndex].rangeIdx;
+
+    if (obj->detObjSubBin != NULL)
+    {
+        rangeIdx += (float) obj->detObjSubBin[objIndex].rangeOffs * (1.0f / (1 << ODS_SUB_BIN_QFORMAT));
+    }
+    return rangeIdx;
+}
+
 /**
  *  @b Description
  *  @n
@@ -644,15 +821,19 @@ void OdsDemo_XYcalc (OdsDemo_DSS_DataPathObj *obj,
 #ifdef MMW_ENABLE_NEGATIVE_FREQ_SLOPE
     if (rangeResolution > 0)
     {
-        range = obj->detObj2D[objIndex].rangeIdx * rangeResolution;
+        range = OdsDemo_detObjRangeIdx(obj, objIndex) * rangeResolution;
     }
     else
     {
         obj->detObj2D[objIndex].rangeIdx = (uint16_t) ((int32_t) obj->numRangeBins - (int32_t) obj->detObj2D[objIndex].rangeIdx);
-        range = obj->detObj2D[objIndex].rangeIdx * -rangeResolution;
+        if (obj->detObjSubBin != NULL)
+        {
+            obj->detObjSubBin[objIndex].rangeOffs = -obj->detObjSubBin[objIndex].rangeOffs;
+        }
+        range = OdsDemo_detObjRangeIdx(obj, objIndex) * -rangeResolution;
     }
 #else
-    range = obj->detObj2D[objIndex].rangeIdx * rangeResolution;
+    range = OdsDemo_detObjRangeIdx(obj, objIndex) * rangeResolution;
 #endif
 
     /* Compensate for range bias */
@@ -807,11 +988,15 @@ void OdsDemo_XYestimation(OdsDemo_DSS_DataPathObj *obj,
         }
 
         /* Is second peak greater than threshold? */
-        if (maxVal2 > (maxVal * obj->cliCfg->multiObjBeamFormingCfg.multiPeakThrsScal) && (obj->numDetObj < MMW_MAX_OBJ_OUT))
+        if (maxVal2 > (maxVal * obj->cliCfg->multiObjBeamFormingCfg.multiPeakThrsScal) && (obj->numDetObj < obj->maxNumDetObj))
         {
             /* Second peak detected! Add it to the end of the list */
             obj->detObj2D[obj->numDetObj].dopplerIdx = obj->detObj2D[objIndex].dopplerIdx;
             obj->detObj2D[obj->numDetObj].rangeIdx = obj->detObj2D[objIndex].rangeIdx;
+            if (obj->detObjSubBin != NULL)
+            {
+                obj->detObjSubBin[obj->numDetObj] = obj->detObjSubBin[objIndex];
+            }
             objIndex = obj->numDetObj;
             obj->numDetObj++;
 
@@ -820,6 +1005,11 @@ void OdsDemo_XYestimation(OdsDemo_DSS_DataPathObj *obj,
                             azimIdx,
                             maxVal2);
         }
+        else if (maxVal2 > (maxVal * obj->cliCfg->multiObjBeamFormingCfg.multiPeakThrsScal))
+        {
+            /* Second peak detected, but the output list is full */
+            obj->numDetObjDropped++;
+        }
     }
 }
 
@@ -847,15 +1037,19 @@ void OdsDemo_Yestimation(OdsDemo_DSS_DataPathObj *obj,
 #ifdef MMW_ENABLE_NEGATIVE_FREQ_SLOPE
     if (rangeResolution > 0)
     {
-        range = obj->detObj2D[objIndex].rangeIdx * rangeResolution;
+        range = OdsDemo_detObjRangeIdx(obj, objIndex) * rangeResolution;
     }
     else
     {
         obj->detObj2D[objIndex].rangeIdx = (uint16_t) ((int32_t) obj->numRangeBins - (int32_t) obj->detObj2D[objIndex].rangeIdx);
-        range = obj->detObj2D[objIndex].rangeIdx * -rangeResolution;
+        if (obj->detObjSubBin != NULL)
+        {
+            obj->detObjSubBin[objIndex].rangeOffs = -obj->detObjSubBin[objIndex].rangeOffs;
+        }
+        range = OdsDemo_detObjRangeIdx(obj, objIndex) * -rangeResolution;
     }
 #else
-    range = obj->detObj2D[objIndex].rangeIdx * rangeResolution;
+    range = OdsDemo_detObjRangeIdx(obj, objIndex) * rangeResolution;
 #endif
 
     /* Compensate for range bias */
@@ -1132,6 +1326,35 @@ void OdsDemo_dataPathWaitTransDetMatrix2(OdsDemo_DSS_DataPathObj *obj)
 #endif
 }
 
+#ifdef ODS_PEAK_GROUPING_STAGED
+/**
+ *  @b Description
+ *  @n
+ *      Waits for the detection matrix rows of the detection matrix based
+ *      peak grouping to be transferred from L3 to L2. This is a blocking
+ *      function.
+ *
+ *  @param[in] obj  Pointer to data path object
+ *
+ *  @retval
+ *      NONE
+ */
+static void OdsDemo_dataPathWaitTransPeakGroupRows(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_DSS_dataPathContext_t *context = obj->context;
+    volatile bool isTransferDone;
+
+    do {
+        if (EDMA_isTransferComplete(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                                    (uint8_t) ODS_EDMA_CH_DET_MATRIX3,
+                                    (bool *)&isTransferDone) != EDMA_NO_ERROR)
+        {
+            OdsDemo_dssAssert(0);
+        }
+    } while (isTransferDone == false);
+}
+#endif
+
 /**
  *  @b Description
  *  @n
@@ -1354,6 +1577,159 @@ void OdsDemo_dssDataPathStartCQEdma(OdsDemo_DSS_DataPathObj *ptrDataPathObj)
     }
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Address of a sample of the radar cube, 16-bit or packed.
+ *  @param[in] obj        Pointer to data path object
+ *  @param[in] sampleIdx  Sample index
+ *
+ *  @retval
+ *      Sample address
+ */
+static inline uint32_t OdsDemo_radarCubeAddr(OdsDemo_DSS_DataPathObj *obj, uint32_t sampleIdx)
+{
+    return (uint32_t) obj->radarCube + sampleIdx * obj->radarCubeSampleBytes;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sample index of range bin 0, Rx antenna 0 of a chirp in the radar cube.
+ *  @param[in] obj        Pointer to data path object
+ *  @param[in] txAntIdx   Tx antenna of the chirp
+ *  @param[in] dopplerIdx Chirp index within the Tx antenna
+ *
+ *  @retval
+ *      Sample index
+ */
+uint32_t OdsDemo_radarCubeChirpIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t txAntIdx, uint32_t dopplerIdx)
+{
+    uint32_t chirpLen = obj->numRangeBins * obj->numRxAntennas;
+
+    if (obj->radarCubeLayoutCfg.layout == ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR)
+    {
+        /* virtual antenna 0 or 1 of range bin 0, the corner-turn spreads the rest */
+        return txAntIdx * obj->numDopplerBins + dopplerIdx;
+    }
+    return (txAntIdx * obj->numDopplerBins + dopplerIdx) * chirpLen;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sample index of the first Doppler sample of a range bin and virtual
+ *      antenna (in fetch order) in the radar cube.
+ *  @param[in] obj        Pointer to data path object
+ *  @param[in] rangeIdx   Range bin
+ *  @param[in] virtAntIdx Virtual antenna in fetch order
+ *
+ *  @retval
+ *      Sample index
+ */
+uint32_t OdsDemo_radarCubeDopplerVecIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t rangeIdx, uint32_t virtAntIdx)
+{
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+
+    if (obj->radarCubeLayoutCfg.layout == ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR)
+    {
+        return (rangeIdx * numVirtAnt + virtAntIdx) * obj->numDopplerBins;
+    }
+    if (obj->numTxAntennas == 2)
+    {
+        return OdsDemo_radarCubeChirpIdx(obj, virtAntIdx & 0x1U, 0) +
+               (virtAntIdx / 2) * obj->numRangeBins + rangeIdx;
+    }
+    return virtAntIdx * obj->numRangeBins + rangeIdx;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Maps a virtual antenna in fetch order to azimuth order.
+ *  @param[in] obj        Pointer to data path object
+ *  @param[in] virtAntIdx Virtual antenna in fetch order
+ *
+ *  @retval
+ *      Virtual antenna in azimuth order
+ */
+uint32_t OdsDemo_radarCubeAzimAntIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t virtAntIdx)
+{
+    if (obj->numTxAntennas == 2)
+    {
+        return virtAntIdx/2 + (virtAntIdx & 0x1U) * obj->numRxAntennas;
+    }
+    return virtAntIdx;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Configures an EDMA channel that fetches the Doppler vectors of a range
+ *      bin from the radar cube into the ping or the pong buffer, the ping
+ *      channel those of the even and the pong channel those of the odd
+ *      virtual antennas. Range-major radar cubes are gathered one sample per
+ *      chirp, Doppler-major ones are fetched one vector per transfer.
+ *  @param[in] obj          Pointer to data path object
+ *  @param[in] srcBuff      Doppler vector of virtual antenna 0 (ping) or 1 (pong),
+ *                          NULL if the source is set before every fetch
+ *  @param[in] chId         EDMA channel
+ *  @param[in] shadowParamId EDMA shadow PaRAM set
+ *  @param[in] pingPongId   0 for the ping, 1 for the pong channel
+ *  @param[in] eventQueue   Event queue
+ *  @param[in] transferCompletionCallbackFxn Transfer completion call back function
+ *
+ *  @retval
+ *      EDMA driver error code
+ */
+static int32_t OdsDemo_dataPathConfigEdmaDopplerIn(OdsDemo_DSS_DataPathObj *obj,
+                                                   uint8_t *srcBuff,
+                                                   uint8_t chId,
+                                                   uint16_t shadowParamId,
+                                                   uint32_t pingPongId,
+                                                   uint8_t eventQueue,
+                                                   EDMA_transferCompletionCallbackFxn_t transferCompletionCallbackFxn)
+{
+    OdsDemo_DSS_dataPathContext_t *context = obj->context;
+    uint8_t *dstBuff = (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->dstPingPong[pingPongId * obj->numDopplerBins]),
+                                                         SOC_TranslateAddr_Dir_TO_EDMA, NULL));
+    uint32_t vecBytes = obj->numDopplerBins * obj->radarCubeSampleBytes;
+
+    if (obj->radarCubeLayoutCfg.layout == ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR)
+    {
+        /* the vectors of a range bin are contiguous, the channel skips the
+           vectors of the other channel */
+        return EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            srcBuff,
+            dstBuff,
+            chId,
+            false,
+            shadowParamId,
+            vecBytes,
+            MAX((obj->numTxAntennas * obj->numRxAntennas / 2), 1),
+            2 * vecBytes,
+            0,
+            eventQueue,
+            transferCompletionCallbackFxn,
+            (uintptr_t) obj);
+    }
+
+    return EDMAutil_configType2b(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+        srcBuff,
+        dstBuff,
+        chId,
+        false,
+        shadowParamId,
+        obj->radarCubeSampleBytes,
+        obj->numRangeBins,
+        obj->numTxAntennas,
+        obj->numRxAntennas,
+        obj->numDopplerBins,
+        eventQueue,
+        transferCompletionCallbackFxn,
+        (uintptr_t) obj);
+}
+
 /**
  *  @b Description
  *  @n
@@ -1370,7 +1746,7 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
     uint16_t numPingOrPongSamples, aCount;
     int16_t oneD_destinationBindex;
     OdsDemo_DSS_dataPathContext_t *context = obj->context;
-    uint8_t *oneD_destinationPongAddress, *twoD_sourcePongAddress;
+    uint8_t *oneD_destinationPongAddress;
     MmwDemo_AnaMonitorCfg*      ptrAnaMonitorCfg;
 
     /*****************************************************
@@ -1379,164 +1755,237 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
      * For ADC Buffer to L2 use EDMA-A TPTC =1
      *****************************************************/
     eventQueue = 0U;
-     /* Ping - copies chirp samples from even antenna numbers (e.g. RxAnt0 and RxAnt2) */  
-    retVal =
-    EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        (uint8_t *)(&obj->ADCdataBuf[0]),
-        (uint8_t *)(SOC_translateAddress((uint32_t)&obj->adcDataIn[0],SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
-        ODS_EDMA_CH_1D_IN_PING,
-        false,
-        ODS_EDMA_CH_1D_IN_PING_SHADOW,
-        obj->numAdcSamples * BYTES_PER_SAMP_1D,
-        MAX(obj->numRxAntennas / 2, 1) * obj->numChirpsPerChirpEvent,
-        (obj->numAdcSamples * BYTES_PER_SAMP_1D * 2) * obj->numChirpsPerChirpEvent,
-        0,
-        eventQueue,
+    if (obj->rangeFftBatch)
+    {
+        /* Batched range FFT - copies chirp samples of all antennas with one transfer,
+           antenna after antenna */
+        retVal =
+        EDMAutil_configType3(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(&obj->ADCdataBuf[0]),
+            (uint8_t *)(SOC_translateAddress((uint32_t)&obj->adcDataIn[0],SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            ODS_EDMA_CH_1D_IN_PING,
+            false,
+            ODS_EDMA_CH_1D_IN_PING_SHADOW,
+            obj->numAdcSamples * BYTES_PER_SAMP_1D,
+            obj->numRxAntennas,
+            (obj->numAdcSamples * BYTES_PER_SAMP_1D) * obj->numChirpsPerChirpEvent,
+            obj->numAdcSamples * BYTES_PER_SAMP_1D,
+            eventQueue,
 #ifdef EDMA_1D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
 #else
-        NULL,
+            NULL,
 #endif
-        (uintptr_t) obj);
-    if (retVal < 0)
-    {
-        return -1;
+            (uintptr_t) obj);
+        if (retVal < 0)
+        {
+            return -1;
+        }
     }
-    
-    /* Pong - copies chirp samples from odd antenna numbers (e.g. RxAnt1 and RxAnt3) */
-    retVal =
-    EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        (uint8_t *)(&obj->ADCdataBuf[obj->numAdcSamples * obj->numChirpsPerChirpEvent]),
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->adcDataIn[obj->numRangeBins]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
-        ODS_EDMA_CH_1D_IN_PONG,
-        false,
-        ODS_EDMA_CH_1D_IN_PONG_SHADOW,
-        obj->numAdcSamples * BYTES_PER_SAMP_1D,
-        MAX(obj->numRxAntennas / 2, 1) * obj->numChirpsPerChirpEvent,
-        (obj->numAdcSamples * BYTES_PER_SAMP_1D * 2) * obj->numChirpsPerChirpEvent,
-        0,
-        eventQueue,
+    else
+    {
+        /* Ping - copies chirp samples from even antenna numbers (e.g. RxAnt0 and RxAnt2) */
+        retVal =
+        EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(&obj->ADCdataBuf[0]),
+            (uint8_t *)(SOC_translateAddress((uint32_t)&obj->adcDataIn[0],SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            ODS_EDMA_CH_1D_IN_PING,
+            false,
+            ODS_EDMA_CH_1D_IN_PING_SHADOW,
+            obj->numAdcSamples * BYTES_PER_SAMP_1D,
+            MAX(obj->numRxAntennas / 2, 1) * obj->numChirpsPerChirpEvent,
+            (obj->numAdcSamples * BYTES_PER_SAMP_1D * 2) * obj->numChirpsPerChirpEvent,
+            0,
+            eventQueue,
 #ifdef EDMA_1D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
 #else
-        NULL,
+            NULL,
 #endif
-        (uintptr_t) obj);
-    if (retVal < 0)
-    {
-        return -1;
-    }
-    
-    /* using different event queue between input and output to parallelize better */
-    eventQueue = 1U;
-    /*****************************************************
-     * EDMA configuration for storing 1d fft output to L3.
-     * It copies all Rx antennas of the chirp per trigger event.
-     *****************************************************/
-    numPingOrPongSamples = obj->numRangeBins * obj->numRxAntennas;
-    aCount = numPingOrPongSamples * BYTES_PER_SAMP_1D;
+            (uintptr_t) obj);
+        if (retVal < 0)
+        {
+            return -1;
+        }
 
-    /* If TDM-MIMO (BPM or otherwise), store odd chirps consecutively and even 
-       chirps consecutively. This is done because for the case of 1024 range bins
-       and 4 rx antennas, the source jump required for 2D processing will be 32768
-       which is negative jump for the EDMA (16-bit signed jump). Storing in this way
-       reduces the jump to be positive which makes 2D processing feasible */
-    if (obj->numTxAntennas == 2)
-    {
-        oneD_destinationBindex = (int16_t)aCount;
-        oneD_destinationPongAddress = (uint8_t *)(&obj->radarCube[numPingOrPongSamples * obj->numDopplerBins]);
+        /* Pong - copies chirp samples from odd antenna numbers (e.g. RxAnt1 and RxAnt3) */
+        retVal =
+        EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(&obj->ADCdataBuf[obj->numAdcSamples * obj->numChirpsPerChirpEvent]),
+            (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->adcDataIn[obj->numRangeBins]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            ODS_EDMA_CH_1D_IN_PONG,
+            false,
+            ODS_EDMA_CH_1D_IN_PONG_SHADOW,
+            obj->numAdcSamples * BYTES_PER_SAMP_1D,
+            MAX(obj->numRxAntennas / 2, 1) * obj->numChirpsPerChirpEvent,
+            (obj->numAdcSamples * BYTES_PER_SAMP_1D * 2) * obj->numChirpsPerChirpEvent,
+            0,
+            eventQueue,
+#ifdef EDMA_1D_INPUT_BLOCKING
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
+#else
+            NULL,
+#endif
+            (uintptr_t) obj);
+        if (retVal < 0)
+        {
+            return -1;
+        }
     }
-    else
+
+    /* using different event queue between input and output to parallelize better */
+    eventQueue = 1U;
+    /*****************************************************
+     * EDMA configuration for storing 1d fft output to L3.
+     * It copies all Rx antennas of the chirp per trigger event.
+     *****************************************************/
+    numPingOrPongSamples = obj->numRangeBins * obj->numRxAntennas;
+    aCount = numPingOrPongSamples * obj->radarCubeSampleBytes;
+
+    if (obj->radarCubeLayoutCfg.layout == ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR)
     {
-        oneD_destinationBindex = (int16_t)(aCount * 2);
-        oneD_destinationPongAddress = (uint8_t *)(&obj->radarCube[numPingOrPongSamples]);
+        /* Doppler-major radar cube - the EDMA corner-turns the chirp, every range
+           bin of every Rx antenna goes to chirp dopplerIdx of its Doppler vector.
+           The destination of the chirp is set before every trigger. */
+        retVal =
+        EDMAutil_configType2a(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[0]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            (uint8_t *)(&obj->radarCube[0]),
+            ODS_EDMA_CH_1D_OUT_PING,
+            false,
+            ODS_EDMA_CH_1D_OUT_PING_SHADOW,
+            obj->radarCubeSampleBytes,
+            obj->numRangeBins,
+            obj->numTxAntennas,
+            obj->numRxAntennas,
+            obj->numDopplerBins,
+            eventQueue,
+#ifdef EDMA_1D_OUTPUT_BLOCKING
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
+#else
+            NULL,
+#endif
+            (uintptr_t) obj);
+        if (retVal < 0)
+        {
+            return -1;
+        }
+
+        retVal =
+        EDMAutil_configType2a(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[numPingOrPongSamples]),
+                                             SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            (uint8_t *)(&obj->radarCube[0]),
+            ODS_EDMA_CH_1D_OUT_PONG,
+            false,
+            ODS_EDMA_CH_1D_OUT_PONG_SHADOW,
+            obj->radarCubeSampleBytes,
+            obj->numRangeBins,
+            obj->numTxAntennas,
+            obj->numRxAntennas,
+            obj->numDopplerBins,
+            eventQueue,
+#ifdef EDMA_1D_OUTPUT_BLOCKING
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
+#else
+            NULL,
+#endif
+            (uintptr_t) obj);
+        if (retVal < 0)
+        {
+            return -1;
+        }
     }
+    else
+    {
 
-    /* Ping - Copies from ping FFT output (even chirp indices)  to L3 */
-    retVal =
-    EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[0]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
-        (uint8_t *)(&obj->radarCube[0]),
-        ODS_EDMA_CH_1D_OUT_PING,
-        false,
-        ODS_EDMA_CH_1D_OUT_PING_SHADOW,
-        aCount,
-        obj->numChirpsPerFrame / 2, //bCount
-        0, //srcBidx
-        oneD_destinationBindex, //dstBidx
-        eventQueue,
+        /* If TDM-MIMO (BPM or otherwise), store odd chirps consecutively and even 
+           chirps consecutively. This is done because for the case of 1024 range bins
+           and 4 rx antennas, the source jump required for 2D processing will be 32768
+           which is negative jump for the EDMA (16-bit signed jump). Storing in this way
+           reduces the jump to be positive which makes 2D processing feasible */
+        if (obj->numTxAntennas == 2)
+        {
+            oneD_destinationBindex = (int16_t)aCount;
+            oneD_destinationPongAddress = (uint8_t *) OdsDemo_radarCubeAddr(obj, numPingOrPongSamples * obj->numDopplerBins);
+        }
+        else
+        {
+            oneD_destinationBindex = (int16_t)(aCount * 2);
+            oneD_destinationPongAddress = (uint8_t *) OdsDemo_radarCubeAddr(obj, numPingOrPongSamples);
+        }
+
+        /* Ping - Copies from ping FFT output (even chirp indices)  to L3 */
+        retVal =
+        EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[0]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            (uint8_t *)(&obj->radarCube[0]),
+            ODS_EDMA_CH_1D_OUT_PING,
+            false,
+            ODS_EDMA_CH_1D_OUT_PING_SHADOW,
+            aCount,
+            obj->numChirpsPerFrame / 2, //bCount
+            0, //srcBidx
+            oneD_destinationBindex, //dstBidx
+            eventQueue,
 #ifdef EDMA_1D_OUTPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
 #else
-        NULL,
+            NULL,
 #endif
-        (uintptr_t) obj);
+            (uintptr_t) obj);
 
-    if (retVal < 0)
-    {
-        return -1;
-    }
+        if (retVal < 0)
+        {
+            return -1;
+        }
 
-    /* Pong - Copies from pong FFT output (odd chirp indices)  to L3 */
-    retVal =
-    EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[numPingOrPongSamples]),
-                                         SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
-        oneD_destinationPongAddress,
-        ODS_EDMA_CH_1D_OUT_PONG,
-        false,
-        ODS_EDMA_CH_1D_OUT_PONG_SHADOW,
-        aCount,
-        obj->numChirpsPerFrame / 2, //bCount
-        0, //srcBidx
-        oneD_destinationBindex, //dstBidx
-        eventQueue,
+        /* Pong - Copies from pong FFT output (odd chirp indices)  to L3 */
+        retVal =
+        EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+            (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->fftOut1D[numPingOrPongSamples]),
+                                             SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+            oneD_destinationPongAddress,
+            ODS_EDMA_CH_1D_OUT_PONG,
+            false,
+            ODS_EDMA_CH_1D_OUT_PONG_SHADOW,
+            aCount,
+            obj->numChirpsPerFrame / 2, //bCount
+            0, //srcBidx
+            oneD_destinationBindex, //dstBidx
+            eventQueue,
 #ifdef EDMA_1D_OUTPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+            OdsDemo_EDMA_transferCompletionCallbackFxn,
 #else
-        NULL,
+            NULL,
 #endif
-        (uintptr_t) obj);
+            (uintptr_t) obj);
 
-    if (retVal < 0)
-    {
-        return -1;
+        if (retVal < 0)
+        {
+            return -1;
+        }
     }
 
     /*****************************************
      * Interframe processing related EDMA configuration
      *****************************************/
     eventQueue = 0U;
-    if (obj->numTxAntennas == 2)
-    {
-        twoD_sourcePongAddress = oneD_destinationPongAddress; 
-    }
-    else
-    {
-        twoD_sourcePongAddress = (uint8_t *)(&obj->radarCube[obj->numRangeBins]);
-    }
     /* Ping: This DMA channel is programmed to fetch the 1D FFT data from radarCube
      * matrix in L3 mem of even antenna rows into the Ping Buffer in L2 mem*/
     retVal =
-        EDMAutil_configType2b(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        (uint8_t *)(&obj->radarCube[0]),
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->dstPingPong[0]),
-                        SOC_TranslateAddr_Dir_TO_EDMA, NULL)),
+        OdsDemo_dataPathConfigEdmaDopplerIn(obj,
+        (uint8_t *) OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, 0, 0)),
         ODS_EDMA_CH_2D_IN_PING,
-        false,
         ODS_EDMA_CH_2D_IN_PING_SHADOW,
-        BYTES_PER_SAMP_1D,
-        obj->numRangeBins,
-        obj->numTxAntennas,
-        obj->numRxAntennas,
-        obj->numDopplerBins,
+        0,
         eventQueue,
 #ifdef EDMA_2D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+        OdsDemo_EDMA_transferCompletionCallbackFxn
 #else
-        NULL,
+        NULL
 #endif
-        (uintptr_t) obj);
+        );
     if (retVal < 0)
     {
         return -1;
@@ -1545,25 +1994,18 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
     /* Pong: This DMA channel is programmed to fetch the 1D FFT data from radarCube
      * matrix in L3 mem of odd antenna rows into thePong Buffer in L2 mem*/
     retVal =
-        EDMAutil_configType2b(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-        twoD_sourcePongAddress,
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->dstPingPong[obj->numDopplerBins]),
-                        SOC_TranslateAddr_Dir_TO_EDMA, NULL)),
+        OdsDemo_dataPathConfigEdmaDopplerIn(obj,
+        (uint8_t *) OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, 0, 1)),
         ODS_EDMA_CH_2D_IN_PONG,
-        false,
         ODS_EDMA_CH_2D_IN_PONG_SHADOW,
-        BYTES_PER_SAMP_1D,
-        obj->numRangeBins,
-        obj->numTxAntennas,
-        obj->numRxAntennas,
-        obj->numDopplerBins,
+        1,
         eventQueue,
 #ifdef EDMA_2D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+        OdsDemo_EDMA_transferCompletionCallbackFxn
 #else
-        NULL,
+        NULL
 #endif
-        (uintptr_t) obj);
+        );
     if (retVal < 0)
     {
         return -1;
@@ -1622,6 +2064,30 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
         return -1;
     }
 
+#ifdef ODS_PEAK_GROUPING_STAGED
+    /* This EDMA channel brings one detection matrix row from L3 mem into L2
+     * mem for the detection matrix based peak grouping, source and
+     * destination are set per transfer */
+    retVal =
+    EDMAutil_configType1(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+        (uint8_t *)(obj->detMatrix),
+        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->peakGroupRows[0U]),SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+        ODS_EDMA_CH_DET_MATRIX3,
+        false,
+        ODS_EDMA_CH_DET_MATRIX3_SHADOW,
+        obj->numDopplerBins * BYTES_PER_SAMP_DET,
+        1U,
+        0,
+        0,
+        eventQueue,
+        NULL,
+        (uintptr_t) obj);
+    if (retVal < 0)
+    {
+        return -1;
+    }
+#endif
+
     /*********************************************************
      * These EDMA Channels are for Azimuth calculation. They bring
      * 1D FFT data for 2D DFT and Azimuth FFT calculation.
@@ -1630,25 +2096,18 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
      * matrix in L3 mem of even antenna rows into the Ping Buffer in L2 mem.
      * */
     retVal =
-        EDMAutil_configType2b(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+        OdsDemo_dataPathConfigEdmaDopplerIn(obj,
         (uint8_t *) NULL,
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->dstPingPong[0]),
-                        SOC_TranslateAddr_Dir_TO_EDMA, NULL)),
         ODS_EDMA_CH_3D_IN_PING,
-        false,
         ODS_EDMA_CH_3D_IN_PING_SHADOW,
-        BYTES_PER_SAMP_1D,
-        obj->numRangeBins,
-        obj->numTxAntennas,
-        obj->numRxAntennas,
-        obj->numDopplerBins,
+        0,
         eventQueue,
 #ifdef EDMA_3D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+        OdsDemo_EDMA_transferCompletionCallbackFxn
 #else
-        NULL,
+        NULL
 #endif
-        (uintptr_t) obj);
+        );
     if (retVal < 0)
     {
         return -1;
@@ -1657,25 +2116,18 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
     /* Pong: This DMA channel is programmed to fetch the 1D FFT data from radarCube
      * matrix in L3 mem of odd antenna rows into the Pong Buffer in L2 mem*/
     retVal =
-        EDMAutil_configType2b(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+        OdsDemo_dataPathConfigEdmaDopplerIn(obj,
         (uint8_t *) NULL,
-        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->dstPingPong[obj->numDopplerBins]),
-                        SOC_TranslateAddr_Dir_TO_EDMA, NULL)),
         ODS_EDMA_CH_3D_IN_PONG,
-        false,
         ODS_EDMA_CH_3D_IN_PONG_SHADOW,
-        BYTES_PER_SAMP_1D,
-        obj->numRangeBins,
-        obj->numTxAntennas,
-        obj->numRxAntennas,
-        obj->numDopplerBins,
+        1,
         eventQueue,
 #ifdef EDMA_3D_INPUT_BLOCKING
-        OdsDemo_EDMA_transferCompletionCallbackFxn,
+        OdsDemo_EDMA_transferCompletionCallbackFxn
 #else
-        NULL,
+        NULL
 #endif
-        (uintptr_t) obj);
+        );
     if (retVal < 0)
     {
         return -1;
@@ -1694,102 +2146,338 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj)
 /**
  *  @b Description
  *  @n
- *    The function groups neighboring peaks into one. The grouping is done
- *    according to two input flags: groupInDopplerDirection and
- *    groupInDopplerDirection. For each detected peak the function checks
- *    if the peak is greater than its neighbors. If this is true, the peak is
- *    copied to the output list of detected objects. The neighboring peaks that are used
- *    for checking are taken from the detection matrix and copied into 3x3 kernel
- *    regardless of whether they are CFAR detected or not.
- *    Note: Function always reads 9 samples per detected object
- *    from L3 memory into local array tempBuff, but it only needs to read according to input flags.
- *    For example if only the groupInDopplerDirection flag is set, it only needs
- *    to read middle row of the kernel, i.e. 3 samples per target from detection matrix.
- *  @param[out]   objOut             Output array of  detected objects after peak grouping
- *  @param[in]    objRaw             Array of detected objects after CFAR detection
- *  @param[in]    numDetectedObjects Number of detected objects by CFAR
- *  @param[in]    detMatrix          Detection Range/Doppler matrix
- *  @param[in]    numDopplerBins     Number of Doppler bins
- *  @param[in]    maxRangeIdx        Maximum range limit
- *  @param[in]    minRangeIdx        Minimum range limit
- *  @param[in]    groupInDopplerDirection Flag enables grouping in Doppler directiuon
- *  @param[in]    groupInRangeDirection   Flag enables grouping in Range directiuon
+ *    Heap key of a raw detection. In CFAR order the key is the Doppler line
+ *    followed by the range bin, otherwise it grows as the peak value falls,
+ *    so that the root of the heap is the weakest detection.
+ */
+static inline uint32_t OdsDemo_objRawHeapKey(const OdsDemo_objRaw_t *objRaw, uint32_t cfarOrder)
+{
+    return cfarOrder ? (((uint32_t) objRaw->dopplerIdx << 16) | objRaw->rangeIdx) :
+                       (0xFFFFU - (uint32_t) objRaw->peakVal);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Moves objRaw[idx] down the max heap of num raw detections on
+ *    OdsDemo_objRawHeapKey.
+ */
+static void OdsDemo_objRawHeapSiftDown(OdsDemo_objRaw_t *objRaw, uint32_t num, uint32_t idx,
+                                       uint32_t cfarOrder)
+{
+    OdsDemo_objRaw_t item = objRaw[idx];
+    uint32_t key = OdsDemo_objRawHeapKey(&item, cfarOrder);
+    uint32_t child;
+
+    while ((child = 2 * idx + 1) < num)
+    {
+        if (((child + 1) < num) &&
+            (OdsDemo_objRawHeapKey(&objRaw[child + 1], cfarOrder) > OdsDemo_objRawHeapKey(&objRaw[child], cfarOrder)))
+        {
+            child++;
+        }
+        if (OdsDemo_objRawHeapKey(&objRaw[child], cfarOrder) <= key)
+        {
+            break;
+        }
+        objRaw[idx] = objRaw[child];
+        idx = child;
+    }
+    objRaw[idx] = item;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Adds a CFAR detection to detObj2DRaw, which holds at most
+ *    maxNumDetObjRaw detections. Once the list is full it is turned into a
+ *    heap with the weakest detection at the root, which the new detection
+ *    replaces if it is stronger, and numDetObjRawDropped counts the
+ *    detections left out. OdsDemo_detObjRawRestoreOrder puts the list back
+ *    in CFAR order afterwards.
  *
  *  @retval
- *      Number of detected objects after grouping
+ *      Number of detections in detObj2DRaw
  */
-uint32_t OdsDemo_cfarPeakGrouping(
-                                OdsDemo_detectedObj*  objOut,
-                                OdsDemo_objRaw_t * objRaw,
-                                uint32_t numDetectedObjects,
-                                uint16_t* detMatrix,
-                                uint32_t numDopplerBins,
-                                uint32_t maxRangeIdx,
-                                uint32_t minRangeIdx,
-                                uint32_t groupInDopplerDirection,
-                                uint32_t groupInRangeDirection)
+static inline uint32_t OdsDemo_detObjRawAdd(OdsDemo_DSS_DataPathObj *obj, uint32_t numDet,
+                                            uint32_t rangeIdx, uint32_t dopplerIdx, uint32_t peakVal)
 {
-    int32_t i, j;
-    int32_t rowStart, rowEnd;
-    uint32_t numObjOut = 0;
-    uint32_t rangeIdx, dopplerIdx, peakVal;
-    uint16_t *tempPtr;
-    uint16_t kernel[9], detectedObjFlag;
-    int32_t k, l;
-    uint32_t startInd, stepInd, endInd;
+    OdsDemo_objRaw_t *objRaw = obj->detObj2DRaw;
+    uint32_t i;
 
-    if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 1))
+    if (numDet < obj->maxNumDetObjRaw)
     {
-        /* Grouping both in Range and Doppler direction */
-        startInd = 0;
-        stepInd = 1;
-        endInd = 8;
+        objRaw[numDet].rangeIdx = rangeIdx;
+        objRaw[numDet].dopplerIdx = dopplerIdx;
+        objRaw[numDet].peakVal = peakVal;
+        return numDet + 1;
     }
-    else if ((groupInDopplerDirection == 0) && (groupInRangeDirection == 1))
+
+    if (obj->numDetObjRawDropped == 0)
     {
-        /* Grouping only in Range direction */
-        startInd = 1;
-        stepInd = 3;
-        endInd = 7;
+        for (i = numDet / 2; i > 0; i--)
+        {
+            OdsDemo_objRawHeapSiftDown(objRaw, numDet, i - 1, 0);
+        }
     }
-    else if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 0))
+    obj->numDetObjRawDropped++;
+    if (peakVal > objRaw[0].peakVal)
     {
-        /* Grouping only in Doppler direction */
-        startInd = 3;
-        stepInd = 1;
-        endInd = 5;
+        objRaw[0].rangeIdx = rangeIdx;
+        objRaw[0].dopplerIdx = dopplerIdx;
+        objRaw[0].peakVal = peakVal;
+        OdsDemo_objRawHeapSiftDown(objRaw, numDet, 0, 0);
     }
-    else
+    return numDet;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Sorts the raw detections back into CFAR order (Doppler line, then range
+ *    bin) after OdsDemo_detObjRawAdd dropped some of them.
+ */
+static void OdsDemo_detObjRawRestoreOrder(OdsDemo_objRaw_t *objRaw, uint32_t num)
+{
+    OdsDemo_objRaw_t item;
+    uint32_t i;
+
+    for (i = num / 2; i > 0; i--)
     {
-        /* No grouping, copy all detected objects to the output matrix within specified min max range*/
-        for(i = 0; i < MIN(numDetectedObjects, MMW_MAX_OBJ_OUT) ; i++)
-        {
-            if ((objRaw[i].rangeIdx <= maxRangeIdx) && ((objRaw[i].rangeIdx >= minRangeIdx)))
-            {
-                objOut[numObjOut].rangeIdx = objRaw[i].rangeIdx;
-                objOut[numObjOut].dopplerIdx = DOPPLER_IDX_TO_SIGNED(objRaw[i].dopplerIdx, numDopplerBins);
-                objOut[numObjOut].peakVal = objRaw[i].peakVal;
-                numObjOut++;
-            }
-        }
-        return numObjOut;
+        OdsDemo_objRawHeapSiftDown(objRaw, num, i - 1, 1);
     }
-
-    /* Start checking */
-    for(i = 0; i < numDetectedObjects; i++)
+    for (i = num; i > 1; i--)
     {
-        detectedObjFlag = 0;
-        rangeIdx = objRaw[i].rangeIdx;
-        dopplerIdx = objRaw[i].dopplerIdx;
-        peakVal = objRaw[i].peakVal;
-        if((rangeIdx <= maxRangeIdx) && (rangeIdx >= minRangeIdx))
-        {
-            detectedObjFlag = 1;
+        item = objRaw[i - 1];
+        objRaw[i - 1] = objRaw[0];
+        objRaw[0] = item;
+        OdsDemo_objRawHeapSiftDown(objRaw, i - 1, 0, 1);
+    }
+}
 
-            /* Fill local 3x3 kernel from detection matrix in L3*/
-            tempPtr = detMatrix + (rangeIdx-1)*numDopplerBins;
-            rowStart = 0;
-            rowEnd = 2;
+/**
+ *  @b Description
+ *  @n
+ *    Heap key of a detected object, see OdsDemo_objRawHeapKey.
+ */
+static inline uint32_t OdsDemo_detObjHeapKey(const OdsDemo_detectedObj *objOut, uint32_t numDopplerBins,
+                                             uint32_t cfarOrder)
+{
+    return cfarOrder ? (((uint32_t) DOPPLER_IDX_TO_UNSIGNED(objOut->dopplerIdx, numDopplerBins) << 16) |
+                        objOut->rangeIdx) :
+                       (0xFFFFU - (uint32_t) objOut->peakVal);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Moves objOut[idx] down the max heap of num detected objects on
+ *    OdsDemo_detObjHeapKey.
+ */
+static void OdsDemo_detObjHeapSiftDown(OdsDemo_detectedObj *objOut, uint32_t num, uint32_t idx,
+                                       uint32_t numDopplerBins, uint32_t cfarOrder)
+{
+    OdsDemo_detectedObj item = objOut[idx];
+    uint32_t key = OdsDemo_detObjHeapKey(&item, numDopplerBins, cfarOrder);
+    uint32_t child;
+
+    while ((child = 2 * idx + 1) < num)
+    {
+        if (((child + 1) < num) &&
+            (OdsDemo_detObjHeapKey(&objOut[child + 1], numDopplerBins, cfarOrder) >
+             OdsDemo_detObjHeapKey(&objOut[child], numDopplerBins, cfarOrder)))
+        {
+            child++;
+        }
+        if (OdsDemo_detObjHeapKey(&objOut[child], numDopplerBins, cfarOrder) <= key)
+        {
+            break;
+        }
+        objOut[idx] = objOut[child];
+        idx = child;
+    }
+    objOut[idx] = item;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Adds a grouped peak to the output list of at most maxNumObjOut objects,
+ *    keeping the strongest ones the same way OdsDemo_detObjRawAdd does, with
+ *    *numObjDropped counting the objects left out.
+ *
+ *  @retval
+ *      Number of objects in objOut
+ */
+static inline uint32_t OdsDemo_detObjAdd(OdsDemo_detectedObj *objOut, uint32_t numObjOut,
+                                         uint32_t maxNumObjOut, uint32_t *numObjDropped,
+                                         uint32_t numDopplerBins, uint32_t rangeIdx,
+                                         uint32_t dopplerIdx, uint32_t peakVal)
+{
+    uint32_t i;
+
+    if (numObjOut < maxNumObjOut)
+    {
+        objOut[numObjOut].rangeIdx = rangeIdx;
+        objOut[numObjOut].dopplerIdx = DOPPLER_IDX_TO_SIGNED(dopplerIdx, numDopplerBins);
+        objOut[numObjOut].peakVal = peakVal;
+        return numObjOut + 1;
+    }
+
+    if (*numObjDropped == 0)
+    {
+        for (i = numObjOut / 2; i > 0; i--)
+        {
+            OdsDemo_detObjHeapSiftDown(objOut, numObjOut, i - 1, numDopplerBins, 0);
+        }
+    }
+    (*numObjDropped)++;
+    if ((numObjOut > 0) && (peakVal > objOut[0].peakVal))
+    {
+        objOut[0].rangeIdx = rangeIdx;
+        objOut[0].dopplerIdx = DOPPLER_IDX_TO_SIGNED(dopplerIdx, numDopplerBins);
+        objOut[0].peakVal = peakVal;
+        OdsDemo_detObjHeapSiftDown(objOut, numObjOut, 0, numDopplerBins, 0);
+    }
+    return numObjOut;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Sorts the output list back into CFAR order after OdsDemo_detObjAdd
+ *    dropped some of the objects, nothing to do otherwise.
+ *
+ *  @retval
+ *      Number of objects in objOut
+ */
+static uint32_t OdsDemo_detObjRestoreOrder(OdsDemo_detectedObj *objOut, uint32_t numObjOut,
+                                           uint32_t numObjDropped, uint32_t numDopplerBins)
+{
+    OdsDemo_detectedObj item;
+    uint32_t i;
+
+    if (numObjDropped == 0)
+    {
+        return numObjOut;
+    }
+    for (i = numObjOut / 2; i > 0; i--)
+    {
+        OdsDemo_detObjHeapSiftDown(objOut, numObjOut, i - 1, numDopplerBins, 1);
+    }
+    for (i = numObjOut; i > 1; i--)
+    {
+        item = objOut[i - 1];
+        objOut[i - 1] = objOut[0];
+        objOut[0] = item;
+        OdsDemo_detObjHeapSiftDown(objOut, i - 1, 0, numDopplerBins, 1);
+    }
+    return numObjOut;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    The function groups neighboring peaks into one. The grouping is done
+ *    according to two input flags: groupInDopplerDirection and
+ *    groupInDopplerDirection. For each detected peak the function checks
+ *    if the peak is greater than its neighbors. If this is true, the peak is
+ *    copied to the output list of detected objects. The neighboring peaks that are used
+ *    for checking are taken from the detection matrix and copied into 3x3 kernel
+ *    regardless of whether they are CFAR detected or not.
+ *    Note: Function always reads 9 samples per detected object
+ *    from L3 memory into local array tempBuff, but it only needs to read according to input flags.
+ *    For example if only the groupInDopplerDirection flag is set, it only needs
+ *    to read middle row of the kernel, i.e. 3 samples per target from detection matrix.
+ *  @param[out]   objOut             Output array of  detected objects after peak grouping
+ *  @param[in]    objRaw             Array of detected objects after CFAR detection
+ *  @param[in]    numDetectedObjects Number of detected objects by CFAR
+ *  @param[in]    detMatrix          Detection Range/Doppler matrix
+ *  @param[in]    numDopplerBins     Number of Doppler bins
+ *  @param[in]    maxRangeIdx        Maximum range limit
+ *  @param[in]    minRangeIdx        Minimum range limit
+ *  @param[in]    groupInDopplerDirection Flag enables grouping in Doppler directiuon
+ *  @param[in]    groupInRangeDirection   Flag enables grouping in Range directiuon
+ *  @param[in]    maxNumObjOut       Size of objOut, the strongest objects are
+ *                                   kept when more peaks remain
+ *  @param[out]   numObjDropped      Number of peaks that did not fit in objOut
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGrouping(
+                                OdsDemo_detectedObj*  objOut,
+                                OdsDemo_objRaw_t * objRaw,
+                                uint32_t numDetectedObjects,
+                                uint16_t* detMatrix,
+                                uint32_t numDopplerBins,
+                                uint32_t maxRangeIdx,
+                                uint32_t minRangeIdx,
+                                uint32_t groupInDopplerDirection,
+                                uint32_t groupInRangeDirection,
+                                uint32_t maxNumObjOut,
+                                uint32_t *numObjDropped)
+{
+    int32_t i, j;
+    int32_t rowStart, rowEnd;
+    uint32_t numObjOut = 0;
+    uint32_t rangeIdx, dopplerIdx, peakVal;
+    uint16_t *tempPtr;
+    uint16_t kernel[9], detectedObjFlag;
+    int32_t k, l;
+    uint32_t startInd, stepInd, endInd;
+
+    *numObjDropped = 0;
+    if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 1))
+    {
+        /* Grouping both in Range and Doppler direction */
+        startInd = 0;
+        stepInd = 1;
+        endInd = 8;
+    }
+    else if ((groupInDopplerDirection == 0) && (groupInRangeDirection == 1))
+    {
+        /* Grouping only in Range direction */
+        startInd = 1;
+        stepInd = 3;
+        endInd = 7;
+    }
+    else if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 0))
+    {
+        /* Grouping only in Doppler direction */
+        startInd = 3;
+        stepInd = 1;
+        endInd = 5;
+    }
+    else
+    {
+        /* No grouping, copy all detected objects to the output matrix within specified min max range*/
+        for(i = 0; i < numDetectedObjects; i++)
+        {
+            if ((objRaw[i].rangeIdx <= maxRangeIdx) && ((objRaw[i].rangeIdx >= minRangeIdx)))
+            {
+                numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                              objRaw[i].rangeIdx, objRaw[i].dopplerIdx, objRaw[i].peakVal);
+            }
+        }
+        return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
+    }
+
+    /* Start checking */
+    for(i = 0; i < numDetectedObjects; i++)
+    {
+        detectedObjFlag = 0;
+        rangeIdx = objRaw[i].rangeIdx;
+        dopplerIdx = objRaw[i].dopplerIdx;
+        peakVal = objRaw[i].peakVal;
+        if((rangeIdx <= maxRangeIdx) && (rangeIdx >= minRangeIdx))
+        {
+            detectedObjFlag = 1;
+
+            /* Fill local 3x3 kernel from detection matrix in L3*/
+            tempPtr = detMatrix + (rangeIdx-1)*numDopplerBins;
+            rowStart = 0;
+            rowEnd = 2;
             if (rangeIdx == minRangeIdx)
             {
                 tempPtr = detMatrix + (rangeIdx)*numDopplerBins;
@@ -1831,20 +2519,222 @@ uint32_t OdsDemo_cfarPeakGrouping(
         }
         if (detectedObjFlag == 1)
         {
-            objOut[numObjOut].rangeIdx = rangeIdx;
-            objOut[numObjOut].dopplerIdx = DOPPLER_IDX_TO_SIGNED(dopplerIdx, numDopplerBins);
-            objOut[numObjOut].peakVal = peakVal;
-            numObjOut++;
+            numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                          rangeIdx, dopplerIdx, peakVal);
+        }
+    }
+
+    return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
+}
+
+#ifdef ODS_PEAK_GROUPING_STAGED
+/**
+ *  @b Description
+ *  @n
+ *    Starts the transfer of one detection matrix row into a slot of
+ *    peakGroupRows.
+ */
+static void OdsDemo_peakGroupFetchRow(OdsDemo_DSS_DataPathObj *obj, uint32_t row, uint32_t slot)
+{
+    EDMAutil_triggerType3(obj->context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+        (uint8_t *)(&obj->detMatrix[row * obj->numDopplerBins]),
+        (uint8_t *)(SOC_translateAddress((uint32_t)(&obj->peakGroupRows[slot * obj->numDopplerBins]),
+                                         SOC_TranslateAddr_Dir_TO_EDMA,NULL)),
+        (uint8_t) ODS_EDMA_CH_DET_MATRIX3,
+        (uint8_t) ODS_EDMA_TRIGGER_ENABLE);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    First and last detection matrix row the peak grouping compares the
+ *    detections of range bin rangeIdx to. A row the kernel of
+ *    OdsDemo_cfarPeakGrouping leaves out (zero) is replaced by the row of the
+ *    detection: its centre is not greater than the detection and its other
+ *    two cells are compared anyway whenever the diagonal cells are.
+ */
+static inline void OdsDemo_peakGroupRowSpan(uint32_t rangeIdx, uint32_t numRangeBins,
+                                            uint32_t minRangeIdx, uint32_t maxRangeIdx,
+                                            uint32_t *rowFirst, uint32_t *rowLast)
+{
+    *rowFirst = (rangeIdx > minRangeIdx) ? (rangeIdx - 1) : rangeIdx;
+    *rowLast = (((rangeIdx + 1) >= numRangeBins) ||
+                ((rangeIdx == maxRangeIdx) && (rangeIdx != minRangeIdx))) ? rangeIdx : (rangeIdx + 1);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Detection matrix based peak grouping with the same output as
+ *    OdsDemo_cfarPeakGrouping, reading the detection matrix by rows instead
+ *    of by kernels. The detections between minRangeIdx and maxRangeIdx are
+ *    sorted by range bin (counting sort into peakGroupOrder) and the range
+ *    bins holding detections are visited in increasing order. The detection
+ *    matrix rows are streamed into a ring of ODS_PEAK_GROUP_NUM_ROW_SLOTS
+ *    rows in L2, each row once: while the detections of a range bin are
+ *    compared to their neighbours, the first row the next range bin needs is
+ *    brought in by EDMA, which for adjacent range bins is the only new row.
+ *    The outcome is kept per detection and the output list is written in
+ *    CFAR order at the end, so the limit of maxNumDetObj keeps the same
+ *    objects.
+ *
+ *  @param[in,out] obj                Pointer to data path object, detObj2DRaw
+ *                                    in, detObj2D out
+ *  @param[in]     numDetectedObjects Number of detected objects by CFAR
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGroupingStaged(OdsDemo_DSS_DataPathObj *obj, uint32_t numDetectedObjects)
+{
+    OdsDemo_objRaw_t *objRaw = obj->detObj2DRaw;
+    uint16_t *rangeEnd = obj->peakGroupRangeEnd;
+    uint16_t *order = obj->peakGroupOrder;
+    uint32_t *keep = obj->peakGroupKeep;
+    uint32_t numDopplerBins = obj->numDopplerBins;
+    uint32_t maxRangeIdx = obj->cliCfg->peakGroupingCfg.maxRangeIndex;
+    uint32_t minRangeIdx = obj->cliCfg->peakGroupingCfg.minRangeIndex;
+    uint32_t groupInDopplerDirection = obj->cliCfg->peakGroupingCfg.inDopplerDirectionEn;
+    uint32_t groupInRangeDirection = obj->cliCfg->peakGroupingCfg.inRangeDirectionEn;
+    uint32_t i, rangeIdx, nextRangeIdx, row, rowFirst, rowLast;
+    uint32_t numRowsFetched = 0;    /* rows are kept in slot (fetch count % slots) */
+    int32_t lastRowFetched = -1;
+    uint32_t rowPending = 0;
+    uint32_t numObjOut = 0;
+    uint16_t *prevRow, *curRow, *nextRow;
+
+/* Slot of a fetched row, rows are fetched in increasing order */
+#define PEAK_GROUP_ROW(_row) (&obj->peakGroupRows[((numRowsFetched - 1 - (lastRowFetched - (int32_t) (_row))) & \
+                                                   (ODS_PEAK_GROUP_NUM_ROW_SLOTS - 1)) * numDopplerBins])
+
+    if ((groupInDopplerDirection == 0) && (groupInRangeDirection == 0))
+    {
+        /* No grouping, the detection matrix is not read */
+        return OdsDemo_cfarPeakGrouping(obj->detObj2D, objRaw, numDetectedObjects, obj->detMatrix,
+                                        numDopplerBins, maxRangeIdx, minRangeIdx, 0, 0,
+                                        obj->maxNumDetObj, &obj->numDetObjDropped);
+    }
+
+    if (maxRangeIdx >= obj->numRangeBins)
+    {
+        maxRangeIdx = obj->numRangeBins - 1;
+    }
+
+    /* Counting sort of the detections in the range limits by range bin. After
+       the scatter rangeEnd[r] is the end of the detections of range bin r in
+       order, which are preceded by those of range bin r - 1. */
+    memset((void *) rangeEnd, 0, (obj->numRangeBins + 1) * sizeof(uint16_t));
+    for (i = 0; i < numDetectedObjects; i++)
+    {
+        rangeIdx = objRaw[i].rangeIdx;
+        if ((rangeIdx <= maxRangeIdx) && (rangeIdx >= minRangeIdx))
+        {
+            rangeEnd[rangeIdx + 1]++;
         }
-        if (numObjOut >= MMW_MAX_OBJ_OUT)
+    }
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        rangeEnd[rangeIdx + 1] += rangeEnd[rangeIdx];
+    }
+    for (i = 0; i < numDetectedObjects; i++)
+    {
+        rangeIdx = objRaw[i].rangeIdx;
+        if ((rangeIdx <= maxRangeIdx) && (rangeIdx >= minRangeIdx))
         {
-            break;
+            order[rangeEnd[rangeIdx]++] = (uint16_t) i;
+        }
+    }
+    memset((void *) keep, 0, ((numDetectedObjects + 31) >> 5) * sizeof(uint32_t));
+
+    /* First range bin with detections */
+    rangeIdx = minRangeIdx;
+    while ((rangeIdx <= maxRangeIdx) &&
+           (rangeEnd[rangeIdx] == ((rangeIdx > 0) ? rangeEnd[rangeIdx - 1] : 0)))
+    {
+        rangeIdx++;
+    }
+
+    while (rangeIdx <= maxRangeIdx)
+    {
+        /* Wait for the row brought in ahead, then fetch the rows of this
+           range bin still missing, only after range bins without detections */
+        if (rowPending)
+        {
+            OdsDemo_dataPathWaitTransPeakGroupRows(obj);
+            rowPending = 0;
+        }
+        OdsDemo_peakGroupRowSpan(rangeIdx, obj->numRangeBins, minRangeIdx, maxRangeIdx, &rowFirst, &rowLast);
+        for (row = MAX((int32_t) rowFirst, lastRowFetched + 1); row <= rowLast; row++)
+        {
+            OdsDemo_peakGroupFetchRow(obj, row, numRowsFetched & (ODS_PEAK_GROUP_NUM_ROW_SLOTS - 1));
+            numRowsFetched++;
+            lastRowFetched = (int32_t) row;
+            OdsDemo_dataPathWaitTransPeakGroupRows(obj);
+        }
+        prevRow = PEAK_GROUP_ROW(rowFirst);
+        curRow = PEAK_GROUP_ROW(rangeIdx);
+        nextRow = PEAK_GROUP_ROW(rowLast);
+
+        /* Next range bin with detections, its first row not held yet goes
+           to the slot after the (at most three) rows in use */
+        nextRangeIdx = rangeIdx + 1;
+        while ((nextRangeIdx <= maxRangeIdx) && (rangeEnd[nextRangeIdx] == rangeEnd[nextRangeIdx - 1]))
+        {
+            nextRangeIdx++;
+        }
+        if (nextRangeIdx <= maxRangeIdx)
+        {
+            OdsDemo_peakGroupRowSpan(nextRangeIdx, obj->numRangeBins, minRangeIdx, maxRangeIdx,
+                                     &rowFirst, &rowLast);
+            row = MAX((int32_t) rowFirst, lastRowFetched + 1);
+            if (row <= rowLast)
+            {
+                OdsDemo_peakGroupFetchRow(obj, row, numRowsFetched & (ODS_PEAK_GROUP_NUM_ROW_SLOTS - 1));
+                numRowsFetched++;
+                lastRowFetched = (int32_t) row;
+                rowPending = 1;
+            }
+        }
+
+        for (i = ((rangeIdx > 0) ? rangeEnd[rangeIdx - 1] : 0); i < rangeEnd[rangeIdx]; i++)
+        {
+            uint32_t objIdx = order[i];
+            uint32_t dopplerIdx = objRaw[objIdx].dopplerIdx;
+            uint32_t dopplerIdxL = (dopplerIdx == 0) ? (numDopplerBins - 1) : (dopplerIdx - 1);
+            uint32_t dopplerIdxR = (dopplerIdx == (numDopplerBins - 1)) ? 0 : (dopplerIdx + 1);
+            uint16_t peak = curRow[dopplerIdx];
+            uint32_t rangeNbr, dopplerNbr, diagNbr, detectedObjFlag;
+
+            /* Compare the detected object to its neighbors */
+            rangeNbr = (prevRow[dopplerIdx] > peak) | (nextRow[dopplerIdx] > peak);
+            dopplerNbr = (curRow[dopplerIdxL] > peak) | (curRow[dopplerIdxR] > peak);
+            diagNbr = (prevRow[dopplerIdxL] > peak) | (prevRow[dopplerIdxR] > peak) |
+                      (nextRow[dopplerIdxL] > peak) | (nextRow[dopplerIdxR] > peak);
+            detectedObjFlag = 1 ^ ((rangeNbr & groupInRangeDirection) |
+                                   (dopplerNbr & groupInDopplerDirection) |
+                                   (diagNbr & groupInRangeDirection & groupInDopplerDirection));
+            keep[objIdx >> 5] |= detectedObjFlag << (objIdx & 31);
         }
 
+        rangeIdx = nextRangeIdx;
+    }
+#undef PEAK_GROUP_ROW
+
+    /* Output in CFAR order */
+    obj->numDetObjDropped = 0;
+    for (i = 0; i < numDetectedObjects; i++)
+    {
+        if ((keep[i >> 5] >> (i & 31)) & 1)
+        {
+            numObjOut = OdsDemo_detObjAdd(obj->detObj2D, numObjOut, obj->maxNumDetObj, &obj->numDetObjDropped,
+                                          numDopplerBins, objRaw[i].rangeIdx, objRaw[i].dopplerIdx,
+                                          objRaw[i].peakVal);
+        }
     }
 
-    return(numObjOut);
+    return OdsDemo_detObjRestoreOrder(obj->detObj2D, numObjOut, obj->numDetObjDropped, numDopplerBins);
 }
+#endif
 
 
 /**
@@ -1869,6 +2759,9 @@ uint32_t OdsDemo_cfarPeakGrouping(
  *  @param[in]    minRangeIdx        Minimum range limit
  *  @param[in]    groupInDopplerDirection Flag enables grouping in Doppler directiuon
  *  @param[in]    groupInRangeDirection   Flag enables grouping in Range directiuon
+ *  @param[in]    maxNumObjOut       Size of objOut, the strongest objects are
+ *                                   kept when more peaks remain
+ *  @param[out]   numObjDropped      Number of peaks that did not fit in objOut
  *
  *  @retval
  *      Number of detected objects after grouping
@@ -1881,7 +2774,9 @@ uint32_t OdsDemo_cfarPeakGroupingCfarQualified(
                                 uint32_t maxRangeIdx,
                                 uint32_t minRangeIdx,
                                 uint32_t groupInDopplerDirection,
-                                uint32_t groupInRangeDirection)
+                                uint32_t groupInRangeDirection,
+                                uint32_t maxNumObjOut,
+                                uint32_t *numObjDropped)
 {
     int32_t i;
     uint32_t numObjOut = 0;
@@ -1895,6 +2790,7 @@ uint32_t OdsDemo_cfarPeakGroupingCfarQualified(
 #define WRAP_DWN_LIST_IDX(_x) ((_x) >= numDetectedObjects ? ((_x) - numDetectedObjects) : (_x))
 #define WRAP_UP_LIST_IDX(_x) ((_x) < 0 ? ((_x) + numDetectedObjects) : (_x))
 
+    *numObjDropped = 0;
     if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 1))
     {
         /* Grouping both in Range and Doppler direction */
@@ -1919,17 +2815,15 @@ uint32_t OdsDemo_cfarPeakGroupingCfarQualified(
     else
     {
         /* No grouping, copy all detected objects to the output matrix */
-        for(i = 0; i < MIN(numDetectedObjects, MMW_MAX_OBJ_OUT) ; i++)
+        for(i = 0; i < numDetectedObjects; i++)
         {
             if ((objRaw[i].rangeIdx <= maxRangeIdx) && ((objRaw[i].rangeIdx >= minRangeIdx)))
             {
-                objOut[numObjOut].rangeIdx = objRaw[i].rangeIdx;;
-                objOut[numObjOut].dopplerIdx = DOPPLER_IDX_TO_SIGNED(objRaw[i].dopplerIdx, numDopplerBins);
-                objOut[numObjOut].peakVal = objRaw[i].peakVal;
-                numObjOut++;
+                numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                              objRaw[i].rangeIdx, objRaw[i].dopplerIdx, objRaw[i].peakVal);
             }
         }
-        return numObjOut;
+        return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
     }
 
     /* Start checking  */
@@ -2030,50 +2924,265 @@ uint32_t OdsDemo_cfarPeakGroupingCfarQualified(
         }
         if(detectedObjFlag == 1)
         {
-            objOut[numObjOut].rangeIdx = rangeIdx;
-            objOut[numObjOut].dopplerIdx = DOPPLER_IDX_TO_SIGNED(dopplerIdx, numDopplerBins);
-            objOut[numObjOut].peakVal = peakVal;
-            numObjOut++;
-        }
-        if (numObjOut >= MMW_MAX_OBJ_OUT)
-        {
-            break;
+            numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                          rangeIdx, dopplerIdx, peakVal);
         }
     }
 
-    return(numObjOut);
+    return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
 }
 
 /**
  *  @b Description
  *  @n
- *    Outputs magnitude squared float array of input complex32 array
- *
- *  @retval
- *      Not Applicable.
+ *    Returns the end of the run of CFAR detections that share the Doppler
+ *    line of objRaw[start].
  */
-void OdsDemo_magnitudeSquared(cmplx32ReIm_t * restrict inpBuff, float * restrict magSqrdBuff, uint32_t numSamples)
+static inline uint32_t OdsDemo_cfarDopplerLineEnd(OdsDemo_objRaw_t * objRaw,
+                                                  uint32_t start,
+                                                  uint32_t numDetectedObjects)
 {
-    uint32_t i;
-    for (i = 0; i < numSamples; i++)
+    uint32_t end = start + 1;
+
+    while ((end < numDetectedObjects) && (objRaw[end].dopplerIdx == objRaw[start].dopplerIdx))
     {
-        magSqrdBuff[i] = (float) inpBuff[i].real * (float) inpBuff[i].real +
-                (float) inpBuff[i].imag * (float) inpBuff[i].imag;
+        end++;
     }
+    return end;
 }
 
-
-#define pingPongId(x) ((x) & 0x1U)
-#define isPong(x) (pingPongId(x))
-
 /**
  *  @b Description
  *  @n
- *    Compensation of DC range antenna signature
- *    
+ *    Same grouping as OdsDemo_cfarPeakGroupingCfarQualified, with the
+ *    neighbours located through the order of the CFAR detections instead of
+ *    walks along the list. The list holds the detections of a Doppler line
+ *    after those of the previous lines and in increasing range within a
+ *    line, which is how the detection chain produces it and what the walks
+ *    of OdsDemo_cfarPeakGroupingCfarQualified rely on. Each Doppler line is
+ *    then a run of the list, and the neighbouring lines are the runs just
+ *    before and after it, the last and the first run wrapping around. A
+ *    cursor into each neighbouring run follows the range of the peak under
+ *    test, so all neighbours are found in O(numDetectedObjects) steps
+ *    instead of O(numDetectedObjects) steps per peak. The output is the
+ *    same as the one of OdsDemo_cfarPeakGroupingCfarQualified.
+ *
+ *  @param[out]   objOut             Output array of  detected objects after peak grouping
+ *  @param[in]    objRaw             Array of detected objects after CFAR detection
+ *  @param[in]    numDetectedObjects Number of detected objects by CFAR
+ *  @param[in]    numDopplerBins     Number of Doppler bins
+ *  @param[in]    maxRangeIdx        Maximum range limit
+ *  @param[in]    minRangeIdx        Minimum range limit
+ *  @param[in]    groupInDopplerDirection Flag enables grouping in Doppler directiuon
+ *  @param[in]    groupInRangeDirection   Flag enables grouping in Range directiuon
+ *  @param[in]    maxNumObjOut       Size of objOut, the strongest objects are
+ *                                   kept when more peaks remain
+ *  @param[out]   numObjDropped      Number of peaks that did not fit in objOut
  *
  *  @retval
- *      Not Applicable.
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGroupingCfarQualifiedIndexed(
+                                OdsDemo_detectedObj*  objOut,
+                                OdsDemo_objRaw_t * objRaw,
+                                uint32_t numDetectedObjects,
+                                uint32_t numDopplerBins,
+                                uint32_t maxRangeIdx,
+                                uint32_t minRangeIdx,
+                                uint32_t groupInDopplerDirection,
+                                uint32_t groupInRangeDirection,
+                                uint32_t maxNumObjOut,
+                                uint32_t *numObjDropped)
+{
+    uint32_t i, k;
+    uint32_t numObjOut = 0;
+    uint32_t rangeIdx, dopplerIdx, peakVal;
+    uint16_t kernel[9], detectedObjFlag;
+    uint32_t startInd, stepInd, endInd;
+    uint32_t lineStart, lineEnd, prevStart, prevEnd, nextStart, nextEnd, firstEnd;
+    uint32_t left, leftEnd, right, rightEnd;
+
+    *numObjDropped = 0;
+    if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 1))
+    {
+        /* Grouping both in Range and Doppler direction */
+        startInd = 0;
+        stepInd = 1;
+        endInd = 8;
+    }
+    else if ((groupInDopplerDirection == 0) && (groupInRangeDirection == 1))
+    {
+        /* Grouping only in Range direction */
+        startInd = 1;
+        stepInd = 3;
+        endInd = 7;
+    }
+    else if ((groupInDopplerDirection == 1) && (groupInRangeDirection == 0))
+    {
+        /* Grouping only in Doppler direction */
+        startInd = 3;
+        stepInd = 1;
+        endInd = 5;
+    }
+    else
+    {
+        /* No grouping, copy all detected objects to the output matrix */
+        for(i = 0; i < numDetectedObjects; i++)
+        {
+            if ((objRaw[i].rangeIdx <= maxRangeIdx) && ((objRaw[i].rangeIdx >= minRangeIdx)))
+            {
+                numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                              objRaw[i].rangeIdx, objRaw[i].dopplerIdx, objRaw[i].peakVal);
+            }
+        }
+        return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
+    }
+
+    if (numDetectedObjects == 0)
+    {
+        return 0;
+    }
+
+    /* The line before the first one is the last one */
+    prevEnd = numDetectedObjects;
+    prevStart = prevEnd - 1;
+    while ((prevStart > 0) && (objRaw[prevStart - 1].dopplerIdx == objRaw[prevEnd - 1].dopplerIdx))
+    {
+        prevStart--;
+    }
+    firstEnd = OdsDemo_cfarDopplerLineEnd(objRaw, 0, numDetectedObjects);
+
+    for (lineStart = 0, lineEnd = firstEnd; lineStart < numDetectedObjects;
+         lineStart = nextStart, lineEnd = nextEnd)
+    {
+        dopplerIdx = objRaw[lineStart].dopplerIdx;
+
+        /* The line after the last one is the first one */
+        if (lineEnd < numDetectedObjects)
+        {
+            nextStart = lineEnd;
+            nextEnd = OdsDemo_cfarDopplerLineEnd(objRaw, lineEnd, numDetectedObjects);
+            right = nextStart;
+            rightEnd = nextEnd;
+        }
+        else
+        {
+            nextStart = numDetectedObjects;
+            nextEnd = numDetectedObjects;
+            right = 0;
+            rightEnd = firstEnd;
+        }
+
+        /* Neighbouring runs that are not the neighbouring Doppler lines
+           hold no neighbours */
+        left = prevStart;
+        leftEnd = prevEnd;
+        if (objRaw[left].dopplerIdx != ((dopplerIdx - 1) & (numDopplerBins - 1)))
+        {
+            leftEnd = left;
+        }
+        if (objRaw[right].dopplerIdx != ((dopplerIdx + 1) & (numDopplerBins - 1)))
+        {
+            rightEnd = right;
+        }
+
+        for (i = lineStart; i < lineEnd; i++)
+        {
+            detectedObjFlag = 0;
+            rangeIdx = objRaw[i].rangeIdx;
+            peakVal = objRaw[i].peakVal;
+
+            /* Skip the neighbours more than a range bin below the peak */
+            while ((left < leftEnd) && ((objRaw[left].rangeIdx + 1) < rangeIdx))
+            {
+                left++;
+            }
+            while ((right < rightEnd) && ((objRaw[right].rangeIdx + 1) < rangeIdx))
+            {
+                right++;
+            }
+
+            if((rangeIdx <= maxRangeIdx) && (rangeIdx >= minRangeIdx))
+            {
+                detectedObjFlag = 1;
+                memset((void *) kernel, 0, 9*sizeof(uint16_t));
+
+                /* Fill the middle column of the kernel */
+                kernel[4] = peakVal;
+                if ((i > lineStart) && (objRaw[i-1].rangeIdx == (rangeIdx-1)))
+                {
+                    kernel[1] = objRaw[i-1].peakVal;
+                }
+                if ((i < (lineEnd - 1)) && (objRaw[i+1].rangeIdx == (rangeIdx+1)))
+                {
+                    kernel[7] = objRaw[i+1].peakVal;
+                }
+
+                /* Fill the left and the right column of the kernel, range
+                   bins rangeIdx-1 to rangeIdx+1 to rows 0 to 2 */
+                for (k = left; (k < leftEnd) && (objRaw[k].rangeIdx <= (rangeIdx + 1)); k++)
+                {
+                    kernel[3 * (objRaw[k].rangeIdx + 1 - rangeIdx)] = objRaw[k].peakVal;
+                }
+                for (k = right; (k < rightEnd) && (objRaw[k].rangeIdx <= (rangeIdx + 1)); k++)
+                {
+                    kernel[3 * (objRaw[k].rangeIdx + 1 - rangeIdx) + 2] = objRaw[k].peakVal;
+                }
+
+                /* Compare the detected object to its neighbors.
+                 * Detected object is at index 4*/
+                for (k = startInd; k <= endInd; k += stepInd)
+                {
+                    if(kernel[k] > kernel[4])
+                    {
+                        detectedObjFlag = 0;
+                    }
+                }
+            }
+            if(detectedObjFlag == 1)
+            {
+                numObjOut = OdsDemo_detObjAdd(objOut, numObjOut, maxNumObjOut, numObjDropped, numDopplerBins,
+                                              rangeIdx, dopplerIdx, peakVal);
+            }
+        }
+
+        prevStart = lineStart;
+        prevEnd = lineEnd;
+    }
+
+    return OdsDemo_detObjRestoreOrder(objOut, numObjOut, *numObjDropped, numDopplerBins);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Outputs magnitude squared float array of input complex32 array
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_magnitudeSquared(cmplx32ReIm_t * restrict inpBuff, float * restrict magSqrdBuff, uint32_t numSamples)
+{
+    uint32_t i;
+    for (i = 0; i < numSamples; i++)
+    {
+        magSqrdBuff[i] = (float) inpBuff[i].real * (float) inpBuff[i].real +
+                (float) inpBuff[i].imag * (float) inpBuff[i].imag;
+    }
+}
+
+
+#define pingPongId(x) ((x) & 0x1U)
+#define isPong(x) (pingPongId(x))
+
+/**
+ *  @b Description
+ *  @n
+ *    Compensation of DC range antenna signature
+ *    
+ *
+ *  @retval
+ *      Not Applicable.
  */
 void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t chirpPingPongId)
 {
@@ -2081,6 +3190,8 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
     uint32_t ind;
     int32_t chirpPingPongOffs;
     int32_t chirpPingPongSize;
+    uint32_t blockExp = 0;
+    int32_t blockRnd = 0;
     OdsDemo_CalibDcRangeSigCfg *calibDcCfg = &obj->cliCfg->calibDcRangeSigCfg;
 
     chirpPingPongSize = obj->numRxAntennas * (calibDcCfg->positiveBinIdx - calibDcCfg->negativeBinIdx + 1);
@@ -2100,6 +3211,11 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
         {
             uint32_t chirpInOffs = chirpPingPongId * (obj->numRxAntennas * obj->numRangeBins) + 
                                   (obj->numRangeBins * rxAntIdx);
+            /* the mean is in fixed point units */
+            if (obj->radarCubeExp != NULL)
+            {
+                blockExp = obj->rangeFftExp[rxAntIdx];
+            }
             int64_t *meanPtr = (int64_t *) &obj->dcRangeSigMean[chirpPingPongOffs];
             uint32_t *fftPtr =  (uint32_t *) &obj->fftOut1D[chirpInOffs];
             int64_t meanBin;
@@ -2109,8 +3225,8 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
             {
                 meanBin = _amem8(&meanPtr[ind]);
                 fftBin = _amem4(&fftPtr[binIdx]);
-                Im = _loll(meanBin) + _ext(fftBin, 0, 16);
-                Re = _hill(meanBin) + _ext(fftBin, 16, 16);
+                Im = _loll(meanBin) + (_ext(fftBin, 0, 16) << blockExp);
+                Re = _hill(meanBin) + (_ext(fftBin, 16, 16) << blockExp);
                 _amem8(&meanPtr[ind]) = _itoll(Re, Im);
                 ind++;
             }
@@ -2122,8 +3238,8 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
             {
                 meanBin = _amem8(&meanPtr[ind]);
                 fftBin = _amem4(&fftPtr[binIdx]);
-                Im = _loll(meanBin) + _ext(fftBin, 0, 16);
-                Re = _hill(meanBin) + _ext(fftBin, 16, 16);
+                Im = _loll(meanBin) + (_ext(fftBin, 0, 16) << blockExp);
+                Re = _hill(meanBin) + (_ext(fftBin, 16, 16) << blockExp);
                 _amem8(&meanPtr[ind]) = _itoll(Re, Im);
                 ind++;
             }
@@ -2154,6 +3270,12 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
         {
             uint32_t chirpInOffs = chirpPingPongId * (obj->numRxAntennas * obj->numRangeBins) + 
                                    (obj->numRangeBins * rxAntIdx);
+            /* the mean is in fixed point units */
+            if (obj->radarCubeExp != NULL)
+            {
+                blockExp = obj->rangeFftExp[rxAntIdx];
+                blockRnd = (1 << blockExp) >> 1;
+            }
             int64_t *meanPtr = (int64_t *) &obj->dcRangeSigMean[chirpPingPongOffs];
             uint32_t *fftPtr =  (uint32_t *) &obj->fftOut1D[chirpInOffs];
             int64_t meanBin;
@@ -2163,8 +3285,8 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
             {
                 meanBin = _amem8(&meanPtr[ind]);
                 fftBin = _amem4(&fftPtr[binIdx]);
-                Im = _ext(fftBin, 0, 16) - _loll(meanBin);
-                Re = _ext(fftBin, 16, 16) - _hill(meanBin);
+                Im = _ext(fftBin, 0, 16) - ((_loll(meanBin) + blockRnd) >> blockExp);
+                Re = _ext(fftBin, 16, 16) - ((_hill(meanBin) + blockRnd) >> blockExp);
                 _amem4(&fftPtr[binIdx]) = _pack2(Im, Re);
                 ind++;
             }
@@ -2176,8 +3298,8 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
             {
                 meanBin = _amem8(&meanPtr[ind]);
                 fftBin = _amem4(&fftPtr[binIdx]);
-                Im = _ext(fftBin, 0, 16) - _loll(meanBin);
-                Re = _ext(fftBin, 16, 16) - _hill(meanBin);
+                Im = _ext(fftBin, 0, 16) - ((_loll(meanBin) + blockRnd) >> blockExp);
+                Re = _ext(fftBin, 16, 16) - ((_hill(meanBin) + blockRnd) >> blockExp);
                 _amem4(&fftPtr[binIdx]) = _pack2(Im, Re);
                 //_amem4(&fftPtr[binIdx]) = _packh2(_sshvl(Im,16) , _sshvl(Re, 16));
                 ind++;
@@ -2187,6 +3309,68 @@ void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t
 }
 
 
+/**
+ *  @b Description
+ *  @n
+ *    Stores the block exponents of the current chirp next to the radar cube
+ *    and updates the bit growth statistics of the frame. For the packed radar
+ *    cube the packing exponents are already in place and the range FFT
+ *    exponents are added to them.
+ *
+ *  @param[in]  obj             Pointer to data path object
+ *  @param[in]  chirpPingPongId Ping/pong id of the chirp
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_radarCubeBfpStoreExp(OdsDemo_DSS_DataPathObj *obj, uint8_t chirpPingPongId)
+{
+    OdsDemo_radarCubeBfpStats *stats = &obj->radarCubeBfpStats;
+    uint32_t numBlocks = obj->radarCubeExpNumBlocks;
+    uint8_t *chirpExp = &obj->radarCubeExp[obj->txAntennaCount * obj->numRxAntennas * numBlocks *
+                                           obj->numDopplerBins + obj->dopplerBinCount];
+    uint32_t rxAntIdx, blockIdx, expIdx;
+    uint8_t blockExp;
+
+    if (obj->chirpCount == 0)
+    {
+        stats->expMin = 0xFF;
+        stats->expMax = 0;
+        stats->numScaledBlocks = 0;
+    }
+
+    if (obj->radarCubePacked)
+    {
+        OdsDemo_radarCubePack(&obj->fftOut1D[chirpPingPongId * (obj->numRxAntennas * obj->numRangeBins)],
+                              obj->numRxAntennas * obj->numRangeBins, obj->radarCubeExpBlockShift,
+                              chirpExp, obj->numDopplerBins);
+    }
+
+    for (expIdx = 0; expIdx < obj->numRxAntennas * numBlocks; expIdx++)
+    {
+        rxAntIdx = expIdx / numBlocks;
+        blockIdx = expIdx * obj->numDopplerBins;
+        blockExp = obj->rangeFftExp[rxAntIdx];
+        if (obj->radarCubePacked)
+        {
+            blockExp += chirpExp[blockIdx];
+        }
+        chirpExp[blockIdx] = blockExp;
+        if (blockExp < stats->expMin)
+        {
+            stats->expMin = blockExp;
+        }
+        if (blockExp > stats->expMax)
+        {
+            stats->expMax = blockExp;
+        }
+        if (blockExp > 0)
+        {
+            stats->numScaledBlocks++;
+        }
+    }
+}
+
 /**
  *  @b Description
  *  @n
@@ -2202,50 +3386,119 @@ void OdsDemo_interChirpProcessing(OdsDemo_DSS_DataPathObj *obj, uint8_t chirpPin
     volatile uint32_t startTime;
     volatile uint32_t startTime1;
     OdsDemo_DSS_dataPathContext_t *context = obj->context;
+    cmplx16ReIm_t *fftOut = &obj->fftOut1D[chirpPingPongId * (obj->numRxAntennas * obj->numRangeBins)];
 
     waitingTime = 0;
     startTime = Cycleprofiler_getTimeStamp();
 
-    /* Kick off DMA to fetch data from ADC buffer for first channel */
-    EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-                       ODS_EDMA_CH_1D_IN_PING);
+    if (obj->rangeFftBatch)
+    {
+        /* one transfer and one transform for all antennas */
+        EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                           ODS_EDMA_CH_1D_IN_PING);
+
+        startTime1 = Cycleprofiler_getTimeStamp();
+        OdsDemo_dataPathWait1DInputData (obj, 0);
+        waitingTime += Cycleprofiler_getTimeStamp() - startTime1;
 
-    /* 1d fft for first antenna, followed by kicking off the DMA of fft output */
-    for (antIndx = 0; antIndx < obj->numRxAntennas; antIndx++)
+        if (obj->radarCubeExp != NULL)
+        {
+            OdsDemo_rangeFftWin16x16BatchBfp(
+                    obj->adcDataIn,
+                    obj->numRxAntennas,
+                    obj->window1D,
+                    obj->numAdcSamples,
+                    obj->twiddleRangeFft,
+                    obj->rangeFftScratch,
+                    obj->numRangeBins,
+                    fftOut,
+                    obj->numRangeBins,
+                    obj->rangeFftExp);
+        }
+        else
+        {
+            OdsDemo_rangeFftWin16x16Batch(
+                    obj->adcDataIn,
+                    obj->numRxAntennas,
+                    obj->window1D,
+                    obj->numAdcSamples,
+                    obj->twiddleRangeFft,
+                    obj->rangeFftScratch,
+                    obj->numRangeBins,
+                    fftOut,
+                    obj->numRangeBins);
+        }
+    }
+    else
     {
-        /* kick off DMA to fetch data for next antenna */
-        if (antIndx < (obj->numRxAntennas - 1))
+        /* Kick off DMA to fetch data from ADC buffer for first channel */
+        EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                           ODS_EDMA_CH_1D_IN_PING);
+
+        /* 1d fft for first antenna, followed by kicking off the DMA of fft output */
+        for (antIndx = 0; antIndx < obj->numRxAntennas; antIndx++)
         {
-            if (isPong(antIndx))
+            /* kick off DMA to fetch data for next antenna */
+            if (antIndx < (obj->numRxAntennas - 1))
+            {
+                if (isPong(antIndx))
+                {
+                    EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                            ODS_EDMA_CH_1D_IN_PING);
+                }
+                else
+                {
+                    EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                            ODS_EDMA_CH_1D_IN_PONG);
+                }
+            }
+
+            /* verify if DMA has completed for current antenna */
+            startTime1 = Cycleprofiler_getTimeStamp();
+            OdsDemo_dataPathWait1DInputData (obj, pingPongId(antIndx));
+            waitingTime += Cycleprofiler_getTimeStamp() - startTime1;
+
+            if ((obj->radarCubeExp != NULL) && (obj->rangeFftScratch != NULL))
+            {
+                /* block floating point output, exponent per antenna */
+                OdsDemo_rangeFftWin16x16Bfp(
+                        &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
+                        obj->window1D,
+                        obj->numAdcSamples,
+                        obj->twiddleRangeFft,
+                        obj->rangeFftScratch,
+                        obj->numRangeBins,
+                        &fftOut[obj->numRangeBins * antIndx],
+                        &obj->rangeFftExp[antIndx]);
+            }
+            else if (obj->rangeFftScratch != NULL)
             {
-                EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-                        ODS_EDMA_CH_1D_IN_PING);
+                /* windowing and zero padding are done by the first FFT stage */
+                OdsDemo_rangeFftWin16x16(
+                        &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
+                        obj->window1D,
+                        obj->numAdcSamples,
+                        obj->twiddleRangeFft,
+                        obj->rangeFftScratch,
+                        obj->numRangeBins,
+                        &fftOut[obj->numRangeBins * antIndx]);
             }
             else
             {
-                EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-                        ODS_EDMA_CH_1D_IN_PONG);
+                mmwavelib_windowing16x16_evenlen(
+                        (int16_t *) &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
+                        (int16_t *) obj->window1D,
+                        obj->numAdcSamples);
+                memset((void *)&obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins + obj->numAdcSamples], 
+                    0 , (obj->numRangeBins - obj->numAdcSamples) * sizeof(cmplx16ReIm_t));
+                DSP_fft16x16(
+                        (int16_t *) obj->twiddle16x16_1D,
+                        obj->numRangeBins,
+                        (int16_t *) &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
+                        (int16_t *) &fftOut[obj->numRangeBins * antIndx]);
             }
-        }
-
-        /* verify if DMA has completed for current antenna */
-        startTime1 = Cycleprofiler_getTimeStamp();
-        OdsDemo_dataPathWait1DInputData (obj, pingPongId(antIndx));
-        waitingTime += Cycleprofiler_getTimeStamp() - startTime1;
-
-        mmwavelib_windowing16x16_evenlen(
-                (int16_t *) &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
-                (int16_t *) obj->window1D,
-                obj->numAdcSamples);
-        memset((void *)&obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins + obj->numAdcSamples], 
-            0 , (obj->numRangeBins - obj->numAdcSamples) * sizeof(cmplx16ReIm_t));
-        DSP_fft16x16(
-                (int16_t *) obj->twiddle16x16_1D,
-                obj->numRangeBins,
-                (int16_t *) &obj->adcDataIn[pingPongId(antIndx) * obj->numRangeBins],
-                (int16_t *) &obj->fftOut1D[chirpPingPongId * (obj->numRxAntennas * obj->numRangeBins) +
-                    (obj->numRangeBins * antIndx)]);
 
+        }
     }
 
     if(obj->cliCfg->calibDcRangeSigCfg.enabled)
@@ -2253,10 +3506,61 @@ void OdsDemo_interChirpProcessing(OdsDemo_DSS_DataPathObj *obj, uint8_t chirpPin
         OdsDemo_dcRangeSignatureCompensation(obj, chirpPingPongId);
     }
 
+    if (obj->radarCubeExp != NULL)
+    {
+        OdsDemo_radarCubeBfpStoreExp(obj, chirpPingPongId);
+    }
+
     gCycleLog.interChirpProcessingTime += Cycleprofiler_getTimeStamp() - startTime - waitingTime;
     gCycleLog.interChirpWaitTime += waitingTime;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Doppler compensation coefficient of a Doppler bin, the rotation by half
+ *      of the Doppler phase shift of the bin.
+ *
+ *  @param[in]  dopplerIdx             Doppler index
+ *  @param[in]  numDopplerBins         Number of Doppler bins
+ *  @param[in]  azimuthModCoefs        exp(1j*2*pi*k/N) table, see @ref OdsDemo_addDopplerCompensation
+ *  @param[in]  azimuthModCoefsHalfBin exp(1j*2*pi* 0.5 /N)
+ *
+ *  @retval
+ *      Coefficient, (sin, cos) pair
+ */
+static inline uint32_t OdsDemo_dopplerCompCoef(int32_t dopplerIdx,
+                                               int32_t numDopplerBins,
+                                               uint32_t *azimuthModCoefs,
+                                               uint32_t *azimuthModCoefsHalfBin)
+{
+    uint32_t expDoppComp;
+    int32_t dopplerCompensationIdx = dopplerIdx;
+
+    /*Divide Doppler index by 2*/
+    if (dopplerCompensationIdx >= numDopplerBins/2)
+    {
+        dopplerCompensationIdx -=  (int32_t)numDopplerBins;
+    }
+    dopplerCompensationIdx = dopplerCompensationIdx / 2;
+    if (dopplerCompensationIdx < 0)
+    {
+        dopplerCompensationIdx +=  (int32_t) numDopplerBins;
+    }
+
+    // All these previous actions are to divide the index by two
+
+    expDoppComp = azimuthModCoefs[dopplerCompensationIdx];
+    /* Add half bin rotation if Doppler index was odd */
+    if (dopplerIdx & 0x1) // dopplerIdx & 1 is true when dopplerIdx is odd {1, 3, 5, 7, 9, 11, 13, 15}.
+    { // Explanation about why it is needed to add an extra half rotation: http://e2e.ti.com/support/sensors/f/1023/t/731771?AWR1642BOOST-DopplerCompensation-in-the-virtual-antennas-
+        // Basically it is used to correct the division. When the doppler index is 7, after halving it
+        // we end up with 3, which is not exactly half of 7. So we use half rotation to fix this.
+        expDoppComp = _cmpyr1(expDoppComp, *azimuthModCoefsHalfBin); // Why half? Why do we care if it is odd here?
+    }
+    return expDoppComp;
+}
+
 /*!*****************************************************************************************************************
  * \brief
  * Function Name       :    OdsDemo_DopplerCompensation
@@ -2295,7 +3599,6 @@ void OdsDemo_addDopplerCompensation(int32_t dopplerIdx, // First compensation it
                                     uint32_t numAnt)
 {
     uint32_t expDoppComp;
-    int32_t dopplerCompensationIdx = dopplerIdx;
     int64_t azimuthVal;
     int32_t Re, Im;
     uint32_t antIndx;
@@ -2305,27 +3608,7 @@ void OdsDemo_addDopplerCompensation(int32_t dopplerIdx, // First compensation it
         return;
     }
 
-    /*Divide Doppler index by 2*/
-    if (dopplerCompensationIdx >= numDopplerBins/2)
-    {
-        dopplerCompensationIdx -=  (int32_t)numDopplerBins;
-    }
-    dopplerCompensationIdx = dopplerCompensationIdx / 2;
-    if (dopplerCompensationIdx < 0)
-    {
-        dopplerCompensationIdx +=  (int32_t) numDopplerBins;
-    }
-
-    // All these previous actions are to divide the index by two
-
-    expDoppComp = azimuthModCoefs[dopplerCompensationIdx];
-    /* Add half bin rotation if Doppler index was odd */
-    if (dopplerIdx & 0x1) // dopplerIdx & 1 is true when dopplerIdx is odd {1, 3, 5, 7, 9, 11, 13, 15}.
-    { // Explanation about why it is needed to add an extra half rotation: http://e2e.ti.com/support/sensors/f/1023/t/731771?AWR1642BOOST-DopplerCompensation-in-the-virtual-antennas-
-        // Basically it is used to correct the division. When the doppler index is 7, after halving it
-        // we end up with 3, which is not exactly half of 7. So we use half rotation to fix this.
-        expDoppComp = _cmpyr1(expDoppComp, *azimuthModCoefsHalfBin); // Why half? Why do we care if it is odd here?
-    }
+    expDoppComp = OdsDemo_dopplerCompCoef(dopplerIdx, numDopplerBins, azimuthModCoefs, azimuthModCoefsHalfBin);
 
     /* Rotate symbols */
     for (antIndx = 0; antIndx < numAnt; antIndx++)
@@ -2428,20 +3711,177 @@ void OdsDemo_decodeBPM(cmplx32ReIm_t *azimuthIn, uint32_t numRxAnt)
     }
 }
 
-
 /**
  *  @b Description
  *  @n
- *    Computes log2Abs and accumulates for each dopple bin.
+ *    Doppler compensation of the Pong Doppler spectrum followed by the BPM
+ *    decoding of the Ping/Pong pair, over all Doppler bins in one pass:
+ *    A=S1+S2 (Ping), B=S1-S2 (Pong) are overwritten with S1=(A+B)/2 and
+ *    S2=(A-B)/2. Same result as @ref OdsDemo_addDopplerCompensation and
+ *    @ref OdsDemo_decodeBPM applied bin after bin.
+ *
+ * @param[in,out] bpmA              Ping Doppler spectrum, must be 64 bit aligned
+ * @param[in,out] bpmB              Pong Doppler spectrum, must be 64 bit aligned
+ * @param[in]     dopplerCompCoefs  Doppler compensation coefficient of each Doppler bin
+ * @param[in]     numDopplerBins    Number of Doppler bins
  *
  *  @retval
  *      Not Applicable.
  */
-void OdsDemo_log2AbsAccum(OdsDemo_DSS_DataPathObj *obj, int32_t rxAntIdx, uint32_t rangeIdx, uint32_t* waitingTime, uint32_t fftOutIndx)
+void OdsDemo_bpmDecodeDopplerComp(cmplx32ReIm_t * restrict bpmA,
+                                  cmplx32ReIm_t * restrict bpmB,
+                                  uint32_t * restrict dopplerCompCoefs,
+                                  uint32_t numDopplerBins)
 {
-    volatile uint32_t startTimeWait;
+    int64_t valA, valB;
+    int32_t reA, imA, Re, Im;
+    uint32_t expDoppComp;
     uint32_t idx;
-    
+
+    for (idx = 0; idx < numDopplerBins; idx++)
+    {
+        valA = _amem8(&bpmA[idx]);
+        valB = _amem8(&bpmB[idx]);
+        reA  = (int32_t) _loll(valA);
+        imA  = (int32_t) _hill(valA);
+        expDoppComp = _amem4(&dopplerCompCoefs[idx]);
+
+        /* rotate B */
+        Re = _ssub(_mpyhir(expDoppComp, _loll(valB)),
+                   _mpylir(expDoppComp, _hill(valB)));
+        Im = _sadd(_mpylir(expDoppComp, _loll(valB)),
+                   _mpyhir(expDoppComp, _hill(valB)));
+
+        /* S1 in A, S2 in B */
+        _amem8(&bpmA[idx]) = _itoll((imA + Im) / 2, (reA + Re) / 2);
+        _amem8(&bpmB[idx]) = _itoll((imA - Im) / 2, (reA - Re) / 2);
+    }
+}
+
+
+/*! @brief Bits of 1.0f */
+#define ODS_LOG2_FLOAT_ONE          0x3F800000U
+
+/*! @brief 128 * log2(1 + t), t in [0, 1), degree 5 least squares fit (error
+           below 0.002 of an output LSB), plus 0.5 for the rounding */
+#define ODS_LOG2_POLY_C0            (0.5018420f)
+#define ODS_LOG2_POLY_C1            (184.5237862f)
+#define ODS_LOG2_POLY_C2            (-90.5284396f)
+#define ODS_LOG2_POLY_C3            (52.6798698f)
+#define ODS_LOG2_POLY_C4            (-24.2985532f)
+#define ODS_LOG2_POLY_C5            (5.6228644f)
+
+/**
+ *  @b Description
+ *  @n
+ *      log2 of the magnitude of a 32-bit complex sample in Q8, the format of
+ *      mmwavelib_log2Abs32. The magnitude squared is formed in single
+ *      precision, its exponent gives the integer part and a polynomial in
+ *      its mantissa the fractional part, so that the loops over the Doppler
+ *      bins have no table look-ups and pipeline. The result is exact log2
+ *      rounded to within one LSB. mmwavelib_log2Abs32 has its own
+ *      approximation, so the two can differ by more: the dopplerFusedAccum
+ *      bench reports the difference when run on the device.
+ *
+ *  @param[in]  sample  Complex sample, real part in the lower word
+ *
+ *  @retval
+ *      log2|sample| in Q8, 0 for a zero sample
+ */
+static inline uint32_t OdsDemo_log2Abs32Q8(int64_t sample)
+{
+    float re = (float) (int32_t) _loll(sample);
+    float im = (float) (int32_t) _hill(sample);
+    uint32_t bits = _ftoi(re * re + im * im);
+    float t, frac;
+
+    if (bits < ODS_LOG2_FLOAT_ONE)
+    {
+        return 0;
+    }
+
+    /* mantissa - 1 in [0, 1) */
+    t = _itof((bits & 0x007FFFFFU) | ODS_LOG2_FLOAT_ONE) - 1.0f;
+    frac = ODS_LOG2_POLY_C0 + t * (ODS_LOG2_POLY_C1 + t * (ODS_LOG2_POLY_C2 + t * (ODS_LOG2_POLY_C3 +
+           t * (ODS_LOG2_POLY_C4 + t * ODS_LOG2_POLY_C5))));
+
+    /* 0.5 * log2|x|^2 in Q8: exponent in Q7 plus the rounded fractional part */
+    return (((bits - ODS_LOG2_FLOAT_ONE) >> 23) << 7) + (uint32_t) frac;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes log2|x| in Q8 of the Doppler bins of the first virtual
+ *      antenna and initialises the accumulation with it.
+ *
+ *  @param[in]  inp     Doppler spectrum, must be 64 bit aligned
+ *  @param[out] sumAbs  Accumulated log2 magnitude
+ *  @param[in]  len     Number of Doppler bins
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_log2Abs32Init(cmplx32ReIm_t * restrict inp, uint16_t * restrict sumAbs, uint32_t len)
+{
+    uint32_t idx;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        sumAbs[idx] = (uint16_t) OdsDemo_log2Abs32Q8(_amem8(&inp[idx]));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes log2|x| in Q8 of the Doppler bins of a virtual antenna and
+ *      adds it to the accumulation in the same pass.
+ *
+ *  @param[in]     inp     Doppler spectrum, must be 64 bit aligned
+ *  @param[in,out] sumAbs  Accumulated log2 magnitude
+ *  @param[in]     len     Number of Doppler bins
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_log2Abs32Accum(cmplx32ReIm_t * restrict inp, uint16_t * restrict sumAbs, uint32_t len)
+{
+    uint32_t idx;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        sumAbs[idx] = (uint16_t) (sumAbs[idx] + OdsDemo_log2Abs32Q8(_amem8(&inp[idx])));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Computes log2Abs and accumulates for each dopple bin.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  rxAntIdx    Virtual antenna, 0 initialises the accumulation
+ *  @param[out] sumAbs      sumAbs half of the range bin
+ *  @param[in]  fftOutIndx  Index of the Doppler spectrum in fftOut2D
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_log2AbsAccum(OdsDemo_DSS_DataPathObj *obj, int32_t rxAntIdx, uint16_t *sumAbs, uint32_t fftOutIndx)
+{
+#ifdef ODS_DOPPLER_FUSED_LOG2
+    if (rxAntIdx == 0)
+    {
+        OdsDemo_log2Abs32Init(&obj->fftOut2D[fftOutIndx], sumAbs, obj->numDopplerBins);
+    }
+    else
+    {
+        OdsDemo_log2Abs32Accum(&obj->fftOut2D[fftOutIndx], sumAbs, obj->numDopplerBins);
+    }
+#else
+    uint32_t idx;
+
     mmwavelib_log2Abs32(
                 (int32_t *) &obj->fftOut2D[fftOutIndx],
                 obj->log2Abs,
@@ -2449,23 +3889,16 @@ void OdsDemo_log2AbsAccum(OdsDemo_DSS_DataPathObj *obj, int32_t rxAntIdx, uint32
 
     if (rxAntIdx == 0)
     {
-        /* check if previous  sumAbs has been transferred */
-        if (rangeIdx > 0)
-        {
-            startTimeWait = Cycleprofiler_getTimeStamp();
-            OdsDemo_dataPathWaitTransDetMatrix (obj);
-            waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
-        }
-
         for (idx = 0; idx < obj->numDopplerBins; idx++)
         {
-            obj->sumAbs[idx] = obj->log2Abs[idx];
+            sumAbs[idx] = obj->log2Abs[idx];
         }
     }
     else
     {
-        mmwavelib_accum16(obj->log2Abs, obj->sumAbs, obj->numDopplerBins);
+        mmwavelib_accum16(obj->log2Abs, sumAbs, obj->numDopplerBins);
     }
+#endif
 }
 
 /**
@@ -2551,16 +3984,601 @@ void OdsDemo_nearFieldCorrection(OdsDemo_DSS_DataPathObj *obj,
 
         if (range > 0)
         {
-            psi = ODSDEMO_TWO_PI_OVER_LAMBDA * ((tx2+rx1)-(rx4+tx1)) - PI_*theta;
-            corrReal = cossp(psi);
-            corrImag = sinsp(-psi);
+            psi = ODSDEMO_TWO_PI_OVER_LAMBDA * ((tx2+rx1)-(rx4+tx1)) - PI_*theta;
+            corrReal = cossp(psi);
+            corrImag = sinsp(-psi);
+        }
+
+        azimuthOut1Corr.real = (int32_t) (azimuthOut1[i].real * corrReal - azimuthOut1[i].imag * corrImag);
+        azimuthOut1Corr.imag = (int32_t) (azimuthOut1[i].imag * corrReal + azimuthOut1[i].real * corrImag);
+        azimuthOut0[i].real = azimuthOut0[i].real + azimuthOut1Corr.real;
+        azimuthOut0[i].imag = azimuthOut0[i].imag + azimuthOut1Corr.imag;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Updates a static clutter map entry with the sum of the chirps of the
+ *      current frame, see @ref OdsDemo_staticClutterRemoval.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in,out] clutter  Clutter map entry
+ *  @param[in]  sumReal     Sum of the real parts of the chirps
+ *  @param[in]  sumImag     Sum of the imaginary parts of the chirps
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_staticClutterMapUpdate(OdsDemo_DSS_DataPathObj *obj,
+                                           cmplx32ReIm_t *clutter,
+                                           int64_t sumReal,
+                                           int64_t sumImag)
+{
+    int64_t meanReal, meanImag;
+    int64_t alphaQ15 = ONE_Q15;
+    uint32_t log2NumDopplerBins = obj->log2NumDopplerBins;
+
+    if (obj->staticClutterCfg.enabled && obj->clutterMapValid)
+    {
+        alphaQ15 = obj->staticClutterCfg.alphaQ15;
+    }
+
+    /* Mean with ODS_STATIC_CLUTTER_MAP_FRAC_BITS fractional bits, rounded the same
+       way as the per frame mean so that alpha = 1 gives identical results */
+    meanReal = sumReal << ODS_STATIC_CLUTTER_MAP_FRAC_BITS;
+    meanImag = sumImag << ODS_STATIC_CLUTTER_MAP_FRAC_BITS;
+    if (log2NumDopplerBins > 0)
+    {
+        meanReal = (meanReal + (1 << (log2NumDopplerBins - 1))) >> log2NumDopplerBins;
+        meanImag = (meanImag + (1 << (log2NumDopplerBins - 1))) >> log2NumDopplerBins;
+    }
+
+    clutter->real += (int32_t) ((alphaQ15 * (meanReal - clutter->real)) >> 15);
+    clutter->imag += (int32_t) ((alphaQ15 * (meanImag - clutter->imag)) >> 15);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Removes the static clutter from the chirps of one range bin and virtual
+ *      antenna. With update set the clutter map entry is first updated with the
+ *      mean of the chirps,
+ *          map = alpha * mean + (1 - alpha) * map,
+ *      where alpha is 1 if the cross frame filter is disabled or the map is not
+ *      initialized yet, which reduces to the per frame mean removal. The entry is
+ *      then subtracted from the chirps. The azimuth processing calls it without
+ *      update to reuse the estimate of the Doppler processing.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in,out] chirpBuf Chirp samples, numDopplerBins
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  virtAntIdx  Virtual antenna index in processing order
+ *  @param[in]  update      1 - update the clutter map, 0 - reuse it
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_staticClutterRemoval(OdsDemo_DSS_DataPathObj *obj,
+                                  cmplx16ReIm_t *chirpBuf,
+                                  uint32_t rangeIdx,
+                                  uint32_t virtAntIdx,
+                                  uint8_t update)
+{
+    cmplx32ReIm_t *clutter;
+    uint32_t meanVal;
+    cmplx16ReIm_t *pMeanVal = (cmplx16ReIm_t *) &meanVal;
+
+    clutter = &obj->clutterMap[rangeIdx * obj->numRxAntennas * obj->numTxAntennas + virtAntIdx];
+
+    if (update)
+    {
+        uint32_t sumVal[2];
+        cmplx32ReIm_t *pSumVal = (cmplx32ReIm_t *) sumVal;
+
+        mmwavelib_vecsum((int16_t *) chirpBuf,
+                         (int32_t *) sumVal,
+                         (int32_t) obj->numDopplerBins);
+
+        OdsDemo_staticClutterMapUpdate(obj, clutter, pSumVal->real, pSumVal->imag);
+    }
+
+    pMeanVal->real = (int16_t) ((clutter->real + (1 << (ODS_STATIC_CLUTTER_MAP_FRAC_BITS - 1))) >>
+                                ODS_STATIC_CLUTTER_MAP_FRAC_BITS);
+    pMeanVal->imag = (int16_t) ((clutter->imag + (1 << (ODS_STATIC_CLUTTER_MAP_FRAC_BITS - 1))) >>
+                                ODS_STATIC_CLUTTER_MAP_FRAC_BITS);
+
+    mmwavelib_vecsubc((int16_t *) chirpBuf,
+                      (int16_t *) chirpBuf,
+                      (uint32_t) meanVal,
+                      (int32_t) obj->numDopplerBins);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Block exponents of the chirps of a virtual antenna in processing order.
+ */
+static inline const uint8_t *OdsDemo_radarCubeBfpChirpExp(OdsDemo_DSS_DataPathObj *obj,
+                                                          uint32_t rangeIdx,
+                                                          uint32_t virtAntIdx)
+{
+    uint32_t expIdx;
+
+    expIdx = OdsDemo_radarCubeAzimAntIdx(obj, virtAntIdx) * obj->radarCubeExpNumBlocks +
+             (rangeIdx >> obj->radarCubeExpBlockShift);
+    return &obj->radarCubeExp[expIdx * obj->numDopplerBins];
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Static clutter of one range bin and virtual antenna of the block floating
+ *      point radar cube, with ODS_RADAR_CUBE_BFP_FRAC_BITS fractional bits, zero if
+ *      clutter removal is disabled. The clutter map is kept in fixed point units
+ *      and rounded like in @ref OdsDemo_staticClutterRemoval.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  chirpBuf    Chirp mantissas, numDopplerBins
+ *  @param[in]  chirpExp    Chirp block exponents, numDopplerBins
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  virtAntIdx  Virtual antenna index in processing order
+ *  @param[in]  update      1 - update the clutter map, 0 - reuse it
+ *  @param[out] clutterOut  Clutter to subtract
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_radarCubeBfpClutter(OdsDemo_DSS_DataPathObj *obj,
+                                        const cmplx16ReIm_t *chirpBuf,
+                                        const uint8_t *chirpExp,
+                                        uint32_t rangeIdx,
+                                        uint32_t virtAntIdx,
+                                        uint8_t update,
+                                        cmplx32ReIm_t *clutterOut)
+{
+    cmplx32ReIm_t *clutter;
+    int64_t sumReal = 0;
+    int64_t sumImag = 0;
+    uint32_t idx;
+
+    clutterOut->real = 0;
+    clutterOut->imag = 0;
+    if (!obj->cliCfg->clutterRemovalCfg.enabled)
+    {
+        return;
+    }
+
+    clutter = &obj->clutterMap[rangeIdx * obj->numRxAntennas * obj->numTxAntennas + virtAntIdx];
+
+    if (update)
+    {
+        for (idx = 0; idx < obj->numDopplerBins; idx++)
+        {
+            sumReal += (int64_t) chirpBuf[idx].real << chirpExp[idx];
+            sumImag += (int64_t) chirpBuf[idx].imag << chirpExp[idx];
+        }
+        OdsDemo_staticClutterMapUpdate(obj, clutter, sumReal, sumImag);
+    }
+
+    clutterOut->real = ((clutter->real + (1 << (ODS_STATIC_CLUTTER_MAP_FRAC_BITS - 1))) >>
+                        ODS_STATIC_CLUTTER_MAP_FRAC_BITS) << ODS_RADAR_CUBE_BFP_FRAC_BITS;
+    clutterOut->imag = ((clutter->imag + (1 << (ODS_STATIC_CLUTTER_MAP_FRAC_BITS - 1))) >>
+                        ODS_STATIC_CLUTTER_MAP_FRAC_BITS) << ODS_RADAR_CUBE_BFP_FRAC_BITS;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Normalizes one radar cube mantissa with its block exponent and
+ *      ODS_RADAR_CUBE_BFP_FRAC_BITS fractional bits, removes the clutter and
+ *      clips the result to +/-clipLevel.
+ */
+static inline int32_t OdsDemo_radarCubeBfpSample(int32_t mantissa,
+                                                 uint32_t blockExp,
+                                                 int32_t clutter,
+                                                 int32_t clipLevel,
+                                                 uint32_t *numClipped)
+{
+    int64_t val = ((int64_t) mantissa << (blockExp + ODS_RADAR_CUBE_BFP_FRAC_BITS)) - clutter;
+
+    if (val > clipLevel)
+    {
+        val = clipLevel;
+        (*numClipped)++;
+    }
+    else if (val < -clipLevel)
+    {
+        val = -clipLevel;
+        (*numClipped)++;
+    }
+    return (int32_t) val;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Applies the Q19 2D window to a normalized sample.
+ */
+static inline int32_t OdsDemo_radarCubeBfpWindow(int32_t val, int32_t win)
+{
+    return (int32_t) (((int64_t) val * win + (ONE_Q19 >> 1)) >> 19);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Largest magnitude of a Doppler FFT input sample for which the
+ *      DSP_fft32x32 output does not overflow.
+ */
+static inline int32_t OdsDemo_radarCubeBfpClipLevel(OdsDemo_DSS_DataPathObj *obj)
+{
+    return (1 << (30 - obj->log2NumDopplerBins)) - 1;
+}
+
+void OdsDemo_radarCubeBfpLoad(OdsDemo_DSS_DataPathObj *obj,
+                              const cmplx16ReIm_t *chirpBuf,
+                              uint32_t rangeIdx,
+                              uint32_t virtAntIdx,
+                              uint8_t update,
+                              cmplx32ReIm_t *out)
+{
+    const uint8_t *chirpExp = OdsDemo_radarCubeBfpChirpExp(obj, rangeIdx, virtAntIdx);
+    int32_t clipLevel = OdsDemo_radarCubeBfpClipLevel(obj);
+    uint32_t halfLen = obj->numDopplerBins >> 1;
+    uint32_t numClipped = 0;
+    cmplx32ReIm_t clutter;
+    uint32_t idx;
+    int32_t win;
+
+    OdsDemo_radarCubeBfpClutter(obj, chirpBuf, chirpExp, rangeIdx, virtAntIdx, update, &clutter);
+
+    for (idx = 0; idx < obj->numDopplerBins; idx++)
+    {
+        win = (idx < halfLen) ? obj->window2D[idx] : obj->window2D[obj->numDopplerBins - 1U - idx];
+        out[idx].real = OdsDemo_radarCubeBfpWindow(
+                            OdsDemo_radarCubeBfpSample(chirpBuf[idx].real, chirpExp[idx],
+                                                       clutter.real, clipLevel, &numClipped), win);
+        out[idx].imag = OdsDemo_radarCubeBfpWindow(
+                            OdsDemo_radarCubeBfpSample(chirpBuf[idx].imag, chirpExp[idx],
+                                                       clutter.imag, clipLevel, &numClipped), win);
+    }
+
+    /* the azimuth processing loads the same samples again */
+    if (update)
+    {
+        obj->radarCubeBfpStats.numClipped += numClipped;
+    }
+}
+
+void OdsDemo_radarCubeBfpDftSingleBin(OdsDemo_DSS_DataPathObj *obj,
+                                      const cmplx16ReIm_t *chirpBuf,
+                                      uint32_t rangeIdx,
+                                      uint32_t virtAntIdx,
+                                      uint32_t dopplerIdx,
+                                      cmplx32ReIm_t *out)
+{
+    const uint8_t *chirpExp = OdsDemo_radarCubeBfpChirpExp(obj, rangeIdx, virtAntIdx);
+    int32_t clipLevel = OdsDemo_radarCubeBfpClipLevel(obj);
+    uint32_t halfLen = obj->numDopplerBins >> 1;
+    uint32_t numClipped = 0;
+    uint32_t twIdx = 0;
+    int64_t accReal = 0;
+    int64_t accImag = 0;
+    cmplx32ReIm_t clutter;
+    uint32_t idx;
+    int32_t win, xReal, xImag, c, s;
+
+    OdsDemo_radarCubeBfpClutter(obj, chirpBuf, chirpExp, rangeIdx, virtAntIdx, 0, &clutter);
+
+    for (idx = 0; idx < obj->numDopplerBins; idx++)
+    {
+        win = (idx < halfLen) ? obj->window2D[idx] : obj->window2D[obj->numDopplerBins - 1U - idx];
+        xReal = OdsDemo_radarCubeBfpWindow(
+                    OdsDemo_radarCubeBfpSample(chirpBuf[idx].real, chirpExp[idx],
+                                               clutter.real, clipLevel, &numClipped), win);
+        xImag = OdsDemo_radarCubeBfpWindow(
+                    OdsDemo_radarCubeBfpSample(chirpBuf[idx].imag, chirpExp[idx],
+                                               clutter.imag, clipLevel, &numClipped), win);
+
+        /* exp(-j*2*pi*dopplerIdx*idx/numDopplerBins), see OdsDemo_genDftSinCosTable */
+        c = obj->azimuthModCoefs[twIdx].real;
+        s = obj->azimuthModCoefs[twIdx].imag;
+        accReal += (int64_t) xReal * c - (int64_t) xImag * s;
+        accImag += (int64_t) xReal * s + (int64_t) xImag * c;
+
+        twIdx = (twIdx + dopplerIdx) & (obj->numDopplerBins - 1U);
+    }
+    out->real = (int32_t) ((accReal + 0x4000) >> 15);
+    out->imag = (int32_t) ((accImag + 0x4000) >> 15);
+}
+
+void OdsDemo_radarCubePack(cmplx16ReIm_t *buf,
+                           uint32_t numSamples,
+                           uint32_t blockShift,
+                           uint8_t *blockExp,
+                           uint32_t expStride)
+{
+    OdsDemo_cmplx8ReIm *out = (OdsDemo_cmplx8ReIm *) buf;
+    const cmplx16ReIm_t *in;
+    uint32_t blockLen = 1U << blockShift;
+    uint32_t blockIdx, idx;
+    uint32_t magBits;
+    int32_t exp, rnd, re, im;
+
+    /* mantissas are written behind the samples still to be read */
+    for (blockIdx = 0; blockIdx < (numSamples >> blockShift); blockIdx++)
+    {
+        in = &buf[blockIdx << blockShift];
+
+        magBits = 0;
+        for (idx = 0; idx < blockLen; idx++)
+        {
+            re = in[idx].real;
+            im = in[idx].imag;
+            magBits |= (uint32_t) (re ^ (re >> 31)) | (uint32_t) (im ^ (im >> 31));
+        }
+
+        /* smallest shift that fits the block in 8 bits */
+        exp = 24 - (int32_t) _norm(magBits);
+        if (exp < 0)
+        {
+            exp = 0;
+        }
+        rnd = (1 << exp) >> 1;
+
+        for (idx = 0; idx < blockLen; idx++)
+        {
+            re = (in[idx].real + rnd) >> exp;
+            im = (in[idx].imag + rnd) >> exp;
+            out[(blockIdx << blockShift) + idx].real = (int8_t) ((re > 127) ? 127 : re);
+            out[(blockIdx << blockShift) + idx].imag = (int8_t) ((im > 127) ? 127 : im);
+        }
+        blockExp[blockIdx * expStride] = (uint8_t) exp;
+    }
+}
+
+void OdsDemo_radarCubeUnpack(cmplx16ReIm_t *buf, uint32_t numSamples)
+{
+    const OdsDemo_cmplx8ReIm *in = (const OdsDemo_cmplx8ReIm *) buf;
+    OdsDemo_cmplx8ReIm sample;
+    uint32_t idx;
+
+    /* backwards, samples are written over the mantissas already read */
+    for (idx = numSamples; idx > 0; idx--)
+    {
+        sample = in[idx - 1U];
+        buf[idx - 1U].real = sample.real;
+        buf[idx - 1U].imag = sample.imag;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Adds the cells of a range bin flagged by the CFAR along Doppler to the
+ *      Doppler spectra cache, taking the doppler bins of the virtual antennas
+ *      from fftOut2D (zero doppler bin before Rx channel compensation). Cells
+ *      that do not fit any more are left to the angle estimation to recompute.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  numDetObj   Number of doppler indices in cfarDetObjIndexBuf
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_dopplerSpecCacheFill(OdsDemo_DSS_DataPathObj *obj,
+                                         uint32_t rangeIdx,
+                                         uint32_t numDetObj)
+{
+    uint32_t detIdx, antIdx, dopplerIdx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    cmplx32ReIm_t *cell;
+
+    for (detIdx = 0; detIdx < numDetObj; detIdx++)
+    {
+        if (obj->dopplerSpecCacheNumCells >= obj->dopplerSpecCacheSize)
+        {
+            break;
+        }
+
+        dopplerIdx = obj->cfarDetObjIndexBuf[detIdx];
+        cell = &obj->dopplerSpecCache[obj->dopplerSpecCacheNumCells * numVirtAnt];
+
+        if (dopplerIdx == 0)
+        {
+            for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+            {
+                cell[antIdx] = obj->dopplerSpecZeroBin[antIdx];
+            }
+        }
+        else
+        {
+            for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+            {
+                cell[antIdx] = obj->fftOut2D[antIdx * obj->numDopplerBins + dopplerIdx];
+            }
+        }
+
+        obj->dopplerSpecCacheCell[obj->dopplerSpecCacheNumCells] = rangeIdx * obj->numDopplerBins + dopplerIdx;
+        obj->dopplerSpecCacheNumCells++;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Looks up a cell in the Doppler spectra cache (binary search, cells are
+ *      added in ascending order) and copies its doppler bins to azimuthIn.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  dopplerIdx  Doppler bin index, unsigned
+ *
+ *  @retval
+ *      1 if the cell was found, 0 otherwise.
+ */
+static uint32_t OdsDemo_dopplerSpecCacheGet(OdsDemo_DSS_DataPathObj *obj,
+                                            uint32_t rangeIdx,
+                                            uint32_t dopplerIdx)
+{
+    uint32_t antIdx;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
+    uint32_t key = rangeIdx * obj->numDopplerBins + dopplerIdx;
+    int32_t lo = 0;
+    int32_t hi = (int32_t) obj->dopplerSpecCacheNumCells - 1;
+    int32_t mid;
+    cmplx32ReIm_t *cell;
+
+    while (lo <= hi)
+    {
+        mid = (lo + hi) >> 1;
+        if (obj->dopplerSpecCacheCell[mid] < key)
+        {
+            lo = mid + 1;
+        }
+        else if (obj->dopplerSpecCacheCell[mid] > key)
+        {
+            hi = mid - 1;
+        }
+        else
+        {
+            cell = &obj->dopplerSpecCache[mid * numVirtAnt];
+            for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+            {
+                obj->azimuthIn[OdsDemo_radarCubeAzimAntIdx(obj, antIdx)] = cell[antIdx];
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Threshold of the CFAR along Doppler on a range bin: the thresholdScale
+ *      of the CFAR plus the threshold offset of the range bin, not below 0.
+ *
+ *  @param[in]  thresholdScale  Threshold of the CFAR
+ *  @param[in]  thrOffs         Threshold offset per range bin, NULL for none
+ *  @param[in]  rangeIdx        Range bin
+ *
+ *  @retval
+ *      Threshold
+ */
+static inline uint32_t OdsDemo_cfarRangeBinThreshold(uint32_t thresholdScale, const int16_t *thrOffs,
+                                                     uint32_t rangeIdx)
+{
+    int32_t thr;
+
+    if (thrOffs == NULL)
+    {
+        return thresholdScale;
+    }
+    thr = (int32_t) thresholdScale + thrOffs[rangeIdx];
+    return (thr > 0) ? (uint32_t) thr : 0U;
+}
+
+void OdsDemo_cfarThrCalibAccum(OdsDemo_DSS_DataPathObj *obj, const uint16_t *row, uint32_t rangeIdx)
+{
+    uint32_t dopplerIdx, sum = 0, peak = 0;
+
+    for (dopplerIdx = 0; dopplerIdx < obj->numDopplerBins; dopplerIdx++)
+    {
+        sum += row[dopplerIdx];
+        peak = (row[dopplerIdx] > peak) ? row[dopplerIdx] : peak;
+    }
+    obj->cfarThrCalibAccum[rangeIdx] += peak - (sum >> obj->log2NumDopplerBins);
+}
+
+void OdsDemo_cfarThrCalibFrameDone(OdsDemo_DSS_DataPathObj *obj)
+{
+    uint32_t rangeIdx;
+    int32_t  level, offs;
+
+    if (--obj->cfarThrCalibFramesLeft > 0)
+    {
+        return;
+    }
+    for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+    {
+        level = (int32_t) (obj->cfarThrCalibAccum[rangeIdx] / obj->cfarThrCalibCfg.numFrames) +
+                obj->cfarThrCalibCfg.margin;
+        offs = level - obj->cliCfg->cfarCfgRange.thresholdScale;
+        obj->cfarThrOffsRange[rangeIdx] = (int16_t) MIN(MAX(offs, -32768), 32767);
+        offs = level - obj->cliCfg->cfarCfgDoppler.thresholdScale;
+        obj->cfarThrOffsDoppler[rangeIdx] = (int16_t) MIN(MAX(offs, -32768), 32767);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Checks whether the detection runs as one two dimensional CFAR over the
+ *      detection matrix: the range CFAR is configured for it and the summed
+ *      area table was allocated for a Doppler window at least as large as
+ *      the configured one.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *
+ *  @retval
+ *      1 for the two dimensional CFAR, 0 for the CFAR along Doppler and range
+ */
+static uint32_t OdsDemo_cfarCa2DEnabled(OdsDemo_DSS_DataPathObj *obj)
+{
+    return ((obj->cliCfg->cfarCfgRange.averageMode == MMW_NOISE_AVG_MODE_CFAR_CA_2D) &&
+            (obj->cfar2DSat != NULL) &&
+            ((uint32_t) obj->cliCfg->cfarCfgDoppler.guardLen + obj->cliCfg->cfarCfgDoppler.winLen <=
+             obj->cfar2DSatDopplerPad));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Two dimensional CA-CFAR over the detection matrix. The summed area
+ *      table of the matrix is built once, then every cell is tested against
+ *      the mean of its rectangular training window, with the range window
+ *      and threshold of the range CFAR and the Doppler window of the Doppler
+ *      CFAR. The detections go to detObj2DRaw Doppler bin by Doppler bin,
+ *      the order of the CFAR along range that peak grouping expects.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *
+ *  @retval
+ *      Number of detected objects in detObj2DRaw
+ */
+static uint32_t OdsDemo_cfarCa2D(OdsDemo_DSS_DataPathObj *obj)
+{
+    OdsDemo_cfarCa2DCfg cfg;
+    uint32_t dopplerIdx, detIdx, numDetPerLine, numDet = 0;
+
+    cfg.guardLenRange   = obj->cliCfg->cfarCfgRange.guardLen;
+    cfg.noiseLenRange   = obj->cliCfg->cfarCfgRange.winLen;
+    cfg.guardLenDoppler = obj->cliCfg->cfarCfgDoppler.guardLen;
+    cfg.noiseLenDoppler = obj->cliCfg->cfarCfgDoppler.winLen;
+    /* the threshold of the range CFAR, so the range threshold table only */
+    cfg.threshold       = obj->cliCfg->cfarCfgRange.thresholdScale;
+    cfg.rangeThrOffs    = obj->cfarThrOffsRange;
+
+    OdsDemo_cfarCa2DBuildSat(obj->detMatrix, obj->numRangeBins, obj->numDopplerBins,
+                             obj->cfar2DSatDopplerPad, obj->cfar2DSat);
+
+    for (dopplerIdx = 0; dopplerIdx < obj->numDopplerBins; dopplerIdx++)
+    {
+        numDetPerLine = OdsDemo_cfarCa2DLine(obj->detMatrix, obj->cfar2DSat,
+                                             obj->numRangeBins, obj->numDopplerBins,
+                                             obj->cfar2DSatDopplerPad, dopplerIdx,
+                                             &cfg, obj->cfarDetObjIndexBuf);
+        for (detIdx = 0; detIdx < numDetPerLine; detIdx++)
+        {
+            numDet = OdsDemo_detObjRawAdd(obj, numDet, obj->cfarDetObjIndexBuf[detIdx], dopplerIdx,
+                                          obj->detMatrix[obj->cfarDetObjIndexBuf[detIdx] *
+                                                         obj->numDopplerBins + dopplerIdx]);
         }
-
-        azimuthOut1Corr.real = (int32_t) (azimuthOut1[i].real * corrReal - azimuthOut1[i].imag * corrImag);
-        azimuthOut1Corr.imag = (int32_t) (azimuthOut1[i].imag * corrReal + azimuthOut1[i].real * corrImag);
-        azimuthOut0[i].real = azimuthOut0[i].real + azimuthOut1Corr.real;
-        azimuthOut0[i].imag = azimuthOut0[i].imag + azimuthOut1Corr.imag;
     }
+    return numDet;
 }
 
 /**
@@ -2576,6 +4594,8 @@ void OdsDemo_nearFieldCorrection(OdsDemo_DSS_DataPathObj *obj,
 void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
 {
     uint32_t rangeIdx, idx, detIdx1, detIdx2, numDetObjPerCfar, numDetObj1D, numDetObj2D;
+    uint32_t cfar2D = OdsDemo_cfarCa2DEnabled(obj);
+    uint8_t cfarRangeAvgMode = obj->cliCfg->cfarCfgRange.averageMode;
     int32_t rxAntIdx;
     volatile uint32_t startTime;
     volatile uint32_t startTimeWait;
@@ -2587,37 +4607,38 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
     OdsDemo_DSS_dataPathContext_t *context = obj->context;
     int32_t  *fftOutPtr;
     uint32_t  fftOutIndx;
-    cmplx32ReIm_t *bpmAPtr;
-    cmplx32ReIm_t *bpmBPtr;
-    int32_t real;
-    int32_t imag;
+    uint16_t *sumAbs;
 
 
 
 
     startTime = Cycleprofiler_getTimeStamp();
-    uint32_t sourcePongAddressOffset;
     uint32_t azimuthInIndx;
     cmplx16ReIm_t *inpDoppFftBuf;
     uint32_t txOrder[SYS_COMMON_NUM_TX_ANTENNAS] = {0,1};
-    
-    if (obj->numTxAntennas == 2)
-    {
-        sourcePongAddressOffset = obj->numRangeBins * obj->numRxAntennas * obj->numDopplerBins;
-    }
-    else
-    {
-        sourcePongAddressOffset = obj->numRangeBins;
-    }
 
     /* trigger first DMA */
     EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_2D_IN_PING);
 
     /* initialize the  variable that keeps track of the number of objects detected */
     numDetObj1D = 0;
+    obj->radarCubeBfpStats.numClipped = 0;
+    obj->dopplerSpecCacheNumCells = 0;
     OdsDemo_resetDopplerLines(&obj->detDopplerLines);
+
+    /* A two dimensional CFAR configuration the summed area table was not
+       allocated for runs as CA-CFAR along Doppler and range */
+    if (cfarRangeAvgMode == MMW_NOISE_AVG_MODE_CFAR_CA_2D)
+    {
+        cfarRangeAvgMode = MMW_NOISE_AVG_MODE_CFAR_CA;
+    }
+
     for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
     {
+        /* sumAbs is double buffered, the detection matrix EDMA of the previous
+           range bin reads the other half */
+        sumAbs = &obj->sumAbs[(rangeIdx & 1U) * obj->numDopplerBins];
+
         /* 2nd Dimension FFT is done here */
         for (rxAntIdx = 0; rxAntIdx < (obj->numRxAntennas * obj->numTxAntennas); rxAntIdx++)
         {
@@ -2632,9 +4653,9 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                 if (rxAntIdx == ((obj->numRxAntennas * obj->numTxAntennas) - 1))
                 {
                     EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_2D_IN_PING,
-                        (uint32_t) &obj->radarCube[rangeIdx + 1]);
+                        OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, rangeIdx + 1, 0)));
                     EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_2D_IN_PONG,
-                        (uint32_t) &obj->radarCube[rangeIdx + 1 + sourcePongAddressOffset]);
+                        OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, rangeIdx + 1, 1)));
                 }
                 if (isPong(pingPongIdx))
                 {
@@ -2648,33 +4669,30 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
 
             inpDoppFftBuf = (cmplx16ReIm_t *) &obj->dstPingPong[pingPongId(pingPongIdx) * obj->numDopplerBins];
 
-            if (obj->cliCfg->clutterRemovalCfg.enabled)
+            if (obj->radarCubeExp != NULL)
             {
-                uint32_t sumVal[2];
-                cmplx32ReIm_t *pSumVal = (cmplx32ReIm_t *) sumVal;
-                uint32_t meanVal;
-                cmplx16ReIm_t *pMeanVal = (cmplx16ReIm_t *) &meanVal;
-
-                mmwavelib_vecsum((int16_t *) inpDoppFftBuf,
-                                 (int32_t *) sumVal,
-                                 (int32_t) obj->numDopplerBins);
-
-                pMeanVal->real = (pSumVal->real + (1<<(obj->log2NumDopplerBins-1))) >> obj->log2NumDopplerBins;
-                pMeanVal->imag = (pSumVal->imag + (1<<(obj->log2NumDopplerBins-1))) >> obj->log2NumDopplerBins;
-
-                mmwavelib_vecsubc((int16_t *) inpDoppFftBuf,
-                                  (int16_t *) inpDoppFftBuf,
-                                  (uint32_t) meanVal,
-                                  (int32_t) obj->numDopplerBins);
+                if (obj->radarCubePacked)
+                {
+                    OdsDemo_radarCubeUnpack(inpDoppFftBuf, obj->numDopplerBins);
+                }
 
+                /* block exponents, clutter removal and windowing applied on load */
+                OdsDemo_radarCubeBfpLoad(obj, inpDoppFftBuf, rangeIdx, rxAntIdx, 1, obj->windowingBuf2D);
             }
+            else
+            {
+                if (obj->cliCfg->clutterRemovalCfg.enabled)
+                {
+                    OdsDemo_staticClutterRemoval(obj, inpDoppFftBuf, rangeIdx, rxAntIdx, 1);
+                }
 
-            /* process data that has just been DMA-ed  */
-            mmwavelib_windowing16x32(
-                  (int16_t *) inpDoppFftBuf,
-                  obj->window2D,
-                  (int32_t *) obj->windowingBuf2D,
-                  obj->numDopplerBins);
+                /* process data that has just been DMA-ed  */
+                mmwavelib_windowing16x32(
+                      (int16_t *) inpDoppFftBuf,
+                      obj->window2D,
+                      (int32_t *) obj->windowingBuf2D,
+                      obj->numDopplerBins);
+            }
 
             if(obj->cliCfg->bpmCfg.isEnabled)
             {
@@ -2682,6 +4700,12 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                   doppler bins so that BPM decoding can be done later on.*/
                 fftOutIndx = pingPongId(pingPongIdx) * obj->numDopplerBins;
             }
+            else if (obj->dopplerSpecCacheSize > 0)
+            {
+                /*The FFT output buffer stores the doppler bins of all virtual
+                  antennas for the Doppler spectra cache.*/
+                fftOutIndx = rxAntIdx * obj->numDopplerBins;
+            }
             else
             {
                 /*If BPM is not enabled, the FFT output buffer stores 1 set of 
@@ -2695,9 +4719,9 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                         (int32_t *) obj->windowingBuf2D,
                         fftOutPtr);
 
+            binIndex = OdsDemo_radarCubeAzimAntIdx(obj, rxAntIdx);
             if (obj->numTxAntennas == 2)
             {
-                binIndex = rxAntIdx/2 + pingPongId(rxAntIdx) * obj->numRxAntennas;
                 if(!isPong(pingPongIdx))
                 {
                     /*store ping index to be used after BPM decoding (when BPM enabled)
@@ -2705,10 +4729,6 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                     binIndexPing = binIndex;
                 }
             }
-            else
-            {
-                binIndex = rxAntIdx;
-            }
             
             if(obj->cliCfg->bpmCfg.isEnabled)
             {
@@ -2728,29 +4748,10 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                       A is located in fftOut2D positions = [0..(numDopplerBins-1)]
                       B is located in fftOut2D positions = [numDopplerBins..(2*numDopplerBins)]
                     */                    
-                    bpmAPtr  = &obj->fftOut2D[0];
-                    bpmBPtr  = &obj->fftOut2D[obj->numDopplerBins];
-                    for(idx = 0; idx < obj->numDopplerBins; idx++)
-                    {
-                        /*doppler compensation on Pong*/
-                        OdsDemo_addDopplerCompensation(idx,
-                                                       (int32_t) obj->numDopplerBins,
-                                                       (uint32_t *) obj->azimuthModCoefs,
-                                                       (uint32_t *) &obj->azimuthModCoefsHalfBin,
-                                                       (int64_t *) &bpmBPtr[idx],
-                                                       1);
-                        
-                        /*decode BPM*/
-                        /*first make a copy of A*/
-                        real = bpmAPtr[idx].real;
-                        imag = bpmAPtr[idx].imag;
-                        /*compute S1 and store in A*/
-                        bpmAPtr[idx].real = (bpmAPtr[idx].real + bpmBPtr[idx].real)/2;
-                        bpmAPtr[idx].imag = (bpmAPtr[idx].imag + bpmBPtr[idx].imag)/2;
-                        /*compute S2 and store in B*/
-                        bpmBPtr[idx].real = (real - bpmBPtr[idx].real)/2;
-                        bpmBPtr[idx].imag = (imag - bpmBPtr[idx].imag)/2;
-                    }
+                    OdsDemo_bpmDecodeDopplerComp(&obj->fftOut2D[0],
+                                                 &obj->fftOut2D[obj->numDopplerBins],
+                                                 (uint32_t *) obj->bpmDopplerCompCoefs,
+                                                 obj->numDopplerBins);
                     
                     /*Note, when BPM is enabled, order must be:
                       2D FFT -> Doppler compensation (on Pong) -> BPM decoding -> phase compensation.
@@ -2782,64 +4783,106 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                     
                     /*Process ping and pong (remaining of 2D processing chain)*/
                     /*compute log2Abs and accumulate for PING*/
-                    OdsDemo_log2AbsAccum(obj, rxAntIdx-1, rangeIdx, &waitingTime, 0);                   
+                    OdsDemo_log2AbsAccum(obj, rxAntIdx-1, sumAbs, 0);
                     /*compute log2Abs and accumulate for PONG*/
-                    OdsDemo_log2AbsAccum(obj, rxAntIdx, rangeIdx, &waitingTime, obj->numDopplerBins);                   
+                    OdsDemo_log2AbsAccum(obj, rxAntIdx, sumAbs, obj->numDopplerBins);
                 }    
             }
             else
             {
+                if (obj->dopplerSpecCacheSize > 0)
+                {
+                    /* Keep the zero doppler bin before it is compensated below */
+                    obj->dopplerSpecZeroBin[rxAntIdx] = obj->fftOut2D[fftOutIndx];
+                }
                 if (!obj->cliCommonCfg->measureRxChanCfg.enabled)
                 {
                     /* Correcting phase in place, note fftOut2D is in scratch (2D output not
                      * stored in permanent memory) and therefore
                      * we will not be double correcting during angle calculation when
-                     * 2D FFT is recomputed from 1D FFT */
+                     * 2D FFT is recomputed from 1D FFT or taken from the Doppler spectra cache */
                     OdsDemo_rxChanPhaseBiasCompensation((uint32_t *) &obj->compRxChanCfg.rxChPhaseComp[binIndex],
-                                                        (int64_t *) &obj->fftOut2D[0],
+                                                        (int64_t *) &obj->fftOut2D[fftOutIndx],
                                                         1);
                 }
                 /* Save only for static azimuth heatmap display, scale to 16-bit precision,
                  * below +4 because 2D-FFT window has gain of 2^4 */
                 obj->azimuthStaticHeatMap[binIndex + rangeIdx * obj->numVirtualAntAzim].real =
-                    (int16_t) (obj->fftOut2D[0].real >> (obj->log2NumDopplerBins+4));
+                    (int16_t) (obj->fftOut2D[fftOutIndx].real >> (obj->log2NumDopplerBins+4));
                 obj->azimuthStaticHeatMap[binIndex + rangeIdx * obj->numVirtualAntAzim].imag =
-                    (int16_t) (obj->fftOut2D[0].imag >> (obj->log2NumDopplerBins+4));
+                    (int16_t) (obj->fftOut2D[fftOutIndx].imag >> (obj->log2NumDopplerBins+4));
                 
                 /*compute log2Abs and accumulate (remaining of 2D processing chain)*/
-                OdsDemo_log2AbsAccum(obj, rxAntIdx, rangeIdx, &waitingTime, 0);                
+                OdsDemo_log2AbsAccum(obj, rxAntIdx, sumAbs, fftOutIndx);
             }
             
             pingPongIdx ^= 1;
         }
 
+        if (obj->cfarThrCalibFramesLeft > 0)
+        {
+            OdsDemo_cfarThrCalibAccum(obj, sumAbs, rangeIdx);
+        }
+
         /* CFAR-detecton on current range line: search doppler peak among numDopplerBins samples */
-        numDetObjPerCfar = mmwavelib_cfarCadBwrap(
-                obj->sumAbs,
-                obj->cfarDetObjIndexBuf,
-                obj->numDopplerBins,
-                obj->cliCfg->cfarCfgDoppler.thresholdScale,
-                obj->cliCfg->cfarCfgDoppler.noiseDivShift,
-                obj->cliCfg->cfarCfgDoppler.guardLen,
-                obj->cliCfg->cfarCfgDoppler.winLen);
+        if (cfar2D)
+        {
+            /* left to the two dimensional CFAR over the whole detection matrix */
+            numDetObjPerCfar = 0;
+        }
+        else if (obj->cliCfg->cfarCfgDoppler.averageMode == MMW_NOISE_AVG_MODE_CFAR_OS)
+        {
+            numDetObjPerCfar = OdsDemo_cfarOsWrap(
+                    sumAbs,
+                    obj->cfarDetObjIndexBuf,
+                    obj->numDopplerBins,
+                    OdsDemo_cfarRangeBinThreshold(obj->cliCfg->cfarCfgDoppler.thresholdScale,
+                                                  obj->cfarThrOffsDoppler, rangeIdx),
+                    obj->cliCfg->cfarCfgDoppler.guardLen,
+                    obj->cliCfg->cfarCfgDoppler.winLen,
+                    obj->cfarOsHist);
+        }
+        else
+        {
+            numDetObjPerCfar = mmwavelib_cfarCadBwrap(
+                    sumAbs,
+                    obj->cfarDetObjIndexBuf,
+                    obj->numDopplerBins,
+                    OdsDemo_cfarRangeBinThreshold(obj->cliCfg->cfarCfgDoppler.thresholdScale,
+                                                  obj->cfarThrOffsDoppler, rangeIdx),
+                    obj->cliCfg->cfarCfgDoppler.noiseDivShift,
+                    obj->cliCfg->cfarCfgDoppler.guardLen,
+                    obj->cliCfg->cfarCfgDoppler.winLen);
+        }
 
+        if (obj->dopplerSpecCacheSize > 0)
+        {
+            OdsDemo_dopplerSpecCacheFill(obj, rangeIdx, numDetObjPerCfar);
+        }
 
         if(numDetObjPerCfar > 0)
         {
-            for (detIdx1 = 0; detIdx1 < numDetObjPerCfar; detIdx1++)
-            {
-                if (!OdsDemo_isSetDopplerLine(&obj->detDopplerLines, obj->cfarDetObjIndexBuf[detIdx1]))
-                {
-                    OdsDemo_setDopplerLine(&obj->detDopplerLines, obj->cfarDetObjIndexBuf[detIdx1]);
-                    numDetObj1D++;
-                }
-            }
+            numDetObj1D += OdsDemo_setDopplerLines(&obj->detDopplerLines, obj->cfarDetObjIndexBuf,
+                                                   numDetObjPerCfar);
         }
 
-        /* populate the pre-detection matrix */
+        /* populate the pre-detection matrix, the previous transfer read the
+           other sumAbs half and has had the whole range bin to complete */
+        if (rangeIdx > 0)
+        {
+            startTimeWait = Cycleprofiler_getTimeStamp();
+            OdsDemo_dataPathWaitTransDetMatrix (obj);
+            waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+        }
+        EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_DET_MATRIX,
+            SOC_translateAddress((uint32_t) sumAbs, SOC_TranslateAddr_Dir_TO_EDMA, NULL));
         EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_DET_MATRIX);
     }
 
+    /* The clutter map holds an estimate for all range bins from now on, it is
+       initialized again if clutter removal was disabled in between */
+    obj->clutterMapValid = obj->cliCfg->clutterRemovalCfg.enabled;
+
     startTimeWait = Cycleprofiler_getTimeStamp();
     OdsDemo_dataPathWaitTransDetMatrix (obj);
     waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
@@ -2861,6 +4904,13 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                                           &obj->cliCommonCfg->compRxChanCfg);
     }
 
+    numDetObj2D = 0;
+    obj->numDetObjRawDropped = 0;
+    if (cfar2D)
+    {
+        numDetObj2D = OdsDemo_cfarCa2D(obj);
+    }
+
     /*Perform CFAR detection along range lines. Only those doppler bins which were
      * detected in the earlier CFAR along doppler dimension are considered
      */
@@ -2875,7 +4925,6 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                 (uint8_t) ODS_EDMA_TRIGGER_ENABLE);
     }
 
-    numDetObj2D = 0;
     for (detIdx1 = 0; detIdx1 < numDetObj1D; detIdx1++)
     {
         /* wait for DMA transfer of current range line to complete */
@@ -2897,48 +4946,88 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                     (uint8_t) ODS_EDMA_TRIGGER_ENABLE);
         }
         /* On the detected doppler line, CFAR search the range peak among numRangeBins samples */
-        numDetObjPerCfar = mmwavelib_cfarCadB_SOGO(
-                &obj->sumAbsRange[(detIdx1 & 0x1) * obj->numRangeBins],
-                obj->cfarDetObjIndexBuf,
-                obj->numRangeBins,
-                obj->cliCfg->cfarCfgRange.averageMode,
-                obj->cliCfg->cfarCfgRange.thresholdScale,
-                obj->cliCfg->cfarCfgRange.noiseDivShift,
-                obj->cliCfg->cfarCfgRange.guardLen,
-                obj->cliCfg->cfarCfgRange.winLen);
+        if (cfarRangeAvgMode == MMW_NOISE_AVG_MODE_CFAR_OS)
+        {
+            numDetObjPerCfar = OdsDemo_cfarOs(
+                    &obj->sumAbsRange[(detIdx1 & 0x1) * obj->numRangeBins],
+                    obj->cfarDetObjIndexBuf,
+                    obj->numRangeBins,
+                    obj->cliCfg->cfarCfgRange.thresholdScale,
+                    obj->cfarThrOffsRange,
+                    obj->cliCfg->cfarCfgRange.guardLen,
+                    obj->cliCfg->cfarCfgRange.winLen,
+                    obj->cfarOsHist);
+        }
+        else if (obj->cfarThrOffsRange != NULL)
+        {
+            numDetObjPerCfar = OdsDemo_cfarCaSogo(
+                    &obj->sumAbsRange[(detIdx1 & 0x1) * obj->numRangeBins],
+                    obj->cfarDetObjIndexBuf,
+                    obj->numRangeBins,
+                    cfarRangeAvgMode,
+                    obj->cliCfg->cfarCfgRange.thresholdScale,
+                    obj->cfarThrOffsRange,
+                    obj->cliCfg->cfarCfgRange.noiseDivShift,
+                    obj->cliCfg->cfarCfgRange.guardLen,
+                    obj->cliCfg->cfarCfgRange.winLen);
+        }
+        else
+        {
+            numDetObjPerCfar = mmwavelib_cfarCadB_SOGO(
+                    &obj->sumAbsRange[(detIdx1 & 0x1) * obj->numRangeBins],
+                    obj->cfarDetObjIndexBuf,
+                    obj->numRangeBins,
+                    cfarRangeAvgMode,
+                    obj->cliCfg->cfarCfgRange.thresholdScale,
+                    obj->cliCfg->cfarCfgRange.noiseDivShift,
+                    obj->cliCfg->cfarCfgRange.guardLen,
+                    obj->cliCfg->cfarCfgRange.winLen);
+        }
 
         if (numDetObjPerCfar > 0)
         {
             for(detIdx2=0; detIdx2 <numDetObjPerCfar; detIdx2++)
             {
-                if (numDetObj2D < MAX_DET_OBJECTS_RAW)
-                {
-                    obj->detObj2DRaw[numDetObj2D].dopplerIdx = dopplerLine;
-                    obj->detObj2DRaw[numDetObj2D].rangeIdx = obj->cfarDetObjIndexBuf[detIdx2];
-                    obj->detObj2DRaw[numDetObj2D].peakVal = obj->sumAbsRange[(detIdx1 & 0x1) *
-                        obj->numRangeBins + obj->cfarDetObjIndexBuf[detIdx2]];
-                    numDetObj2D++;
-                }
+                numDetObj2D = OdsDemo_detObjRawAdd(obj, numDetObj2D, obj->cfarDetObjIndexBuf[detIdx2], dopplerLine,
+                                                   obj->sumAbsRange[(detIdx1 & 0x1) * obj->numRangeBins +
+                                                                    obj->cfarDetObjIndexBuf[detIdx2]]);
             }
         }
         dopplerLine = dopplerLineNext;
     }
 
+    /* The calibration frame ends once both CFAR passes used the previous tables */
+    if (obj->cfarThrCalibFramesLeft > 0)
+    {
+        OdsDemo_cfarThrCalibFrameDone(obj);
+    }
+
+    /* Back to CFAR order if the raw list overflowed */
+    if (obj->numDetObjRawDropped > 0)
+    {
+        OdsDemo_detObjRawRestoreOrder(obj->detObj2DRaw, numDetObj2D);
+    }
+
     /* Peak grouping */
     obj->numDetObjRaw = numDetObj2D;
     if (obj->cliCfg->peakGroupingCfg.scheme == MMW_PEAK_GROUPING_CFAR_PEAK_BASED)
     {
-        numDetObj2D = OdsDemo_cfarPeakGroupingCfarQualified( obj->detObj2D,
+        numDetObj2D = OdsDemo_cfarPeakGroupingCfarQualifiedIndexed( obj->detObj2D,
                                                 obj->detObj2DRaw,
                                                 numDetObj2D,
                                                 obj->numDopplerBins,
                                                 obj->cliCfg->peakGroupingCfg.maxRangeIndex,
                                                 obj->cliCfg->peakGroupingCfg.minRangeIndex,
                                                 obj->cliCfg->peakGroupingCfg.inDopplerDirectionEn,
-                                                obj->cliCfg->peakGroupingCfg.inRangeDirectionEn);
+                                                obj->cliCfg->peakGroupingCfg.inRangeDirectionEn,
+                                                obj->maxNumDetObj,
+                                                &obj->numDetObjDropped);
     }
     else if (obj->cliCfg->peakGroupingCfg.scheme == MMW_PEAK_GROUPING_DET_MATRIX_BASED)
     {
+#ifdef ODS_PEAK_GROUPING_STAGED
+        numDetObj2D = OdsDemo_cfarPeakGroupingStaged(obj, numDetObj2D);
+#else
         numDetObj2D = OdsDemo_cfarPeakGrouping( obj->detObj2D,
                                                 obj->detObj2DRaw,
                                                 numDetObj2D,
@@ -2947,7 +5036,10 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
                                                 obj->cliCfg->peakGroupingCfg.maxRangeIndex,
                                                 obj->cliCfg->peakGroupingCfg.minRangeIndex,
                                                 obj->cliCfg->peakGroupingCfg.inDopplerDirectionEn,
-                                                obj->cliCfg->peakGroupingCfg.inRangeDirectionEn);
+                                                obj->cliCfg->peakGroupingCfg.inRangeDirectionEn,
+                                                obj->maxNumDetObj,
+                                                &obj->numDetObjDropped);
+#endif
     }
     else
     {
@@ -2955,6 +5047,12 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
     }
     obj->numDetObj = numDetObj2D;
 
+    /* Sub-bin range and Doppler */
+    if (obj->detObjSubBin != NULL)
+    {
+        OdsDemo_detObjSubBinInterp(obj);
+    }
+
     if (obj->numVirtualAntAzim > 1)
     {
         /**************************************
@@ -2966,93 +5064,100 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
             /* Reset input buffer to azimuth FFT */
             memset((uint8_t *)obj->azimuthIn, 0, obj->numAngleBins * sizeof(cmplx32ReIm_t));
 
-            /* Set source for first (ping) DMA and trigger it, and set source second (Pong) DMA */
-            EDMAutil_triggerType3 (
-                    context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-                    (uint8_t *)(&obj->radarCube[obj->detObj2D[detIdx2].rangeIdx]),
-                    (uint8_t *) NULL,
-                    (uint8_t) ODS_EDMA_CH_3D_IN_PING,
-                    (uint8_t) ODS_EDMA_TRIGGER_ENABLE);
-            EDMAutil_triggerType3 (
-                    context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
-                    (uint8_t *)(&obj->radarCube[obj->detObj2D[detIdx2].rangeIdx + sourcePongAddressOffset]),
-                    (uint8_t *) NULL,
-                    (uint8_t) ODS_EDMA_CH_3D_IN_PONG,
-                    (uint8_t) ODS_EDMA_TRIGGER_DISABLE);
-
-            for (rxAntIdx = 0; rxAntIdx < (obj->numRxAntennas * obj->numTxAntennas); rxAntIdx++)
-            {
-                /* verify that previous DMA has completed */
-                startTimeWait = Cycleprofiler_getTimeStamp();
-                OdsDemo_dataPathWait3DInputData (obj, pingPongId(rxAntIdx));
-                waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
-
-                /* kick off next DMA */
-                if (rxAntIdx < (obj->numRxAntennas * obj->numTxAntennas) - 1)
+            if (!OdsDemo_dopplerSpecCacheGet(obj, obj->detObj2D[detIdx2].rangeIdx,
+                    DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins)))
+            {
+                /* Cell not in the Doppler spectra cache, recompute the doppler bin from the radar cube */
+                /* Set source for first (ping) DMA and trigger it, and set source second (Pong) DMA */
+                EDMAutil_triggerType3 (
+                        context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                        (uint8_t *) OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, obj->detObj2D[detIdx2].rangeIdx, 0)),
+                        (uint8_t *) NULL,
+                        (uint8_t) ODS_EDMA_CH_3D_IN_PING,
+                        (uint8_t) ODS_EDMA_TRIGGER_ENABLE);
+                EDMAutil_triggerType3 (
+                        context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE],
+                        (uint8_t *) OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeDopplerVecIdx(obj, obj->detObj2D[detIdx2].rangeIdx, 1)),
+                        (uint8_t *) NULL,
+                        (uint8_t) ODS_EDMA_CH_3D_IN_PONG,
+                        (uint8_t) ODS_EDMA_TRIGGER_DISABLE);
+
+                for (rxAntIdx = 0; rxAntIdx < (obj->numRxAntennas * obj->numTxAntennas); rxAntIdx++)
                 {
-                    if (isPong(rxAntIdx))
-                    {
-                        EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_3D_IN_PING);
-                    }
-                    else
+                    /* verify that previous DMA has completed */
+                    startTimeWait = Cycleprofiler_getTimeStamp();
+                    OdsDemo_dataPathWait3DInputData (obj, pingPongId(rxAntIdx));
+                    waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+
+                    /* kick off next DMA */
+                    if (rxAntIdx < (obj->numRxAntennas * obj->numTxAntennas) - 1)
                     {
-                        EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_3D_IN_PONG);
+                        if (isPong(rxAntIdx))
+                        {
+                            EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_3D_IN_PING);
+                        }
+                        else
+                        {
+                            EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_3D_IN_PONG);
+                        }
                     }
-                }
 
-                if (obj->numTxAntennas == 2)
-                {
-                    azimuthInIndx = rxAntIdx/2 + pingPongId(rxAntIdx) * obj->numRxAntennas;
-                }
-                else
-                {
-                    azimuthInIndx = rxAntIdx;
-                }
+                    azimuthInIndx = OdsDemo_radarCubeAzimAntIdx(obj, rxAntIdx);
 
-                inpDoppFftBuf = (cmplx16ReIm_t *) &obj->dstPingPong[pingPongId(rxAntIdx) * obj->numDopplerBins];
+                    inpDoppFftBuf = (cmplx16ReIm_t *) &obj->dstPingPong[pingPongId(rxAntIdx) * obj->numDopplerBins];
+                    if (obj->radarCubePacked)
+                    {
+                        OdsDemo_radarCubeUnpack(inpDoppFftBuf, obj->numDopplerBins);
+                    }
 
-                /* Calculate one bin DFT, at detected doppler index */
-                if (obj->cliCfg->clutterRemovalCfg.enabled)
-                {
-                    uint32_t sumVal[2];
-                    cmplx32ReIm_t *pSumVal = (cmplx32ReIm_t *) sumVal;
-                    uint32_t meanVal;
-                    cmplx16ReIm_t *pMeanVal = (cmplx16ReIm_t *) &meanVal;
-
-                    mmwavelib_vecsum((int16_t *) inpDoppFftBuf,
-                                     (int32_t *) sumVal,
-                                     (int32_t) obj->numDopplerBins);
-
-                    pMeanVal->real = (pSumVal->real + (1<<(obj->log2NumDopplerBins-1))) >> obj->log2NumDopplerBins;
-                    pMeanVal->imag = (pSumVal->imag + (1<<(obj->log2NumDopplerBins-1))) >> obj->log2NumDopplerBins;
-
-                    mmwavelib_vecsubc((int16_t *) inpDoppFftBuf,
-                                      (int16_t *) inpDoppFftBuf,
-                                      (uint32_t) meanVal,
-                                      (int32_t) obj->numDopplerBins);
-                }
+                    /* Calculate one bin DFT, at detected doppler index */
+                    if ((obj->radarCubeExp == NULL) && obj->cliCfg->clutterRemovalCfg.enabled)
+                    {
+                        /* Clutter estimate of this frame was computed in the Doppler processing */
+                        OdsDemo_staticClutterRemoval(obj, inpDoppFftBuf,
+                                                     obj->detObj2D[detIdx2].rangeIdx, rxAntIdx, 0);
+                    }
 
 #ifdef MMW_USE_SINGLE_POINT_DFT
-                mmwavelib_dftSingleBinWithWindow(
-                        (uint32_t *) inpDoppFftBuf,
-                        (uint32_t *) obj->azimuthModCoefs,
-                        obj->window2D,
-                        (uint64_t *) &obj->azimuthIn[azimuthInIndx],
-                        obj->numDopplerBins,
-                        DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins));
+                    if (obj->radarCubeExp != NULL)
+                    {
+                        OdsDemo_radarCubeBfpDftSingleBin(obj, inpDoppFftBuf,
+                                obj->detObj2D[detIdx2].rangeIdx, rxAntIdx,
+                                DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins),
+                                &obj->azimuthIn[azimuthInIndx]);
+                    }
+                    else
+                    {
+                        mmwavelib_dftSingleBinWithWindow(
+                                (uint32_t *) inpDoppFftBuf,
+                                (uint32_t *) obj->azimuthModCoefs,
+                                obj->window2D,
+                                (uint64_t *) &obj->azimuthIn[azimuthInIndx],
+                                obj->numDopplerBins,
+                                DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins));
+                    }
 #else
-                mmwavelib_windowing16x32(
-                      (int16_t *) inpDoppFftBuf,
-                      obj->window2D,
-                      (int32_t *) obj->windowingBuf2D,
-                      obj->numDopplerBins);
-                DSP_fft32x32(
-                            (int32_t *)obj->twiddle32x32_2D,
-                            obj->numDopplerBins,
-                            (int32_t *) obj->windowingBuf2D,
-                            (int32_t *) obj->fftOut2D);
-                obj->azimuthIn[azimuthInIndx] = obj->fftOut2D[DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins)];
+                    if (obj->radarCubeExp != NULL)
+                    {
+                        OdsDemo_radarCubeBfpLoad(obj, inpDoppFftBuf, obj->detObj2D[detIdx2].rangeIdx,
+                                                 rxAntIdx, 0, obj->windowingBuf2D);
+                    }
+                    else
+                    {
+                        mmwavelib_windowing16x32(
+                              (int16_t *) inpDoppFftBuf,
+                              obj->window2D,
+                              (int32_t *) obj->windowingBuf2D,
+                              obj->numDopplerBins);
+                    }
+                    DSP_fft32x32(
+                                (int32_t *)obj->twiddle32x32_2D,
+                                obj->numDopplerBins,
+                                (int32_t *) obj->windowingBuf2D,
+                                (int32_t *) obj->fftOut2D);
+                    obj->azimuthIn[azimuthInIndx] = obj->fftOut2D[DOPPLER_IDX_TO_UNSIGNED(obj->detObj2D[detIdx2].dopplerIdx, obj->numDopplerBins)];
 #endif
+                }
             }
 
             /* Doppler compensation */ // HG Step 2
@@ -3139,10 +5244,14 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
     
     EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_1D_IN_PING,
         (uint32_t) &obj->ADCdataBuf[chirpIndxInMultiChirp * obj->numAdcSamples]);
-                    
-    EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_1D_IN_PONG,
-        (uint32_t) &obj->ADCdataBuf[(chirpIndxInMultiChirp + 
-                                     obj->numChirpsPerChirpEvent) * obj->numAdcSamples]);
+
+    /* the batched range FFT fetches all antennas with the ping channel */
+    if (!obj->rangeFftBatch)
+    {
+        EDMA_setSourceAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], ODS_EDMA_CH_1D_IN_PONG,
+            (uint32_t) &obj->ADCdataBuf[(chirpIndxInMultiChirp + 
+                                         obj->numChirpsPerChirpEvent) * obj->numAdcSamples]);
+    }
     
     if(obj->chirpCount > 1) //verify if ping(or pong) buffer is free for odd(or even) chirps
     {
@@ -3164,12 +5273,15 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj)
     /* for non TDM case, when chirpBytes is >= 16384, the destinationBindex in 
        EDMA will be twice of this which is negative jump, so need to set the 
        destination address in this situation.
-       e.g if numRangeBins = 1024, numRxAntennas = 4 then destinationBindex becomes -32768 */
-    chirpBytes = obj->numRangeBins * obj->numRxAntennas * sizeof(cmplx16ReIm_t);
-    if ((obj->numTxAntennas == 1) && (chirpBytes >= (uint32_t)16384))
+       e.g if numRangeBins = 1024, numRxAntennas = 4 then destinationBindex becomes -32768.
+       The corner-turn of the Doppler-major radar cube starts every chirp at its own
+       chirp index. */
+    chirpBytes = obj->numRangeBins * obj->numRxAntennas * obj->radarCubeSampleBytes;
+    if ((obj->radarCubeLayoutCfg.layout == ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR) ||
+        ((obj->numTxAntennas == 1) && (chirpBytes >= (uint32_t)16384)))
     {
         EDMA_setDestinationAddress(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], channelId,
-            (uint32_t)obj->radarCube + (uint32_t)obj->chirpCount * chirpBytes);
+            OdsDemo_radarCubeAddr(obj, OdsDemo_radarCubeChirpIdx(obj, obj->txAntennaCount, obj->dopplerBinCount)));
     }
 
     EDMA_startDmaTransfer(context->edmaHandle[ODS_DATA_PATH_EDMA_INSTANCE], channelId);
@@ -3456,33 +5568,64 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
     uint32_t azimuthInLen;
     uint32_t azimuthOutLen;
     uint32_t bpmFactor; 
+    uint32_t fftOut2DLen;
+    uint32_t adcDataInLen;
+    uint32_t rangeFftScratchLen;
+    uint32_t radarCubeExpLen;
+    uint32_t cfar2DSatLen;
+    uint32_t radarCubeLen;
+    uint32_t radarCubeStart;
+    uint32_t objListsEnd;
+    uint8_t rawListInL3, outListInL3;
+    uint32_t subBinListLen;
+    uint32_t cfarThrRangeLen, cfarThrDopplerLen, cfarThrCalibLen;
+    uint32_t peakGroupStaged;
+    uint32_t numVirtAnt = obj->numRxAntennas * obj->numTxAntennas;
 
     /* L3 is overlaid with one-time only accessed code. Although heap is not
        required to be initialized to 0, it may help during debugging when viewing memory
        in CCS */
     memset((void *)heapL3start, 0, L3_HEAP_SIZE);
 
+    /* Object list capacities. Lists up to their default capacity stay in
+       L1/L2 where the default ones fit, larger ones are placed in L3 */
+    obj->maxNumDetObjRaw = (obj->objCapCfg.maxNumDetObjRaw != 0) ? obj->objCapCfg.maxNumDetObjRaw :
+                                                                    MAX_DET_OBJECTS_RAW;
+    obj->maxNumDetObj = (obj->objCapCfg.maxNumDetObj != 0) ? obj->objCapCfg.maxNumDetObj : MMW_MAX_OBJ_OUT;
+    rawListInL3 = (obj->maxNumDetObjRaw > MAX_DET_OBJECTS_RAW);
+    outListInL3 = (obj->maxNumDetObj > MMW_MAX_OBJ_OUT);
+    subBinListLen = obj->subBinInterpCfg.enabled ? obj->maxNumDetObj : 0;
+#ifdef ODS_PEAK_GROUPING_STAGED
+    peakGroupStaged = 1;
+#else
+    peakGroupStaged = 0;
+#endif
+    obj->numDetObjRawDropped = 0;
+    obj->numDetObjDropped = 0;
+
     /* L1 allocation
        
         Buffers are overlayed in the following order. Notation "|" indicates parallel
         and "+" means cascade 
 
         { 1D
-            (adcDataIn)
+            (adcDataIn + rangeFftScratch), both for all Rx antennas if rangeFftBatch
         } |
         { 2D
            (dstPingPong +  fftOut2D) +
-           (windowingBuf2D | log2Abs) + sumAbs
+           (windowingBuf2D | log2Abs) + sumAbs + dopplerSpecZeroBin
         } |
         { CFAR
-           detObj2DRaw
+           detObj2DRaw (in L3 if above its default capacity)
         } |
         { 3D
            (
 #ifdef MMW_USE_SINGLE_POINT_DFT
-            azimuthIn (must be at least beyond dstPingPong) + azimuthOut + azimuthMagSqr)
+            azimuthIn (must be at least beyond dstPingPong) + azimuthOut + azimuthMagSqr +
+            azimElevRowSpec)
 #else
-            azimuthIn (must be at least beyond windowingBuf2D) + azimuthOut + azimuthMagSqr)
+            azimuthIn (must be at least beyond windowingBuf2D) + azimuthOut + azimuthMagSqr +
+            azimElevRowSpec)
 #endif
         }
     */
@@ -3493,10 +5636,54 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
     uint32_t prev_end = heapL1start;
 #endif
 
+    /* Ping/pong of one Rx antenna, or all Rx antennas of a chirp for the
+       batched range FFT, which falls back to the ping/pong if they do not fit */
+    obj->rangeFftBatch = 0;
+    adcDataInLen = 2 * obj->numRangeBins;
+    rangeFftScratchLen = obj->numRangeBins;
+#ifdef ODS_USE_FUSED_RANGE_FFT
+    if (obj->rangeFftBatchCfg.enabled)
+    {
+        if ((ALIGN(MAX(adcDataInLen, obj->numRxAntennas * obj->numAdcSamples) * sizeof(cmplx16ReIm_t),
+                   MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN) +
+             obj->numRxAntennas * obj->numRangeBins * sizeof(cmplx32ReIm_t)) <= MMW_L1_HEAP_SIZE)
+        {
+            obj->rangeFftBatch = 1;
+            adcDataInLen = MAX(adcDataInLen, obj->numRxAntennas * obj->numAdcSamples);
+            rangeFftScratchLen = obj->numRxAntennas * obj->numRangeBins;
+        }
+        else
+        {
+            System_printf("Warning: Sub-frame %d batched range FFT does not fit in L1, "
+                          "using per antenna range FFT\n", obj->subFrameIndx);
+        }
+    }
+#endif
+
     MMW_ALLOC_BUF(adcDataIn, cmplx16ReIm_t, 
         heapL1start, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
-        2 * obj->numRangeBins);
-    memset((void *)obj->adcDataIn, 0, 2 * obj->numRangeBins * sizeof(cmplx16ReIm_t));
+        adcDataInLen);
+    memset((void *)obj->adcDataIn, 0, adcDataInLen * sizeof(cmplx16ReIm_t));
+
+#ifdef ODS_USE_FUSED_RANGE_FFT
+    MMW_ALLOC_BUF(rangeFftScratch, cmplx32ReIm_t,
+        adcDataIn_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        rangeFftScratchLen);
+#ifndef NO_OVERLAY
+    if ((rangeFftScratch_end - heapL1start) > MMW_L1_HEAP_SIZE)
+    {
+        /* No room next to the ADC ping/pong buffers, the range FFT runs
+           as windowing + zero padding + DSP_fft16x16 */
+        obj->rangeFftScratch = NULL;
+        rangeFftScratch_end = adcDataIn_end;
+    }
+#endif
+#else
+    obj->rangeFftScratch = NULL;
+#ifndef NO_OVERLAY
+    uint32_t rangeFftScratch_end = adcDataIn_end;
+#endif
+#endif
 
     MMW_ALLOC_BUF(dstPingPong, cmplx16ReIm_t, 
         heapL1start, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
@@ -3515,14 +5702,36 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
         bpmFactor = 1;
     }
     
+    /* Without BPM, fftOut2D keeps the Doppler spectra of all virtual antennas of
+       the range bin for the Doppler spectra cache, if they are small enough */
+    if ((bpmFactor == 1) && (obj->numVirtualAntAzim > 1) &&
+        (numVirtAnt * obj->numDopplerBins * sizeof(cmplx32ReIm_t) <= ODS_DOPPLER_SPEC_STAGE_MAX_SIZE))
+    {
+        fftOut2DLen = numVirtAnt * obj->numDopplerBins;
+        obj->dopplerSpecCacheSize = ODS_DOPPLER_SPEC_CACHE_MAX_CELLS;
+    }
+    else
+    {
+        fftOut2DLen = bpmFactor * obj->numDopplerBins;
+        obj->dopplerSpecCacheSize = 0;
+    }
+
     MMW_ALLOC_BUF(fftOut2D, cmplx32ReIm_t,
         dstPingPong_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
-        bpmFactor * obj->numDopplerBins); 
+        fftOut2DLen); 
    
     MMW_ALLOC_BUF(windowingBuf2D, cmplx32ReIm_t, 
         fftOut2D_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
         obj->numDopplerBins);     
 
+#ifdef ODS_DOPPLER_FUSED_LOG2
+    /* log2Abs is not used, OdsDemo_log2AbsAccum accumulates into sumAbs directly */
+    obj->log2Abs = NULL;
+
+    MMW_ALLOC_BUF(sumAbs, uint16_t, 
+        windowingBuf2D_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
+        2 * obj->numDopplerBins); 
+#else
     MMW_ALLOC_BUF(log2Abs, uint16_t, 
         fftOut2D_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
         obj->numDopplerBins); 
@@ -3530,10 +5739,15 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
     MMW_ALLOC_BUF(sumAbs, uint16_t, 
         MAX(log2Abs_end, windowingBuf2D_end), MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
         2 * obj->numDopplerBins); 
+#endif
+
+    MMW_ALLOC_BUF(dopplerSpecZeroBin, cmplx32ReIm_t,
+        sumAbs_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        numVirtAnt);
 
     MMW_ALLOC_BUF(detObj2DRaw, OdsDemo_objRaw_t, 
                   heapL1start, MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN,
-        MAX_DET_OBJECTS_RAW);
+        rawListInL3 ? 0 : obj->maxNumDetObjRaw);
 
 
     /* get rid of pesky compiler warning caused by macro usage */
@@ -3568,13 +5782,17 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
     MMW_ALLOC_BUF(azimuthMagSqr, float, 
         azimuthOut_end, sizeof(float), 
         azimuthMagSqrLen);
+
+    MMW_ALLOC_BUF(azimElevRowSpec, float,
+        azimuthMagSqr_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        2 * ODS_ANT_GRID_NUM_ROWS * obj->numAngleBins);
         
 #ifndef NO_L1_ALLOC 
 #ifdef NO_OVERLAY
     heapUsed = prev_end  - heapL1start;
 #else       
-    heapUsed = MAX(MAX(MAX(sumAbs_end, adcDataIn_end),
-                     azimuthMagSqr_end), detObj2DRaw_end) - heapL1start;
+    heapUsed = MAX(MAX(MAX(dopplerSpecZeroBin_end, rangeFftScratch_end),
+                     azimElevRowSpec_end), detObj2DRaw_end) - heapL1start;
 #endif
     OdsDemo_dssAssert(heapUsed <= MMW_L1_HEAP_SIZE);
     OdsDemo_printHeapStats("L1", heapUsed, MMW_L1_HEAP_SIZE);
@@ -3586,24 +5804,33 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
             } |
             { 2D + 3D
                (cfarDetObjIndexBuf + detDopplerLines.dopplerLineMask) + sumAbsRange
+            } |
+            { peak grouping (ODS_PEAK_GROUPING_STAGED)
+               peakGroupRows + peakGroupRangeEnd +
+               peakGroupOrder + peakGroupKeep (in L3 with detObj2DRaw)
             }
         } +
         {
-            twiddle16x16_1D +
+            (twiddle16x16_1D | twiddleRangeFft) +
             window1D +
             twiddle32x32_2D +
             window2D +
-            detObj2D +
-            detObj2dAzimIdx +
+            detObj2D + detObj2dAzimIdx +
+            detObjSubBin (in L3 if above the default capacity) +
             azimuthTwiddle32x32 +
-            azimuthModCoefs      
+            azimuthModCoefs +
+            dcRangeSigMean +
+            azimElevDftCoefs +
+            azimElevSteerVec +
+            cfarOsHist +
+            cfarThrOffsRange + cfarThrOffsDoppler + cfarThrCalibAccum
         }
     */
 #ifdef NO_L1_ALLOC
 #ifdef NO_OVERLAY
     heapL2start = prev_end;
 #else
-    heapL2start = MAX(MAX(sumAbs_end, adcDataIn_end), azimuthMagSqr_end);
+    heapL2start = MAX(MAX(dopplerSpecZeroBin_end, rangeFftScratch_end), azimElevRowSpec_end);
 #endif
 #else
 #ifdef NO_OVERLAY
@@ -3641,14 +5868,38 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
     MMW_ALLOC_BUF(sumAbsRange, uint16_t, 
         detDopplerLines_dopplerLineMask_end, sizeof(uint16_t),
         2 * obj->numRangeBins);
+
+    /* Detection matrix based peak grouping with the rows staged in L2
+       (ODS_PEAK_GROUPING_STAGED), runs after the range CFAR */
+    MMW_ALLOC_BUF(peakGroupRows, uint16_t,
+        heapL2start, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        peakGroupStaged * ODS_PEAK_GROUP_NUM_ROW_SLOTS * obj->numDopplerBins);
+
+    MMW_ALLOC_BUF(peakGroupRangeEnd, uint16_t,
+        peakGroupRows_end, sizeof(uint16_t),
+        peakGroupStaged * (obj->numRangeBins + 1));
+
+    MMW_ALLOC_BUF(peakGroupOrder, uint16_t,
+        peakGroupRangeEnd_end, sizeof(uint16_t),
+        rawListInL3 ? 0 : (peakGroupStaged * obj->maxNumDetObjRaw));
+
+    MMW_ALLOC_BUF(peakGroupKeep, uint32_t,
+        peakGroupOrder_end, sizeof(uint32_t),
+        rawListInL3 ? 0 : (peakGroupStaged * ((obj->maxNumDetObjRaw + 31) / 32)));
        
     MMW_ALLOC_BUF(twiddle16x16_1D, cmplx16ReIm_t, 
-        MAX(fftOut1D_end, sumAbsRange_end), 
+        MAX(MAX(fftOut1D_end, sumAbsRange_end), peakGroupKeep_end), 
         MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
         obj->numRangeBins);
         
+    /* Only one of the two range FFT twiddle tables is in use */
+    MMW_ALLOC_BUF(twiddleRangeFft, cmplx16ReIm_t,
+        MAX(MAX(fftOut1D_end, sumAbsRange_end), peakGroupKeep_end),
+        MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        ODS_RANGE_FFT_TWIDDLE_LEN(obj->numRangeBins));
+
     MMW_ALLOC_BUF(window1D, int16_t, 
-        twiddle16x16_1D_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        MAX(twiddle16x16_1D_end, twiddleRangeFft_end), MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
         obj->numAdcSamples / 2);
 
     MMW_ALLOC_BUF(twiddle32x32_2D, cmplx32ReIm_t, 
@@ -3661,37 +5912,114 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
 
     MMW_ALLOC_BUF(detObj2D, OdsDemo_detectedObj, 
         window2D_end, MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN,
-        MMW_MAX_OBJ_OUT);
+        outListInL3 ? 0 : obj->maxNumDetObj);
 
     MMW_ALLOC_BUF(detObj2dAzimIdx, uint8_t, 
         detObj2D_end, MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN,
-        MMW_MAX_OBJ_OUT);
+        outListInL3 ? 0 : obj->maxNumDetObj);
+
+    MMW_ALLOC_BUF(detObjSubBin, OdsDemo_subBinOffs_t,
+        detObj2dAzimIdx_end, sizeof(uint32_t),
+        outListInL3 ? 0 : subBinListLen);
         
     MMW_ALLOC_BUF(azimuthTwiddle32x32, cmplx32ReIm_t, 
-        detObj2dAzimIdx_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        detObjSubBin_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
         obj->numAngleBins); 
 
     MMW_ALLOC_BUF(azimuthModCoefs, cmplx16ImRe_t, 
         azimuthTwiddle32x32_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
         obj->numDopplerBins);
 
-    MMW_ALLOC_BUF(dcRangeSigMean, cmplx32ImRe_t,
+    /* Per Doppler bin compensation coefficients of the 2D BPM decoding */
+    MMW_ALLOC_BUF(bpmDopplerCompCoefs, cmplx16ImRe_t,
         azimuthModCoefs_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        obj->cliCfg->bpmCfg.isEnabled ? obj->numDopplerBins : 0);
+
+    MMW_ALLOC_BUF(dcRangeSigMean, cmplx32ImRe_t,
+        bpmDopplerCompCoefs_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
         SOC_MAX_NUM_TX_ANTENNAS * SOC_MAX_NUM_RX_ANTENNAS * DC_RANGE_SIGNATURE_COMP_MAX_BIN_SIZE);
 
+    MMW_ALLOC_BUF(azimElevDftCoefs, float,
+        dcRangeSigMean_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        2 * obj->numAngleBins);
+
+    MMW_ALLOC_BUF(azimElevSteerVec, float,
+        azimElevDftCoefs_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        2 * ODS_ANT_GRID_STEER_LEN * obj->numAngleBins);
+
+    /* Not overlaid, the ordered statistic CFAR expects it to stay all zero */
+    MMW_ALLOC_BUF(cfarOsHist, uint16_t,
+        azimElevSteerVec_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        ODS_CFAR_OS_HIST_LEN);
+    memset((void *)obj->cfarOsHist, 0, ODS_CFAR_OS_HIST_LEN * sizeof(uint16_t));
+
+    /* Range dependent CFAR thresholds, not overlaid either, the calibration
+       runs over the first frames after sensor start */
+    cfarThrCalibLen = (obj->cfarThrCalibCfg.numFrames > 0) ? obj->numRangeBins : 0;
+    cfarThrRangeLen = (obj->cfarThrTableCfgRange.numPoints > 0) ? obj->numRangeBins : cfarThrCalibLen;
+    cfarThrDopplerLen = (obj->cfarThrTableCfgDoppler.numPoints > 0) ? obj->numRangeBins : cfarThrCalibLen;
+    MMW_ALLOC_BUF(cfarThrOffsRange, int16_t,
+        cfarOsHist_end, sizeof(uint32_t),
+        cfarThrRangeLen);
+    if (cfarThrRangeLen > 0)
+    {
+        OdsDemo_cfarThrTableExpand(obj->cfarThrTableCfgRange.rangeIdx, obj->cfarThrTableCfgRange.offset,
+                                   obj->cfarThrTableCfgRange.numPoints, obj->cfarThrOffsRange,
+                                   obj->numRangeBins);
+    }
+    else
+    {
+        obj->cfarThrOffsRange = NULL;
+    }
+
+    MMW_ALLOC_BUF(cfarThrOffsDoppler, int16_t,
+        cfarThrOffsRange_end, sizeof(uint32_t),
+        cfarThrDopplerLen);
+    if (cfarThrDopplerLen > 0)
+    {
+        OdsDemo_cfarThrTableExpand(obj->cfarThrTableCfgDoppler.rangeIdx, obj->cfarThrTableCfgDoppler.offset,
+                                   obj->cfarThrTableCfgDoppler.numPoints, obj->cfarThrOffsDoppler,
+                                   obj->numRangeBins);
+    }
+    else
+    {
+        obj->cfarThrOffsDoppler = NULL;
+    }
+
+    MMW_ALLOC_BUF(cfarThrCalibAccum, uint32_t,
+        cfarThrOffsDoppler_end, sizeof(uint32_t),
+        cfarThrCalibLen);
+    if (cfarThrCalibLen > 0)
+    {
+        memset((void *)obj->cfarThrCalibAccum, 0, cfarThrCalibLen * sizeof(uint32_t));
+    }
+    else
+    {
+        obj->cfarThrCalibAccum = NULL;
+    }
+    obj->cfarThrCalibFramesLeft = obj->cfarThrCalibCfg.numFrames;
+
 #ifdef NO_OVERLAY
     heapUsed = prev_end - heapL2start;
 #else        
-    heapUsed = dcRangeSigMean_end - heapL2start;
+    heapUsed = cfarThrCalibAccum_end - heapL2start;
 #endif
     OdsDemo_dssAssert(heapUsed <= MMW_L2_HEAP_SIZE);
     OdsDemo_printHeapStats("L2", heapUsed, MMW_L2_HEAP_SIZE);    
 
     /* L3 allocation:
         ADCdataBuf (for unit test) +
-        radarCube +
         azimuthStaticHeatMap +
-        detMatrix
+        detMatrix +
+        dopplerSpecCacheCell + dopplerSpecCache (dopplerSpecCacheSize cells) +
+        cfar2DSat +
+        (detObj2DRaw + peakGroupOrder + peakGroupKeep), above the default capacity +
+        (detObj2D + detObj2dAzimIdx + detObjSubBin), above the default capacity +
+        radarCubeExp +
+        radarCube (16-bit, or packed if it does not fit)
+        ...
+        clutterMap (sub-frames 1..n, not overlaid) +
+        clutterMap (sub-frame 0, not overlaid)
     */
 #ifdef NO_OVERLAY
     prev_end = heapL3start;
@@ -3707,31 +6035,152 @@ void OdsDemo_dataPathConfigBuffers(OdsDemo_DSS_DataPathObj *obj, uint32_t adcBuf
 #endif
     }
     
-    MMW_ALLOC_BUF(radarCube, cmplx16ReIm_t, 
-        ADCdataBuf_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
-        obj->numRangeBins * obj->numDopplerBins * obj->numRxAntennas *
-        obj->numTxAntennas);
-
     MMW_ALLOC_BUF(azimuthStaticHeatMap, cmplx16ImRe_t, 
-        radarCube_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
+        ADCdataBuf_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN, 
         obj->numRangeBins * obj->numRxAntennas * obj->numTxAntennas);
    
     MMW_ALLOC_BUF(detMatrix, uint16_t, 
         azimuthStaticHeatMap_end, sizeof(uint16_t), 
         obj->numRangeBins * obj->numDopplerBins);
 
+    MMW_ALLOC_BUF(dopplerSpecCacheCell, uint32_t,
+        detMatrix_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        obj->dopplerSpecCacheSize);
+
+    MMW_ALLOC_BUF(dopplerSpecCache, cmplx32ReIm_t,
+        dopplerSpecCacheCell_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        obj->dopplerSpecCacheSize * numVirtAnt);
+
+    /* Summed area table of the two dimensional CFAR, for the Doppler window
+       configured now */
+    obj->cfar2DSatDopplerPad = 0;
+    cfar2DSatLen = 0;
+    if (obj->cliCfg->cfarCfgRange.averageMode == MMW_NOISE_AVG_MODE_CFAR_CA_2D)
+    {
+        obj->cfar2DSatDopplerPad = obj->cliCfg->cfarCfgDoppler.guardLen + obj->cliCfg->cfarCfgDoppler.winLen;
+        cfar2DSatLen = ODS_CFAR_2D_SAT_LEN(obj->numRangeBins, obj->numDopplerBins, obj->cfar2DSatDopplerPad);
+    }
+    MMW_ALLOC_BUF(cfar2DSat, uint32_t,
+        dopplerSpecCache_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        cfar2DSatLen);
+    if (cfar2DSatLen == 0)
+    {
+        obj->cfar2DSat = NULL;
+    }
+
+    /* Object lists above their default capacity */
+#ifdef NO_OVERLAY
+    objListsEnd = prev_end;
+#else
+    objListsEnd = cfar2DSat_end;
+#endif
+    if (rawListInL3)
+    {
+        obj->detObj2DRaw = (OdsDemo_objRaw_t *) ALIGN(objListsEnd, MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN);
+        obj->peakGroupOrder = (uint16_t *) ((uint32_t) obj->detObj2DRaw +
+                                            obj->maxNumDetObjRaw * sizeof(OdsDemo_objRaw_t));
+        obj->peakGroupKeep = (uint32_t *) ALIGN((uint32_t) obj->peakGroupOrder +
+                                                peakGroupStaged * obj->maxNumDetObjRaw * sizeof(uint16_t),
+                                                sizeof(uint32_t));
+        objListsEnd = (uint32_t) obj->peakGroupKeep +
+                      peakGroupStaged * ((obj->maxNumDetObjRaw + 31) / 32) * sizeof(uint32_t);
+    }
+    if (outListInL3)
+    {
+        obj->detObj2D = (OdsDemo_detectedObj *) ALIGN(objListsEnd, MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN);
+        obj->detObj2dAzimIdx = (uint8_t *) ALIGN((uint32_t) obj->detObj2D +
+                                                 obj->maxNumDetObj * sizeof(OdsDemo_detectedObj),
+                                                 MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN);
+        obj->detObjSubBin = (OdsDemo_subBinOffs_t *) ALIGN((uint32_t) obj->detObj2dAzimIdx +
+                                                           obj->maxNumDetObj * sizeof(uint8_t), sizeof(uint32_t));
+        objListsEnd = (uint32_t) obj->detObjSubBin + subBinListLen * sizeof(OdsDemo_subBinOffs_t);
+    }
+#ifdef NO_OVERLAY
+    prev_end = objListsEnd;
+#endif
+    if (subBinListLen == 0)
+    {
+        obj->detObjSubBin = NULL;
+    }
+
+    if (obj->subFrameIndx == 0)
+    {
+        gOdsL3ClutterMapStart = heapL3start + sizeof(gOdsL3);
+        gOdsL3OverlayEnd = heapL3start;
+    }
+    gOdsL3ClutterMapStart = (gOdsL3ClutterMapStart - obj->numRangeBins * obj->numRxAntennas *
+        obj->numTxAntennas * sizeof(cmplx32ReIm_t)) & ~(MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN - 1);
+    obj->clutterMap = (cmplx32ReIm_t *) gOdsL3ClutterMapStart;
+
+    /* L3 was cleared above, the map is initialized with the first frame */
+    obj->clutterMapValid = 0;
+
+    /* Block exponents of the radar cube, one per chirp and virtual antenna
+       (and range block if packed). The block floating point exponents are
+       produced by the fused range FFT */
+    radarCubeExpLen = 0;
+    if (obj->radarCubeBfpCfg.enabled)
+    {
+        if (obj->rangeFftScratch != NULL)
+        {
+            radarCubeExpLen = numVirtAnt * obj->numDopplerBins;
+        }
+        else
+        {
+            System_printf("Warning: Sub-frame %d block floating point radar cube needs the fused range FFT, "
+                          "using fixed point radar cube\n", obj->subFrameIndx);
+        }
+    }
+
+    /* If the 16-bit radar cube does not fit below the clutter maps, it is
+       packed to 8-bit mantissas with one exponent per block of range bins */
+    obj->radarCubePacked = 0;
+    obj->radarCubeSampleBytes = BYTES_PER_SAMP_1D;
+    obj->radarCubeExpBlockShift = OdsDemo_floorLog2(obj->numRangeBins);
+    obj->radarCubeExpNumBlocks = 1;
+    radarCubeLen = obj->numRangeBins * obj->numDopplerBins * numVirtAnt;
+    radarCubeStart = objListsEnd;
+    radarCubeStart = ALIGN(ALIGN(radarCubeStart, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN) + radarCubeExpLen,
+                           MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN);
+    if ((radarCubeStart + radarCubeLen * BYTES_PER_SAMP_1D) > gOdsL3ClutterMapStart)
+    {
+        obj->radarCubePacked = 1;
+        obj->radarCubeSampleBytes = BYTES_PER_SAMP_1D_PACKED;
+        obj->radarCubeExpBlockShift = MIN(ODS_RADAR_CUBE_PACK_BLOCK_SHIFT, obj->radarCubeExpBlockShift);
+        obj->radarCubeExpNumBlocks = obj->numRangeBins >> obj->radarCubeExpBlockShift;
+        radarCubeExpLen = numVirtAnt * obj->numDopplerBins * obj->radarCubeExpNumBlocks;
+        System_printf("Sub-frame %d radar cube does not fit in L3, using packed radar cube\n",
+                      obj->subFrameIndx);
+    }
+
+    MMW_ALLOC_BUF(radarCubeExp, uint8_t,
+        objListsEnd, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        radarCubeExpLen);
+    if (radarCubeExpLen == 0)
+    {
+        obj->radarCubeExp = NULL;
+    }
+    memset((void *)obj->rangeFftExp, 0, sizeof(obj->rangeFftExp));
+    memset((void *)&obj->radarCubeBfpStats, 0, sizeof(obj->radarCubeBfpStats));
+
+    MMW_ALLOC_BUF(radarCube, cmplx16ReIm_t,
+        radarCubeExp_end, MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN,
+        radarCubeLen * obj->radarCubeSampleBytes / sizeof(cmplx16ReIm_t));
+
 #ifdef NO_OVERLAY
-    heapUsed = prev_end - heapL3start;
+    gOdsL3OverlayEnd = MAX(gOdsL3OverlayEnd, prev_end);
 #else
-    heapUsed = detMatrix_end - heapL3start;
+    gOdsL3OverlayEnd = MAX(gOdsL3OverlayEnd, radarCube_end);
 #endif
-    OdsDemo_dssAssert(heapUsed <= sizeof(gOdsL3));
+    OdsDemo_dssAssert(gOdsL3OverlayEnd <= gOdsL3ClutterMapStart);
+    heapUsed = (gOdsL3OverlayEnd - heapL3start) + (heapL3start + sizeof(gOdsL3) - gOdsL3ClutterMapStart);
     OdsDemo_printHeapStats("L3", heapUsed, sizeof(gOdsL3));
 }
 
 
 void OdsDemo_dataPathConfigFFTs(OdsDemo_DSS_DataPathObj *obj)
 {
+    uint32_t i, n, coefIdx;
 
     OdsDemo_genWindow((void *)obj->window1D,
                         FFT_WINDOW_INT16,
@@ -3748,7 +6197,14 @@ void OdsDemo_dataPathConfigFFTs(OdsDemo_DSS_DataPathObj *obj)
                         MMW_WIN_HANNING);
 
     /* Generate twiddle factors for 1D FFT. This is one time */
-    OdsDemo_gen_twiddle_fft16x16_fast((int16_t *)obj->twiddle16x16_1D, obj->numRangeBins);
+    if (obj->rangeFftScratch != NULL)
+    {
+        OdsDemo_rangeFftGenTwiddle(obj->twiddleRangeFft, obj->numRangeBins);
+    }
+    else
+    {
+        OdsDemo_gen_twiddle_fft16x16_fast((int16_t *)obj->twiddle16x16_1D, obj->numRangeBins);
+    }
 
     /* Generate twiddle factors for 2D FFT */
     OdsDemo_gen_twiddle_fft32x32_fast((int32_t *)obj->twiddle32x32_2D, obj->numDopplerBins, 2147483647.5);
@@ -3760,6 +6216,37 @@ void OdsDemo_dataPathConfigFFTs(OdsDemo_DSS_DataPathObj *obj)
     OdsDemo_genDftSinCosTable(obj->azimuthModCoefs,
                               &obj->azimuthModCoefsHalfBin,
                               obj->numDopplerBins);
+
+    /* Generate Doppler compensation coefficients for the 2D BPM decoding */
+    if (obj->cliCfg->bpmCfg.isEnabled)
+    {
+        for (i = 0; i < obj->numDopplerBins; i++)
+        {
+            _amem4(&obj->bpmDopplerCompCoefs[i]) =
+                OdsDemo_dopplerCompCoef((int32_t) i,
+                                        (int32_t) obj->numDopplerBins,
+                                        (uint32_t *) obj->azimuthModCoefs,
+                                        (uint32_t *) &obj->azimuthModCoefsHalfBin);
+        }
+    }
+
+    /* Generate DFT coefficients for the pruned 2D angle DFT */
+    for (i = 0; i < obj->numAngleBins; i++)
+    {
+        obj->azimElevDftCoefs[2 * i]     = cossp(2 * PI_ * i / obj->numAngleBins);
+        obj->azimElevDftCoefs[2 * i + 1] = -sinsp(2 * PI_ * i / obj->numAngleBins);
+    }
+
+    /* Generate steering vectors of the antenna grid for the 2D angle search */
+    for (i = 0; i < obj->numAngleBins; i++)
+    {
+        for (n = 0; n < ODS_ANT_GRID_STEER_LEN; n++)
+        {
+            coefIdx = (i * n) & (obj->numAngleBins - 1);
+            obj->azimElevSteerVec[2 * (i * ODS_ANT_GRID_STEER_LEN + n)]     = obj->azimElevDftCoefs[2 * coefIdx];
+            obj->azimElevSteerVec[2 * (i * ODS_ANT_GRID_STEER_LEN + n) + 1] = obj->azimElevDftCoefs[2 * coefIdx + 1];
+        }
+    }
 }
 
 /**
@@ -3901,40 +6388,28 @@ void OdsDemo_checkDynamicConfigErrors(OdsDemo_DSS_DataPathObj *obj)
 /**
  *  @b Description
  *  @n
- *      This function computes the 2D direction of arrival (i.e. azimuth and elevation angle) 
- *      of the detected object. In case the angle for the detected object cannot be computed,
- *      it populates the (x,y,z) co-ordinates for such objects to be (1000, 1000, 1000) meters.
- *      
+ *      Finds the peak of the 2D angle spectrum by a numAngleBins x numAngleBins
+ *      FFT of the virtual antenna grid: the antennas are arranged in
+ *      DOA_2D_storage based on ODS antenna placement, the grid rows are
+ *      transformed (azimuth) and then all columns (elevation).
  *
- *  @param[in] obj  Pointer to data path object
- *  @param[in] objIndex  Index for the detected object
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Elevation bin of the peak
+ *  @param[out] colIdx  Azimuth bin of the peak
  *
  *  @retval
  *      NONE
- */ 
-void OdsDemo_angleEstimationAzimElev(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex)
+ */
+void OdsDemo_angle2DPeakFullFft(OdsDemo_DSS_DataPathObj *obj, int32_t *rowIdx, int32_t *colIdx)
 {
-
     float mag_sqr;
-    float range;
-    float rangeResolution = obj->rangeResolution;
     float maxVal = 0;
-    double theta,phi,az_freq,el_freq;
-    float x,y,z;
     uint32_t antIndx;
-    int32_t fft_2D_peak_row_idx,fft_2D_peak_col_idx;
+    int32_t fft_2D_peak_row_idx = 0, fft_2D_peak_col_idx = 0;
     uint32_t numAngleBins = obj->numAngleBins;
     int16_t row_idx,col_idx;
     cmplx32ReIm_t temp_rearrange[8];
     cmplx32ReIm_t tp_zero;
-    uint32_t xyzOutputQFormat = obj->xyzOutputQFormat;
-
-    #define ONE_QFORMAT (1 << xyzOutputQFormat)
-
-    /* Calculate X and Y co-ordintes in meters in Q8 format */
-    
-    /* compute the range of the detected object*/
-    range = obj->detObj2D[objIndex].rangeIdx * rangeResolution;
 
     tp_zero.real = 0;
     tp_zero.imag = 0;
@@ -4033,6 +6508,457 @@ void OdsDemo_angleEstimationAzimElev(OdsDemo_DSS_DataPathObj *obj, uint32_t objI
             }
         }
     }
+
+    *rowIdx = fft_2D_peak_row_idx;
+    *colIdx = fft_2D_peak_col_idx;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Arranges the virtual antennas of azimuthIn on the
+ *      ODS_ANT_GRID_NUM_ROWS x ODS_ANT_GRID_NUM_COLS antenna grid, positions
+ *      without an antenna are set to zero.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] gridRe  Real part of the grid
+ *  @param[out] gridIm  Imaginary part of the grid
+ *
+ *  @retval
+ *      NONE
+ */
+static void OdsDemo_angle2DGrid(OdsDemo_DSS_DataPathObj *obj,
+                                float gridRe[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS],
+                                float gridIm[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS])
+{
+    static const int8_t rxRow[] = ODS_ANT_RX_ROW;
+    static const int8_t rxCol[] = ODS_ANT_RX_COL;
+    static const int8_t txRow[] = ODS_ANT_TX_ROW;
+    static const int8_t txCol[] = ODS_ANT_TX_COL;
+    uint32_t txIdx, rxIdx, row, col;
+
+    memset((void *)gridRe, 0, ODS_ANT_GRID_NUM_ROWS * ODS_ANT_GRID_NUM_COLS * sizeof(float));
+    memset((void *)gridIm, 0, ODS_ANT_GRID_NUM_ROWS * ODS_ANT_GRID_NUM_COLS * sizeof(float));
+    for (txIdx = 0; txIdx < obj->numTxAntennas; txIdx++)
+    {
+        for (rxIdx = 0; rxIdx < obj->numRxAntennas; rxIdx++)
+        {
+            row = rxRow[rxIdx] + txRow[txIdx];
+            col = rxCol[rxIdx] + txCol[txIdx];
+            gridRe[row][col] = (float) obj->azimuthIn[txIdx * obj->numRxAntennas + rxIdx].real;
+            gridIm[row][col] = (float) obj->azimuthIn[txIdx * obj->numRxAntennas + rxIdx].imag;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Finds the peak of the 2D angle spectrum like OdsDemo_angle2DPeakFullFft
+ *      without the zero padded grid. Only ODS_ANT_GRID_NUM_ROWS rows and
+ *      ODS_ANT_GRID_NUM_COLS columns of the grid are non-zero, so
+ *        - the azimuth spectrum of each row is a direct 4 input DFT,
+ *        - the elevation spectrum of each azimuth bin is a direct 3 input DFT,
+ *          evaluated only for azimuth bins whose upper bound (Cauchy-Schwarz,
+ *          3 x the energy of the 3 row spectra) reaches the current peak,
+ *          starting with the bin of the largest bound.
+ *      Ties are resolved in favor of the lowest row, then the lowest column,
+ *      as in the row-major scan of the full FFT.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Elevation bin of the peak
+ *  @param[out] colIdx  Azimuth bin of the peak
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angle2DPeakPruned(OdsDemo_DSS_DataPathObj *obj, int32_t *rowIdx, int32_t *colIdx)
+{
+    float gridRe[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS];
+    float gridIm[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS];
+    float bound[ODS_NUM_ANGLE_BINS];
+    float * restrict coefs = obj->azimElevDftCoefs;
+    float * restrict rowSpec = obj->azimElevRowSpec;
+    uint32_t numAngleBins = obj->numAngleBins;
+    uint32_t binMask = numAngleBins - 1;
+    uint32_t row, col, azimIdx, elevIdx, coefIdx, i;
+    uint32_t startIdx = 0;
+    int32_t peakRow = 0, peakCol = 0;
+    float re, im, wRe, wIm, mag, maxVal = 0, maxBound = -1.0f;
+    float *spec;
+
+    /* Arrange the virtual antennas on the grid */
+    OdsDemo_angle2DGrid(obj, gridRe, gridIm);
+
+    /* Azimuth DFT of each row, and bound of the elevation spectrum per bin */
+    for (azimIdx = 0; azimIdx < numAngleBins; azimIdx++)
+    {
+        bound[azimIdx] = 0;
+        for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+        {
+            re = 0;
+            im = 0;
+            for (col = 0; col < ODS_ANT_GRID_NUM_COLS; col++)
+            {
+                coefIdx = (col * azimIdx) & binMask;
+                wRe = coefs[2 * coefIdx];
+                wIm = coefs[2 * coefIdx + 1];
+                re += gridRe[row][col] * wRe - gridIm[row][col] * wIm;
+                im += gridRe[row][col] * wIm + gridIm[row][col] * wRe;
+            }
+            spec = &rowSpec[2 * (row * numAngleBins + azimIdx)];
+            spec[0] = re;
+            spec[1] = im;
+            bound[azimIdx] += re * re + im * im;
+        }
+        /* Margin covers the rounding of the float spectra */
+        bound[azimIdx] *= ODS_ANT_GRID_NUM_ROWS * 1.001f;
+        if (bound[azimIdx] > maxBound)
+        {
+            maxBound = bound[azimIdx];
+            startIdx = azimIdx;
+        }
+    }
+
+    /* Elevation DFT of the azimuth bins that can hold the peak */
+    for (i = 0; i < numAngleBins; i++)
+    {
+        azimIdx = (startIdx + i) & binMask;
+        if (bound[azimIdx] < maxVal)
+        {
+            continue;
+        }
+        for (elevIdx = 0; elevIdx < numAngleBins; elevIdx++)
+        {
+            re = 0;
+            im = 0;
+            for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+            {
+                coefIdx = (row * elevIdx) & binMask;
+                wRe  = coefs[2 * coefIdx];
+                wIm  = coefs[2 * coefIdx + 1];
+                spec = &rowSpec[2 * (row * numAngleBins + azimIdx)];
+                re += spec[0] * wRe - spec[1] * wIm;
+                im += spec[0] * wIm + spec[1] * wRe;
+            }
+            mag = re * re + im * im;
+            if ((mag > maxVal) ||
+                ((mag == maxVal) && (mag > 0) &&
+                 ((elevIdx < peakRow) || ((elevIdx == peakRow) && (azimIdx < peakCol)))))
+            {
+                maxVal  = mag;
+                peakRow = elevIdx;
+                peakCol = azimIdx;
+            }
+        }
+    }
+
+    *rowIdx = peakRow;
+    *colIdx = peakCol;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes the 2D angle spectrum of the antenna grid on the 3 x 3
+ *      neighbourhood of an angle bin from the steering vector table.
+ *
+ *  @param[in]  obj      Pointer to data path object
+ *  @param[in]  gridRe   Real part of the antenna grid
+ *  @param[in]  gridIm   Imaginary part of the antenna grid
+ *  @param[in]  elevIdx  Elevation bin of the neighbourhood center
+ *  @param[in]  azimIdx  Azimuth bin of the neighbourhood center
+ *  @param[out] power    Spectrum power, indexed [elevation offset + 1][azimuth offset + 1]
+ *
+ *  @retval
+ *      NONE
+ */
+static void OdsDemo_angle2DSteerNeighbourhood(OdsDemo_DSS_DataPathObj *obj,
+                                              float gridRe[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS],
+                                              float gridIm[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS],
+                                              uint32_t elevIdx,
+                                              uint32_t azimIdx,
+                                              float power[3][3])
+{
+    const float * restrict steer = obj->azimElevSteerVec;
+    uint32_t binMask = obj->numAngleBins - 1;
+    float specRe[3][ODS_ANT_GRID_NUM_ROWS];
+    float specIm[3][ODS_ANT_GRID_NUM_ROWS];
+    const float *w;
+    float re, im;
+    uint32_t i, j, row, col;
+
+    /* Azimuth spectra of the grid rows at the 3 azimuth bins */
+    for (i = 0; i < 3; i++)
+    {
+        w = &steer[2 * ODS_ANT_GRID_STEER_LEN * ((azimIdx + i - 1) & binMask)];
+        for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+        {
+            re = 0;
+            im = 0;
+            for (col = 0; col < ODS_ANT_GRID_NUM_COLS; col++)
+            {
+                re += gridRe[row][col] * w[2 * col] - gridIm[row][col] * w[2 * col + 1];
+                im += gridRe[row][col] * w[2 * col + 1] + gridIm[row][col] * w[2 * col];
+            }
+            specRe[i][row] = re;
+            specIm[i][row] = im;
+        }
+    }
+
+    /* Elevation spectra at the 3 elevation bins */
+    for (j = 0; j < 3; j++)
+    {
+        w = &steer[2 * ODS_ANT_GRID_STEER_LEN * ((elevIdx + j - 1) & binMask)];
+        for (i = 0; i < 3; i++)
+        {
+            re = 0;
+            im = 0;
+            for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+            {
+                re += specRe[i][row] * w[2 * row] - specIm[i][row] * w[2 * row + 1];
+                im += specRe[i][row] * w[2 * row + 1] + specIm[i][row] * w[2 * row];
+            }
+            power[j][i] = re * re + im * im;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Offset of the vertex of the parabola through the spectrum power at
+ *      bins -1, 0 and +1 around a local maximum, limited to +/- half a bin.
+ *
+ *  @param[in]  power   Spectrum power at bins -1, 0 and +1
+ *
+ *  @retval
+ *      Fractional bin offset of the peak
+ */
+static float OdsDemo_angleParabolicOffset(float power[3])
+{
+    float x[3] = {-1.0f, 0.0f, 1.0f};
+    float offset, peakVal;
+
+    /* flat top, no curvature to fit */
+    if ((power[1] <= power[0]) && (power[1] <= power[2]))
+    {
+        return 0;
+    }
+
+    MmwDemo_quadFit(x, power, &offset, &peakVal);
+
+    return MAX(MIN(offset, 0.5f), -0.5f);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Offset of the vertex of the 2D quadratic through the 3 x 3 spectrum
+ *      power around a local maximum. The antenna grid is not separable, so
+ *      the spectrum has an azimuth/elevation cross term and the azimuth and
+ *      elevation cuts through the integer peak are not centered on the true
+ *      peak. Falls back to the parabola of each cut when the quadratic has
+ *      no maximum. Limited to +/- half a bin.
+ *
+ *  @param[in]  power    Spectrum power, indexed [elevation offset + 1][azimuth offset + 1]
+ *  @param[out] rowOffs  Fractional elevation bin offset of the peak
+ *  @param[out] colOffs  Fractional azimuth bin offset of the peak
+ *
+ *  @retval
+ *      NONE
+ */
+static void OdsDemo_angleQuadFit2D(float power[3][3], float *rowOffs, float *colOffs)
+{
+    float gradAzim, gradElev, curvAzim, curvElev, curvCross, det;
+    float cut[3];
+    uint32_t i;
+
+    gradAzim  = 0.5f * (power[1][2] - power[1][0]);
+    gradElev  = 0.5f * (power[2][1] - power[0][1]);
+    curvAzim  = power[1][2] - 2.0f * power[1][1] + power[1][0];
+    curvElev  = power[2][1] - 2.0f * power[1][1] + power[0][1];
+    curvCross = 0.25f * (power[2][2] - power[2][0] - power[0][2] + power[0][0]);
+    det = curvAzim * curvElev - curvCross * curvCross;
+
+    if ((curvAzim < 0) && (det > 0))
+    {
+        *colOffs = (gradElev * curvCross - gradAzim * curvElev) / det;
+        *rowOffs = (gradAzim * curvCross - gradElev * curvAzim) / det;
+        *colOffs = MAX(MIN(*colOffs, 0.5f), -0.5f);
+        *rowOffs = MAX(MIN(*rowOffs, 0.5f), -0.5f);
+    }
+    else
+    {
+        for (i = 0; i < 3; i++)
+        {
+            cut[i] = power[1][i];
+        }
+        *colOffs = OdsDemo_angleParabolicOffset(cut);
+        for (i = 0; i < 3; i++)
+        {
+            cut[i] = power[i][1];
+        }
+        *rowOffs = OdsDemo_angleParabolicOffset(cut);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Finds the peak of the 2D angle spectrum in three steps:
+ *        - coarse search: the spectrum is evaluated on every
+ *          ODS_ANGLE_COARSE_STEP-th azimuth and elevation bin (row azimuth
+ *          spectra first, then the elevation spectra). The step is well below
+ *          the main lobe width of the 4 x 3 antenna grid, so the coarse peak
+ *          lies on the main lobe of the strongest target,
+ *        - fine search: starting at the coarse peak, move to the largest bin of
+ *          the 3 x 3 neighbourhood until the center is the local maximum,
+ *        - sub-bin interpolation with the 2D quadratic through the 3 x 3
+ *          neighbourhood power, see OdsDemo_angleQuadFit2D.
+ *      All spectrum values come from the steering vector table, there is no
+ *      zero padded grid.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Fractional elevation bin of the peak, in [-0.5, numAngleBins - 0.5]
+ *  @param[out] colIdx  Fractional azimuth bin of the peak, in [-0.5, numAngleBins - 0.5]
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angle2DPeakSteerSearch(OdsDemo_DSS_DataPathObj *obj, float *rowIdx, float *colIdx)
+{
+    float gridRe[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS];
+    float gridIm[ODS_ANT_GRID_NUM_ROWS][ODS_ANT_GRID_NUM_COLS];
+    float power[3][3];
+    float rowOffs, colOffs;
+    const float * restrict steer = obj->azimElevSteerVec;
+    float * restrict rowSpec = obj->azimElevRowSpec;
+    uint32_t numAngleBins = obj->numAngleBins;
+    uint32_t numCoarseBins = numAngleBins / ODS_ANGLE_COARSE_STEP;
+    uint32_t binMask = numAngleBins - 1;
+    uint32_t row, col, azimIdx, elevIdx, i, j, step, bestI, bestJ;
+    uint32_t peakRow = 0, peakCol = 0;
+    float re, im, mag, maxVal = 0;
+    const float *w;
+    float *spec;
+
+    /* Arrange the virtual antennas on the grid */
+    OdsDemo_angle2DGrid(obj, gridRe, gridIm);
+
+    /* Coarse search, azimuth spectra of the grid rows */
+    for (azimIdx = 0; azimIdx < numCoarseBins; azimIdx++)
+    {
+        w = &steer[2 * ODS_ANT_GRID_STEER_LEN * azimIdx * ODS_ANGLE_COARSE_STEP];
+        for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+        {
+            re = 0;
+            im = 0;
+            for (col = 0; col < ODS_ANT_GRID_NUM_COLS; col++)
+            {
+                re += gridRe[row][col] * w[2 * col] - gridIm[row][col] * w[2 * col + 1];
+                im += gridRe[row][col] * w[2 * col + 1] + gridIm[row][col] * w[2 * col];
+            }
+            spec = &rowSpec[2 * (row * numCoarseBins + azimIdx)];
+            spec[0] = re;
+            spec[1] = im;
+        }
+    }
+
+    /* Coarse search, elevation spectra */
+    for (elevIdx = 0; elevIdx < numCoarseBins; elevIdx++)
+    {
+        w = &steer[2 * ODS_ANT_GRID_STEER_LEN * elevIdx * ODS_ANGLE_COARSE_STEP];
+        for (azimIdx = 0; azimIdx < numCoarseBins; azimIdx++)
+        {
+            re = 0;
+            im = 0;
+            for (row = 0; row < ODS_ANT_GRID_NUM_ROWS; row++)
+            {
+                spec = &rowSpec[2 * (row * numCoarseBins + azimIdx)];
+                re += spec[0] * w[2 * row] - spec[1] * w[2 * row + 1];
+                im += spec[0] * w[2 * row + 1] + spec[1] * w[2 * row];
+            }
+            mag = re * re + im * im;
+            if (mag > maxVal)
+            {
+                maxVal  = mag;
+                peakRow = elevIdx * ODS_ANGLE_COARSE_STEP;
+                peakCol = azimIdx * ODS_ANGLE_COARSE_STEP;
+            }
+        }
+    }
+
+    /* Fine search, the coarse peak is at most ODS_ANGLE_COARSE_STEP/2 bins
+       from the local maximum in either direction */
+    for (step = 0; step <= ODS_ANGLE_COARSE_STEP; step++)
+    {
+        OdsDemo_angle2DSteerNeighbourhood(obj, gridRe, gridIm, peakRow, peakCol, power);
+
+        bestI = 1;
+        bestJ = 1;
+        for (j = 0; j < 3; j++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                if (power[j][i] > power[bestJ][bestI])
+                {
+                    bestI = i;
+                    bestJ = j;
+                }
+            }
+        }
+
+        if (((bestI == 1) && (bestJ == 1)) || (step == ODS_ANGLE_COARSE_STEP))
+        {
+            break;
+        }
+        peakRow = (peakRow + bestJ - 1) & binMask;
+        peakCol = (peakCol + bestI - 1) & binMask;
+    }
+
+    /* Sub-bin interpolation */
+    OdsDemo_angleQuadFit2D(power, &rowOffs, &colOffs);
+    *colIdx = (float) peakCol + colOffs;
+    *rowIdx = (float) peakRow + rowOffs;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function computes the 2D direction of arrival (i.e. azimuth and elevation angle) 
+ *      of the detected object. In case the angle for the detected object cannot be computed,
+ *      it populates the (x,y,z) co-ordinates for such objects to be (1000, 1000, 1000) meters.
+ *      The angles are taken from the integer bin peak of the 2D angle spectrum.
+ *
+ *  @param[in] obj  Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */ 
+void OdsDemo_angleEstimationAzimElevGrid(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex)
+{
+    float range;
+    float rangeResolution = obj->rangeResolution;
+    double theta,phi,az_freq,el_freq;
+    float x,y,z;
+    int32_t fft_2D_peak_row_idx,fft_2D_peak_col_idx;
+    uint32_t numAngleBins = obj->numAngleBins;
+    uint32_t xyzOutputQFormat = obj->xyzOutputQFormat;
+
+    #define ONE_QFORMAT (1 << xyzOutputQFormat)
+
+    /* Calculate X and Y co-ordintes in meters in Q8 format */
+    
+    /* compute the range of the detected object*/
+    range = OdsDemo_detObjRangeIdx(obj, objIndex) * rangeResolution;
+
+#ifdef ODS_ANGLE_2D_FULL_FFT
+    OdsDemo_angle2DPeakFullFft(obj, &fft_2D_peak_row_idx, &fft_2D_peak_col_idx);
+#else
+    OdsDemo_angle2DPeakPruned(obj, &fft_2D_peak_row_idx, &fft_2D_peak_col_idx);
+#endif
     
     /* convert the peak indices b/w [-Fs/2, Fs/2]*/
     if (fft_2D_peak_row_idx > (numAngleBins >> 1))
@@ -4082,3 +7008,81 @@ void OdsDemo_angleEstimationAzimElev(OdsDemo_DSS_DataPathObj *obj, uint32_t objI
 }
 
 
+/**
+ *  @b Description
+ *  @n
+ *      Same as OdsDemo_angleEstimationAzimElevGrid, with the angles taken from
+ *      the interpolated peak of OdsDemo_angle2DPeakSteerSearch. With the
+ *      normalized spatial frequencies u = sin(theta)cos(phi) (azimuth) and
+ *      w = sin(phi) (elevation) of the peak, the coordinates follow without
+ *      trigonometry:
+ *          x = range * u, y = range * sqrt(1 - u^2 - w^2), z = range * w.
+ *
+ *  @param[in] obj  Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angleEstimationAzimElevSteer(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex)
+{
+    float range, rowIdx, colIdx, u, w, uwSqr;
+    float numAngleBins = (float) obj->numAngleBins;
+    float oneQFormat = (float) (1 << obj->xyzOutputQFormat);
+
+    range = OdsDemo_detObjRangeIdx(obj, objIndex) * obj->rangeResolution;
+
+    OdsDemo_angle2DPeakSteerSearch(obj, &rowIdx, &colIdx);
+
+    /* convert the peak indices b/w [-Fs/2, Fs/2]*/
+    if (rowIdx > 0.5f * numAngleBins)
+    {
+        rowIdx -= numAngleBins;
+    }
+    if (colIdx > 0.5f * numAngleBins)
+    {
+        colIdx -= numAngleBins;
+    }
+
+    u = 2.0f * colIdx / numAngleBins;
+    w = 2.0f * rowIdx / numAngleBins;
+    uwSqr = u * u + w * w;
+
+    if (uwSqr > 1.0f)
+    {
+        /* for objects who's DOA cannot be calculated */
+        obj->detObj2D[objIndex].x = (int16_t) ROUND(1000 * oneQFormat);
+        obj->detObj2D[objIndex].y = (int16_t) ROUND(1000 * oneQFormat);
+        obj->detObj2D[objIndex].z = (int16_t) ROUND(1000 * oneQFormat);
+
+        return;
+    }
+
+    obj->detObj2D[objIndex].x = (int16_t) ROUND(range * u * oneQFormat);
+    obj->detObj2D[objIndex].y = (int16_t) ROUND(range * sqrtsp(1.0f - uwSqr) * oneQFormat);
+    obj->detObj2D[objIndex].z = (int16_t) ROUND(range * w * oneQFormat);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function computes the 2D direction of arrival (i.e. azimuth and elevation angle) 
+ *      of the detected object, see OdsDemo_angleEstimationAzimElevSteer and
+ *      OdsDemo_angleEstimationAzimElevGrid (ODS_ANGLE_2D_GRID_SEARCH).
+ *
+ *  @param[in] obj  Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */ 
+void OdsDemo_angleEstimationAzimElev(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex)
+{
+#ifdef ODS_ANGLE_2D_GRID_SEARCH
+    OdsDemo_angleEstimationAzimElevGrid(obj, objIndex);
+#else
+    OdsDemo_angleEstimationAzimElevSteer(obj, objIndex);
+#endif
+}
+
+
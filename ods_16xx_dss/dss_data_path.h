@@ -54,12 +54,13 @@ extern "C" {
 #endif
 
 #define BYTES_PER_SAMP_1D (2*sizeof(int16_t))  /*16 bit real, 16 bit imaginary => 4 bytes */
+#define BYTES_PER_SAMP_1D_PACKED (2*sizeof(int8_t))  /*8 bit real, 8 bit imaginary (packed radar cube) => 2 bytes */
 #define BYTES_PER_SAMP_2D (2*sizeof(int32_t))  /*32 bit real, 32 bit imaginary => 8 bytes */
 #define BYTES_PER_SAMP_DET sizeof(uint16_t) /*pre-detection matrix is 16 bit unsigned =>2 bytes*/
 
 //DETECTION (CFAR-CA) related parameters
-#define MMW_MAX_OBJ_OUT 100
-#define MAX_DET_OBJECTS_RAW 2048 /* same as xwr14xx, should not exceed 65536 */
+#define MMW_MAX_OBJ_OUT 100 /* default output list capacity, see OdsDemo_ObjCapCfg */
+#define MAX_DET_OBJECTS_RAW 2048 /* default raw list capacity, same as xwr14xx, should not exceed 65536 */
 #define DET_THRESH_MULT 25
 #define DET_THRESH_SHIFT 5 //DET_THRESH_MULT and DET_THRESH_SHIFT together define the CFAR-CA threshold
 #define DET_GUARD_LEN 4 // this is the one sided guard lenght
@@ -81,7 +82,49 @@ extern "C" {
 #define MMW_NOISE_AVG_MODE_CFAR_CAGO     ((uint8_t)1U)
 /*!< cumulative average of the side (left or right) that is smaller */
 #define MMW_NOISE_AVG_MODE_CFAR_CASO     ((uint8_t)2U)
-
+/*!< ordered statistic of left+right, see OdsDemo_cfarOs (also along Doppler) */
+#define MMW_NOISE_AVG_MODE_CFAR_OS       ((uint8_t)3U)
+/*!< range CFAR only: one two dimensional cumulative average over the detection
+     matrix (OdsDemo_cfarCa2DLine) replaces the CFAR along Doppler and range, with
+     the range window and threshold of the range CFAR and the Doppler window of
+     the Doppler CFAR. Runs as MMW_NOISE_AVG_MODE_CFAR_CA along Doppler and range
+     when the summed area table does not cover the Doppler window */
+#define MMW_NOISE_AVG_MODE_CFAR_CA_2D    ((uint8_t)4U)
+
+
+/*! @brief Azimuth (and elevation) FFT size */
+#define ODS_NUM_ANGLE_BINS 64
+
+/*! @brief Row (elevation) and column (azimuth) of each receive and transmit
+    antenna on the half wavelength grid of OdsDemo_angleEstimationAzimElev.
+    Virtual antenna txIdx*numRxAntennas + rxIdx sits at the sum of its
+    transmit and receive antenna positions. */
+#define ODS_ANT_RX_ROW  {2, 2, 1, 0}
+#define ODS_ANT_RX_COL  {0, 2, 2, 2}
+#define ODS_ANT_TX_ROW  {0, 0}
+#define ODS_ANT_TX_COL  {0, 1}
+
+/*! @brief Number of rows and columns of the virtual antenna grid */
+#define ODS_ANT_GRID_NUM_ROWS   3
+#define ODS_ANT_GRID_NUM_COLS   4
+
+/*! @brief Length of the steering vectors of one angle bin,
+    max(ODS_ANT_GRID_NUM_ROWS, ODS_ANT_GRID_NUM_COLS) */
+#define ODS_ANT_GRID_STEER_LEN  4
+
+/*! @brief Angle bin step of the coarse steering vector search */
+#define ODS_ANGLE_COARSE_STEP   4
+
+/*! @brief L2 heap used for allocating buffers in L2 SRAM,
+    mostly scratch buffers */
+#define MMW_L2_HEAP_SIZE    0x6000U
+
+/*! @brief L1 heap used for allocating buffers in L1D SRAM,
+    mostly scratch buffers */
+#define MMW_L1_HEAP_SIZE    0x4000U
+
+#define DOA_2D_STORAGE_SIZE (ODS_NUM_ANGLE_BINS*ODS_NUM_ANGLE_BINS*sizeof(cmplx32ReIm_t))
+#define L3_HEAP_SIZE        (SOC_XWR16XX_DSS_L3RAM_SIZE - DOA_2D_STORAGE_SIZE)
 
 #define OdsDemo_CliCommonCfg_t    MmwDemo_CliCommonCfg_t
 #define OdsDemo_CliCfg_t          MmwDemo_CliCfg_t
@@ -104,6 +147,89 @@ extern "C" {
 //#define EDMA_MATRIX2_INPUT_BLOCKING
 //#define EDMA_3D_INPUT_BLOCKING
 
+/* If the following define is uncommented, the 2D angle estimation runs the full
+   numAngleBins x numAngleBins FFT over the zero padded virtual antenna grid
+   (reference implementation). Otherwise only the non-zero rows and columns of
+   the grid are transformed, see OdsDemo_angle2DPeakPruned. */
+//#define ODS_ANGLE_2D_FULL_FFT
+
+/* If the following define is uncommented, the 2D angle estimation takes the
+   integer bin peak of the 2D angle spectrum and converts it with double
+   precision trigonometry (reference implementation). Otherwise the peak is
+   found by a coarse to fine steering vector search with quadratic sub-bin
+   interpolation, see OdsDemo_angle2DPeakSteerSearch. */
+//#define ODS_ANGLE_2D_GRID_SEARCH
+
+/* If the following define is uncommented, the Doppler processing computes the
+   log2 magnitude and accumulates it over the virtual antennas in one pass,
+   see OdsDemo_log2Abs32Accum. Its log2 approximation is not the one of
+   mmwavelib_log2Abs32, so the detection matrix and with it the CFAR
+   thresholds shift. Otherwise mmwavelib_log2Abs32 and mmwavelib_accum16 are
+   used (reference implementation). Left commented out until the
+   dopplerFusedAccum bench accuracy has been checked on the device. */
+//#define ODS_DOPPLER_FUSED_LOG2
+
+/* If the following define is uncommented, the detection matrix based peak
+   grouping streams the detection matrix rows into L2 by EDMA, one row per
+   range bin, see OdsDemo_cfarPeakGroupingStaged. Otherwise the kernel of
+   each detection is read from the detection matrix in L3 (reference
+   implementation). Left commented out until measured faster on the device
+   for frames with many detections. */
+//#define ODS_PEAK_GROUPING_STAGED
+
+/*! @brief Number of detection matrix rows held in L2 by the staged peak
+           grouping: the three rows around a range bin and the next row,
+           must be a power of 2 */
+#define ODS_PEAK_GROUP_NUM_ROW_SLOTS 4
+
+/*! @brief Number of fractional bits of the static clutter map entries */
+#define ODS_STATIC_CLUTTER_MAP_FRAC_BITS 8
+
+/*! @brief Maximum number of (range, Doppler) cells in the Doppler spectra cache,
+    cells detected beyond it are recomputed from the radar cube */
+#define ODS_DOPPLER_SPEC_CACHE_MAX_CELLS 256
+
+/*! @brief Maximum size in bytes of the per range bin Doppler spectra (2D FFT
+    output of all virtual antennas) kept in L1 for the Doppler spectra cache */
+#define ODS_DOPPLER_SPEC_STAGE_MAX_SIZE 0x2000U
+
+/*! @brief Number of fractional bits of the Doppler FFT input loaded from the
+    block floating point radar cube, the gain of the Q19 2D window over the
+    radar cube samples, so that exponent 0 gives the fixed point results */
+#define ODS_RADAR_CUBE_BFP_FRAC_BITS 4
+
+/*! @brief log2 of the number of range bins sharing a block exponent in the
+    packed radar cube */
+#define ODS_RADAR_CUBE_PACK_BLOCK_SHIFT 4
+
+/*! @brief Number of fractional bits of the sub-bin range and Doppler
+    offsets and of the indices of the sub-bin detected points TLV */
+#define ODS_SUB_BIN_QFORMAT 8
+
+/*! @brief Complex sample of the packed radar cube, 8-bit mantissas */
+typedef struct OdsDemo_cmplx8ReIm_t
+{
+    int8_t real;
+    int8_t imag;
+} OdsDemo_cmplx8ReIm;
+
+/*! @brief Bit growth statistics of the block floating point radar cube of
+    the last frame, reported in the stats TLV */
+typedef struct OdsDemo_radarCubeBfpStats_t
+{
+    /*! @brief Smallest block exponent */
+    uint8_t expMin;
+
+    /*! @brief Largest block exponent */
+    uint8_t expMax;
+
+    /*! @brief Number of blocks with a non zero exponent */
+    uint32_t numScaledBlocks;
+
+    /*! @brief Number of Doppler FFT input samples clipped to the 2D FFT headroom */
+    uint32_t numClipped;
+} OdsDemo_radarCubeBfpStats;
+
 /*! @brief DSP cycle profiling structure to accumulate different
     processing times in chirp and frame processing periods */
 typedef struct cycleLog_t_ {
@@ -127,6 +253,17 @@ typedef struct OdsDemo_objRaw
     uint16_t   peakVal;      /*!< @brief Peak value */
 } OdsDemo_objRaw_t;
 
+/*!
+ *  @brief    Sub-bin offsets of a detected object from its range and Doppler
+ *  indices, in Q(ODS_SUB_BIN_QFORMAT), within +/- half a bin
+ *
+ */
+typedef struct OdsDemo_subBinOffs
+{
+    int16_t    rangeOffs;    /*!< @brief Range offset */
+    int16_t    dopplerOffs;  /*!< @brief Doppler offset */
+} OdsDemo_subBinOffs_t;
+
 /*!
  *  @brief    Active Doppler lines, lines (bins) on which the
  *            CFAR detector detected objects during the detections in
@@ -141,8 +278,12 @@ typedef struct OdsDemo_1D_DopplerLines
                                    The LSB bit of the first word corresponds to
                                    Doppler bin zero of the range/Doppler
                                    detection matrix*/
-    uint16_t   currentIndex;     /*!< @brief starting index for the search
-                                   for next active Doppler line */
+    uint32_t   currentBits;      /*!< @brief active Doppler lines of the mask
+                                   word currentIndex not returned yet by
+                                   OdsDemo_getDopplerLine, zero if the word
+                                   is not loaded yet */
+    uint16_t   currentIndex;     /*!< @brief mask word the search for the
+                                   next active Doppler line starts from */
     uint16_t    dopplerLineMaskLen;   /*!< @brief size of dopplerLineMask array, (number of
                                     32_bit words, for example for Doppler FFT
                                     size of 64 this length is equal to 2)*/
@@ -343,6 +484,23 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief twiddle table for 1D FFT */
     cmplx16ReIm_t *twiddle16x16_1D;
 
+    /*! @brief twiddle table of the fused range FFT, overlaid with twiddle16x16_1D,
+               see OdsDemo_rangeFftGenTwiddle */
+    cmplx16ReIm_t *twiddleRangeFft;
+
+    /*! @brief 32-bit scratch of the fused range FFT in L1, NULL if it does not fit,
+               in which case the range FFT runs as windowing + zero padding + DSP_fft16x16 */
+    cmplx32ReIm_t *rangeFftScratch;
+
+    /*! @brief Batched range FFT configuration of the sub-frame */
+    OdsDemo_RangeFftBatchCfg rangeFftBatchCfg;
+
+    /*! @brief 1 if the range FFT of all Rx antennas of a chirp is computed by one
+               EDMA transfer and one OdsDemo_rangeFftWin16x16Batch call, 0 for the
+               per antenna ping/pong. Set by OdsDemo_dataPathConfigBuffers, the
+               adcDataIn and rangeFftScratch buffers then hold all Rx antennas */
+    uint8_t rangeFftBatch;
+
     /*! @brief window coefficients for 1D FFT */
     int16_t *window1D;
 
@@ -367,10 +525,13 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief 2D FFT output */
     cmplx32ReIm_t *fftOut2D;
 
-    /*! @brief log2 absolute computation output buffer */
+    /*! @brief log2 absolute computation output buffer of mmwavelib_log2Abs32,
+               not allocated with ODS_DOPPLER_FUSED_LOG2 */
     uint16_t *log2Abs;
 
-    /*! @brief accumulated sum of log2 absolute over the antennae */
+    /*! @brief accumulated sum of log2 absolute over the antennae, double
+               buffered: range bin r uses half (r & 1) while the detection
+               matrix EDMA reads the other */
     uint16_t *sumAbs;
 
     /*! @brief input buffer for CFAR processing from the detection matrix */
@@ -379,6 +540,61 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief CFAR output objects index buffer */
     uint16_t *cfarDetObjIndexBuf;
 
+    /*! @brief Training cell histogram of the ordered statistic CFAR,
+               ODS_CFAR_OS_HIST_LEN, all zero between two CFAR calls */
+    uint16_t *cfarOsHist;
+
+    /*! @brief Summed area table of the detection matrix for the two dimensional
+               CFAR (L3), NULL if the range CFAR was not configured for it */
+    uint32_t *cfar2DSat;
+
+    /*! @brief Doppler padding of cfar2DSat, the largest one sided Doppler
+               window it can be used with */
+    uint16_t cfar2DSatDopplerPad;
+
+    /*! @brief Threshold table configuration of the range CFAR of the sub-frame */
+    OdsDemo_CfarThrTableCfg cfarThrTableCfgRange;
+
+    /*! @brief Threshold table configuration of the Doppler CFAR of the sub-frame */
+    OdsDemo_CfarThrTableCfg cfarThrTableCfgDoppler;
+
+    /*! @brief CFAR threshold calibration configuration of the sub-frame */
+    OdsDemo_CfarThrCalibCfg cfarThrCalibCfg;
+
+    /*! @brief Threshold offset of the range CFAR per range bin (L2), NULL
+               without table and calibration */
+    int16_t *cfarThrOffsRange;
+
+    /*! @brief Threshold offset of the Doppler CFAR per range bin (L2), NULL
+               without table and calibration. Not used by the two dimensional
+               CFAR, which takes cfarThrOffsRange only */
+    int16_t *cfarThrOffsDoppler;
+
+    /*! @brief Noise peak above the noise average per range bin summed over
+               the calibration frames (L2), NULL without calibration */
+    uint32_t *cfarThrCalibAccum;
+
+    /*! @brief Calibration frames left, 0 once the threshold tables are
+               calibrated */
+    uint16_t cfarThrCalibFramesLeft;
+
+    /*! @brief Detection matrix rows of the detection matrix based peak
+               grouping, ring of ODS_PEAK_GROUP_NUM_ROW_SLOTS rows (L2),
+               only with ODS_PEAK_GROUPING_STAGED */
+    uint16_t *peakGroupRows;
+
+    /*! @brief Per range bin end of its detections in peakGroupOrder,
+               numRangeBins + 1 entries */
+    uint16_t *peakGroupRangeEnd;
+
+    /*! @brief Raw detection indices sorted by range bin for the detection
+               matrix based peak grouping */
+    uint16_t *peakGroupOrder;
+
+    /*! @brief One bit per raw detection, set if it is kept by the detection
+               matrix based peak grouping */
+    uint32_t *peakGroupKeep;
+
     /*! @brief input for Azimuth FFT */
     cmplx32ReIm_t *azimuthIn;
 
@@ -394,6 +610,23 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief Pointer to single point DFT coefficients used for Azimuth processing */
     cmplx16ImRe_t *azimuthModCoefs;
 
+    /*! @brief Pointer to the Doppler compensation coefficient of each Doppler
+               bin, used by the 2D BPM decoding (empty if BPM is disabled) */
+    cmplx16ImRe_t *bpmDopplerCompCoefs;
+
+    /*! @brief numAngleBins point DFT coefficients exp(-j*2*pi*k/numAngleBins),
+               (cos, sin) pairs, for the pruned 2D angle DFT */
+    float   *azimElevDftCoefs;
+
+    /*! @brief Azimuth spectra of the virtual antenna grid rows, (real, imag)
+               pairs, ODS_ANT_GRID_NUM_ROWS x numAngleBins */
+    float   *azimElevRowSpec;
+
+    /*! @brief Steering vectors of the virtual antenna grid, exp(-j*2*pi*k*n/numAngleBins)
+               for angle bin k and grid row/column n < ODS_ANT_GRID_STEER_LEN,
+               (real, imag) pairs, numAngleBins x ODS_ANT_GRID_STEER_LEN */
+    float   *azimElevSteerVec;
+
     /*! @brief Pointer to DC range signature compensation buffer */
     cmplx32ImRe_t *dcRangeSigMean;
 
@@ -403,12 +636,76 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief log2 of number of averaged chirps */
     uint8_t log2NumAvgChirps;
 
+    /*! @brief Pointer to the static clutter map (L3, not overlaid). Zero Doppler
+               estimate of range bin r for the a-th virtual antenna in processing
+               order at clutterMap[r * numRxAntennas * numTxAntennas + a], with
+               ODS_STATIC_CLUTTER_MAP_FRAC_BITS fractional bits */
+    cmplx32ReIm_t *clutterMap;
+
+    /*! @brief Static clutter filter configuration */
+    OdsDemo_StaticClutterCfg staticClutterCfg;
+
+    /*! @brief Set once clutterMap holds an estimate, cleared on (re)configuration */
+    uint8_t clutterMapValid;
+
+    /*! @brief Doppler spectra cache (L3): 2D FFT output of the virtual antennas
+               (in processing order) for the cells flagged by the CFAR along
+               Doppler, numVirtualAntennas per cell, so that the angle estimation
+               does not recompute them from the radar cube */
+    cmplx32ReIm_t *dopplerSpecCache;
+
+    /*! @brief Cell of each cache entry, rangeIdx * numDopplerBins + dopplerIdx,
+               in ascending order */
+    uint32_t *dopplerSpecCacheCell;
+
+    /*! @brief Zero Doppler bins of the current range bin before the Rx channel
+               compensation, numVirtualAntennas */
+    cmplx32ReIm_t *dopplerSpecZeroBin;
+
+    /*! @brief Capacity of the Doppler spectra cache in cells, 0 if disabled */
+    uint16_t dopplerSpecCacheSize;
+
+    /*! @brief Number of cells in the Doppler spectra cache in the current frame */
+    uint16_t dopplerSpecCacheNumCells;
+
     /*! @brief Half bin needed for doppler correction as part of Azimuth processing */
     cmplx16ImRe_t azimuthModCoefsHalfBin;
 
     /*! @brief Pointer to Radar Cube memory in L3 RAM */
     cmplx16ReIm_t *radarCube;
 
+    /*! @brief Radar cube layout configuration of the sub-frame */
+    OdsDemo_RadarCubeLayoutCfg radarCubeLayoutCfg;
+
+    /*! @brief Block floating point radar cube configuration of the sub-frame */
+    OdsDemo_RadarCubeBfpCfg radarCubeBfpCfg;
+
+    /*! @brief 1 if the radar cube holds OdsDemo_cmplx8ReIm mantissas, chosen
+               when the 16-bit radar cube does not fit in L3 */
+    uint8_t radarCubePacked;
+
+    /*! @brief Bytes per radar cube sample, BYTES_PER_SAMP_1D or BYTES_PER_SAMP_1D_PACKED */
+    uint8_t radarCubeSampleBytes;
+
+    /*! @brief Block exponents of the radar cube in L3, NULL if the radar cube is
+               16-bit fixed point. Exponent of chirp d of the v-th virtual antenna
+               (Tx antenna major) for range block b at
+               radarCubeExp[(v * radarCubeExpNumBlocks + b) * numDopplerBins + d]; the
+               samples of the block times 2^exponent are in fixed point units */
+    uint8_t *radarCubeExp;
+
+    /*! @brief log2 of the number of range bins per block exponent */
+    uint8_t radarCubeExpBlockShift;
+
+    /*! @brief Number of block exponents per chirp and virtual antenna */
+    uint16_t radarCubeExpNumBlocks;
+
+    /*! @brief Block exponents of the Rx antennas of the current chirp */
+    uint8_t rangeFftExp[SYS_COMMON_NUM_RX_CHANNEL];
+
+    /*! @brief Bit growth statistics of the block floating point radar cube */
+    OdsDemo_radarCubeBfpStats radarCubeBfpStats;
+
     /*! @brief Pointer to range/Doppler log2 magnitude detection matrix in L3 RAM */
     uint16_t *detMatrix;
 
@@ -461,6 +758,21 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief Number of detected objects */
     uint16_t numDetObjRaw;
 
+    /*! @brief Object list capacity configuration of the sub-frame */
+    OdsDemo_ObjCapCfg objCapCfg;
+
+    /*! @brief Capacity of detObj2DRaw */
+    uint16_t maxNumDetObjRaw;
+
+    /*! @brief Capacity of detObj2D and detObj2dAzimIdx */
+    uint16_t maxNumDetObj;
+
+    /*! @brief CFAR detections of the frame that did not fit in detObj2DRaw */
+    uint32_t numDetObjRawDropped;
+
+    /*! @brief Objects of the frame that did not fit in detObj2D */
+    uint32_t numDetObjDropped;
+
     /*! @brief Detected Doppler lines */
     OdsDemo_1D_DopplerLines_t detDopplerLines;
 
@@ -473,6 +785,13 @@ typedef struct OdsDemo_DSS_DataPathObj_t
     /*! @brief Detected objects azimuth index for debugging */
     uint8_t *detObj2dAzimIdx;
 
+    /*! @brief Sub-bin interpolation configuration of the sub-frame */
+    OdsDemo_SubBinInterpCfg subBinInterpCfg;
+
+    /*! @brief Sub-bin offsets of the detected objects, NULL if the sub-bin
+               interpolation is disabled */
+    OdsDemo_subBinOffs_t *detObjSubBin;
+
     /*! @brief Timing information */
     OdsDemo_timingInfo_t timingInfo;
 
@@ -566,6 +885,18 @@ int32_t OdsDemo_dataPathConfigEdma(OdsDemo_DSS_DataPathObj *obj);
  */
 int32_t OdsDemo_dataPathConfigCQEdma(OdsDemo_DSS_DataPathObj *obj);
 
+/**
+ *  @b Description
+ *  @n
+ *   Waits for the radar cube data of one virtual antenna to be transferred
+ *   to the ping or pong buffer for the 2D-FFT calculation.
+ *  @param[in] obj  Pointer to data path object
+ *  @param[in] pingPongId ping-pong id (ping is 0 and pong is 1)
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_dataPathWait2DInputData(OdsDemo_DSS_DataPathObj *obj, uint32_t pingPongId);
+
 /**
  *  @b Description
  *  @n
@@ -637,6 +968,50 @@ void OdsDemo_interFrameProcessing(OdsDemo_DSS_DataPathObj *obj);
  */
 uint32_t OdsDemo_pow2roundup (uint32_t x);
 
+/**
+ *  @b Description
+ *  @n
+ *      Clears the active Doppler lines and restarts the iteration.
+ */
+void OdsDemo_resetDopplerLines(OdsDemo_1D_DopplerLines_t * ths);
+
+/**
+ *  @b Description
+ *  @n
+ *      Marks a Doppler line active.
+ */
+void OdsDemo_setDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t dopplerIndex);
+
+/**
+ *  @b Description
+ *  @n
+ *      Marks a list of Doppler lines active, ORing the mask a word at a time.
+ *
+ *  @param[in,out] ths          Active Doppler lines
+ *  @param[in]     dopplerIndex Doppler indices
+ *  @param[in]     num          Number of indices
+ *
+ *  @retval
+ *      Number of Doppler lines that were not active before the call
+ */
+uint32_t OdsDemo_setDopplerLines(OdsDemo_1D_DopplerLines_t * ths, const uint16_t *dopplerIndex,
+                                 uint32_t num);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns 1 if the Doppler line is active, 0 otherwise.
+ */
+uint32_t OdsDemo_isSetDopplerLine(OdsDemo_1D_DopplerLines_t * ths, uint16_t index);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the next active Doppler line, in increasing order after a
+ *      reset.
+ */
+int32_t OdsDemo_getDopplerLine(OdsDemo_1D_DopplerLines_t * ths);
+
 /**
  *  @b Description
  *  @n
@@ -663,6 +1038,474 @@ void OdsDemo_checkDynamicConfigErrors(OdsDemo_DSS_DataPathObj *obj);
  */
 void OdsDemo_dssDataPathStartCQEdma(OdsDemo_DSS_DataPathObj *ptrDataPathObj);
 
+/*! @brief L1, L2 and L3 heaps carved up by OdsDemo_dataPathConfigBuffers */
+extern uint8_t gMmwL1[MMW_L1_HEAP_SIZE];
+extern uint8_t gOdsL2[MMW_L2_HEAP_SIZE];
+extern uint8_t gOdsL3[L3_HEAP_SIZE];
+
+/**
+ *  @b Description
+ *  @n
+ *    Compensation of DC range antenna signature.
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_dcRangeSignatureCompensation(OdsDemo_DSS_DataPathObj *obj,  uint8_t chirpPingPongId);
+
+/**
+ *  @b Description
+ *  @n
+ *    Peak grouping of CFAR detected objects using the neighbouring cells of
+ *    the detection matrix. The peak groupings keep the maxNumObjOut strongest
+ *    objects in CFAR order when more remain, *numObjDropped is the number
+ *    left out.
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGrouping(MmwDemo_detectedObj*  objOut,
+                                  OdsDemo_objRaw_t * objRaw,
+                                  uint32_t numDetectedObjects,
+                                  uint16_t* detMatrix,
+                                  uint32_t numDopplerBins,
+                                  uint32_t maxRangeIdx,
+                                  uint32_t minRangeIdx,
+                                  uint32_t groupInDopplerDirection,
+                                  uint32_t groupInRangeDirection,
+                                  uint32_t maxNumObjOut,
+                                  uint32_t *numObjDropped);
+
+/**
+ *  @b Description
+ *  @n
+ *    Peak grouping of CFAR detected objects using only neighbouring cells
+ *    that were themselves detected by CFAR.
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGroupingCfarQualified(MmwDemo_detectedObj*  objOut,
+                                               OdsDemo_objRaw_t * objRaw,
+                                               uint32_t numDetectedObjects,
+                                               uint32_t numDopplerBins,
+                                               uint32_t maxRangeIdx,
+                                               uint32_t minRangeIdx,
+                                               uint32_t groupInDopplerDirection,
+                                               uint32_t groupInRangeDirection,
+                                               uint32_t maxNumObjOut,
+                                               uint32_t *numObjDropped);
+
+/**
+ *  @b Description
+ *  @n
+ *    OdsDemo_cfarPeakGroupingCfarQualified with the neighbouring detections
+ *    found in one pass over the list, which must be ordered by Doppler line
+ *    and then by range as the detection chain produces it.
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGroupingCfarQualifiedIndexed(MmwDemo_detectedObj*  objOut,
+                                                      OdsDemo_objRaw_t * objRaw,
+                                                      uint32_t numDetectedObjects,
+                                                      uint32_t numDopplerBins,
+                                                      uint32_t maxRangeIdx,
+                                                      uint32_t minRangeIdx,
+                                                      uint32_t groupInDopplerDirection,
+                                                      uint32_t groupInRangeDirection,
+                                                      uint32_t maxNumObjOut,
+                                                      uint32_t *numObjDropped);
+
+#ifdef ODS_PEAK_GROUPING_STAGED
+/**
+ *  @b Description
+ *  @n
+ *    OdsDemo_cfarPeakGrouping on the peak grouping configuration of obj with
+ *    the detection matrix rows streamed to L2 by EDMA, each row once.
+ *
+ *  @retval
+ *      Number of detected objects after grouping
+ */
+uint32_t OdsDemo_cfarPeakGroupingStaged(OdsDemo_DSS_DataPathObj *obj, uint32_t numDetectedObjects);
+#endif
+
+/**
+ *  @b Description
+ *  @n
+ *    Refines the range and Doppler indices of the numDetObj detected objects
+ *    to a fraction of a bin into detObjSubBin. The offset in each dimension is
+ *    the vertex of the parabola through the detection matrix at the object
+ *    and at its two neighbours, the detection matrix being a log2 magnitude
+ *    this is a Gaussian fit of the window main lobe. The Doppler neighbours
+ *    wrap around, objects on the first or last range bin keep their range
+ *    index.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_detObjSubBinInterp(OdsDemo_DSS_DataPathObj *obj);
+
+/**
+ *  @b Description
+ *  @n
+ *    Adds the noise peak above the noise average of a range bin to the CFAR
+ *    threshold calibration: the largest Doppler bin of the detection matrix
+ *    row less the mean of the row.
+ *
+ *  @param[in]  obj       Pointer to data path object
+ *  @param[in]  row       Detection matrix row, numDopplerBins
+ *  @param[in]  rangeIdx  Range bin of the row
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_cfarThrCalibAccum(OdsDemo_DSS_DataPathObj *obj, const uint16_t *row, uint32_t rangeIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *    Ends a CFAR threshold calibration frame. After the last one the
+ *    threshold of every range bin is set margin above its mean noise peak
+ *    over the calibration frames: the offset of the range and of the
+ *    Doppler CFAR is that level less the thresholdScale of the CFAR.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_cfarThrCalibFrameDone(OdsDemo_DSS_DataPathObj *obj);
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes the azimuth and elevation of a detected object from its
+ *      virtual antenna symbols in azimuthIn.
+ *
+ *  @param[in] obj  Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angleEstimationAzimElev(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex);
+
+/**
+ *  @b Description
+ *  @n
+ *      Finds the peak of the 2D angle spectrum of the virtual antennas in
+ *      azimuthIn by a numAngleBins x numAngleBins FFT of the zero padded
+ *      antenna grid. Overwrites azimuthIn.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Elevation bin of the peak
+ *  @param[out] colIdx  Azimuth bin of the peak
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angle2DPeakFullFft(OdsDemo_DSS_DataPathObj *obj, int32_t *rowIdx, int32_t *colIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      Same as OdsDemo_angle2DPeakFullFft, evaluating only the non-zero rows
+ *      and columns of the antenna grid and skipping azimuth bins that cannot
+ *      hold the peak. Does not modify azimuthIn.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Elevation bin of the peak
+ *  @param[out] colIdx  Azimuth bin of the peak
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angle2DPeakPruned(OdsDemo_DSS_DataPathObj *obj, int32_t *rowIdx, int32_t *colIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      Finds the peak of the 2D angle spectrum of the virtual antennas in
+ *      azimuthIn by a coarse steering vector search on every
+ *      ODS_ANGLE_COARSE_STEP-th angle bin, a local ascent on the full
+ *      numAngleBins grid and quadratic interpolation over the 3 x 3
+ *      neighbouring bins. Does not modify azimuthIn.
+ *
+ *  @param[in]  obj     Pointer to data path object
+ *  @param[out] rowIdx  Fractional elevation bin of the peak
+ *  @param[out] colIdx  Fractional azimuth bin of the peak
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angle2DPeakSteerSearch(OdsDemo_DSS_DataPathObj *obj, float *rowIdx, float *colIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      2D angle estimation from the integer bin peak of the 2D angle
+ *      spectrum (OdsDemo_angle2DPeakFullFft or OdsDemo_angle2DPeakPruned).
+ *
+ *  @param[in] obj       Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angleEstimationAzimElevGrid(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex);
+
+/**
+ *  @b Description
+ *  @n
+ *      2D angle estimation from the interpolated peak of
+ *      OdsDemo_angle2DPeakSteerSearch.
+ *
+ *  @param[in] obj       Pointer to data path object
+ *  @param[in] objIndex  Index for the detected object
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_angleEstimationAzimElevSteer(OdsDemo_DSS_DataPathObj *obj, uint32_t objIndex);
+
+/**
+ *  @b Description
+ *  @n
+ *      Removes the static clutter from the chirps of one range bin and
+ *      virtual antenna, see OdsDemo_DSS_DataPathObj::clutterMap.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in,out] chirpBuf Chirp samples, numDopplerBins
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  virtAntIdx  Virtual antenna index in processing order
+ *  @param[in]  update      1 - update the clutter map with the mean of the
+ *                          chirps first (Doppler processing), 0 - reuse the
+ *                          estimate of the current frame (azimuth processing)
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_staticClutterRemoval(OdsDemo_DSS_DataPathObj *obj,
+                                  cmplx16ReIm_t *chirpBuf,
+                                  uint32_t rangeIdx,
+                                  uint32_t virtAntIdx,
+                                  uint8_t update);
+
+/**
+ *  @b Description
+ *  @n
+ *      Loads the chirps of one range bin and virtual antenna of the block
+ *      floating point radar cube as Doppler FFT input: scales them by their
+ *      block exponents, removes the static clutter if enabled and applies the
+ *      2D window. With exponent 0 the result is the one of the static clutter
+ *      removal and mmwavelib_windowing16x32 on the fixed point radar cube.
+ *      Samples beyond the headroom of DSP_fft32x32 are clipped, and counted in
+ *      OdsDemo_DSS_DataPathObj::radarCubeBfpStats if update is set.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  chirpBuf    Chirp mantissas, numDopplerBins
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  virtAntIdx  Virtual antenna index in processing order
+ *  @param[in]  update      1 - update the clutter map (Doppler processing),
+ *                          0 - reuse the estimate of the current frame
+ *  @param[out] out         Windowed Doppler FFT input, numDopplerBins
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_radarCubeBfpLoad(OdsDemo_DSS_DataPathObj *obj,
+                              const cmplx16ReIm_t *chirpBuf,
+                              uint32_t rangeIdx,
+                              uint32_t virtAntIdx,
+                              uint8_t update,
+                              cmplx32ReIm_t *out);
+
+/**
+ *  @b Description
+ *  @n
+ *      Single Doppler bin of one range bin and virtual antenna of the block
+ *      floating point radar cube, the input being loaded as in
+ *      @ref OdsDemo_radarCubeBfpLoad without clutter map update. With exponent
+ *      0 the result is the one of mmwavelib_dftSingleBinWithWindow.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  chirpBuf    Chirp mantissas, numDopplerBins
+ *  @param[in]  rangeIdx    Range bin index
+ *  @param[in]  virtAntIdx  Virtual antenna index in processing order
+ *  @param[in]  dopplerIdx  Doppler bin index
+ *  @param[out] out         Doppler bin
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_radarCubeBfpDftSingleBin(OdsDemo_DSS_DataPathObj *obj,
+                                      const cmplx16ReIm_t *chirpBuf,
+                                      uint32_t rangeIdx,
+                                      uint32_t virtAntIdx,
+                                      uint32_t dopplerIdx,
+                                      cmplx32ReIm_t *out);
+
+/**
+ *  @b Description
+ *  @n
+ *      Packs 16-bit samples in place to OdsDemo_cmplx8ReIm mantissas, with one
+ *      exponent per block of 2^blockShift samples: the mantissas of a block
+ *      times 2^exponent give the input within rounding.
+ *
+ *  @param[in,out] buf        Samples in, numSamples mantissas out
+ *  @param[in]     numSamples Number of samples, multiple of the block length
+ *  @param[in]     blockShift log2 of the block length
+ *  @param[out]    blockExp   Block exponents, blockExp[b * expStride] for block b
+ *  @param[in]     expStride  Distance between the exponents of consecutive blocks
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_radarCubePack(cmplx16ReIm_t *buf,
+                           uint32_t numSamples,
+                           uint32_t blockShift,
+                           uint8_t *blockExp,
+                           uint32_t expStride);
+
+/**
+ *  @b Description
+ *  @n
+ *      Expands OdsDemo_cmplx8ReIm mantissas in place to 16-bit samples, the
+ *      block exponents being applied by @ref OdsDemo_radarCubeBfpLoad.
+ *
+ *  @param[in,out] buf        numSamples mantissas in, samples out
+ *  @param[in]     numSamples Number of samples
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_radarCubeUnpack(cmplx16ReIm_t *buf, uint32_t numSamples);
+
+/**
+ *  @b Description
+ *  @n
+ *      Rotates symbols of the second Tx antenna by half of the Doppler phase
+ *      shift of a Doppler bin.
+ *
+ *  @param[in]      dopplerIdx              Doppler index
+ *  @param[in]      numDopplerBins          Number of Doppler bins
+ *  @param[in]      azimuthModCoefs         exp(1j*2*pi*k/N) table
+ *  @param[in]      azimuthModCoefsHalfBin  exp(1j*2*pi* 0.5 /N)
+ *  @param[in,out]  azimuthIn               Symbols, must be 64 bit aligned
+ *  @param[in]      numAnt                  Number of symbols
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_addDopplerCompensation(int32_t dopplerIdx,
+                                    int32_t numDopplerBins,
+                                    uint32_t *azimuthModCoefs,
+                                    uint32_t *azimuthModCoefsHalfBin,
+                                    int64_t *azimuthIn,
+                                    uint32_t numAnt);
+
+/**
+ *  @b Description
+ *  @n
+ *      Doppler compensation of the Pong Doppler spectrum and BPM decoding of
+ *      the Ping/Pong pair over all Doppler bins, with the per bin
+ *      coefficients of bpmDopplerCompCoefs.
+ *
+ *  @param[in,out]  bpmA              Ping Doppler spectrum (S1+S2 in, S1 out)
+ *  @param[in,out]  bpmB              Pong Doppler spectrum (S1-S2 in, S2 out)
+ *  @param[in]      dopplerCompCoefs  Doppler compensation coefficients
+ *  @param[in]      numDopplerBins    Number of Doppler bins
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_bpmDecodeDopplerComp(cmplx32ReIm_t *bpmA,
+                                  cmplx32ReIm_t *bpmB,
+                                  uint32_t *dopplerCompCoefs,
+                                  uint32_t numDopplerBins);
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes log2|x| in Q8 (the mmwavelib_log2Abs32 format) of a Doppler
+ *      spectrum and initialises the accumulation over the virtual antennas.
+ *
+ *  @param[in]   inp     Doppler spectrum, must be 64 bit aligned
+ *  @param[out]  sumAbs  Accumulated log2 magnitude
+ *  @param[in]   len     Number of Doppler bins
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_log2Abs32Init(cmplx32ReIm_t *inp, uint16_t *sumAbs, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes log2|x| in Q8 of a Doppler spectrum and adds it to the
+ *      accumulation over the virtual antennas in the same pass.
+ *
+ *  @param[in]      inp     Doppler spectrum, must be 64 bit aligned
+ *  @param[in,out]  sumAbs  Accumulated log2 magnitude
+ *  @param[in]      len     Number of Doppler bins
+ *
+ *  @retval
+ *      NONE
+ */
+void OdsDemo_log2Abs32Accum(cmplx32ReIm_t *inp, uint16_t *sumAbs, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Radar cube sample index where the 1D output EDMA stores range bin 0 of
+ *      the first Rx antenna of a chirp.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  txAntIdx    Tx antenna of the chirp (0 if not TDM-MIMO)
+ *  @param[in]  dopplerIdx  Chirp index within the Tx antenna
+ *
+ *  @retval
+ *      Sample index
+ */
+uint32_t OdsDemo_radarCubeChirpIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t txAntIdx, uint32_t dopplerIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      Radar cube sample index of chirp 0 of the Doppler vector of a range
+ *      bin. Virtual antennas are numbered in the order the Doppler processing
+ *      fetches them, even ones with the ping and odd ones with the pong EDMA
+ *      channel. The following chirps are numRxAntennas * numRangeBins samples
+ *      apart in range-major and contiguous in Doppler-major layout.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  rangeIdx    Range bin
+ *  @param[in]  virtAntIdx  Virtual antenna in fetch order
+ *
+ *  @retval
+ *      Sample index
+ */
+uint32_t OdsDemo_radarCubeDopplerVecIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t rangeIdx, uint32_t virtAntIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      Maps a virtual antenna in fetch order to its index in azimuth order
+ *      (Tx antenna major), the order of the Rx channel compensation, the
+ *      static azimuth heat map used by the range bias measurement and the
+ *      block exponents.
+ *
+ *  @param[in]  obj         Pointer to data path object
+ *  @param[in]  virtAntIdx  Virtual antenna in fetch order
+ *
+ *  @retval
+ *      Virtual antenna in azimuth order
+ */
+uint32_t OdsDemo_radarCubeAzimAntIdx(OdsDemo_DSS_DataPathObj *obj, uint32_t virtAntIdx);
+
 #ifdef __cplusplus
 }
 #endif
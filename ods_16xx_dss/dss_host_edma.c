@@ -0,0 +1,599 @@
+/**
+ *   @file  dss_host_edma.c
+ *
+ *   @brief
+ *      Software EDMA engine used when building the data path off-target.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* The CCS project builds every source in this directory, so the whole
+ * translation unit compiles to nothing for the DSP. */
+#ifndef _TMS320C6X
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef ODS_HOST_EDMA_ASYNC
+#include <pthread.h>
+#endif
+
+#include <ti/drivers/edma/edma.h>
+#include "dss_host_edma.h"
+
+/*! @brief Link value of a PaRAM set that is not linked */
+#define ODS_HOST_EDMA_NO_LINK       0xFFFFU
+
+/*! @brief Depth of the pending trigger queue (manual plus chained triggers) */
+#define ODS_HOST_EDMA_QUEUE_LEN     64U
+
+/*! @brief Error code returned for an instance that does not exist */
+#define ODS_HOST_EDMA_E_INVALID_INSTANCE    (-1)
+
+#ifdef ODS_HOST_EDMA_ASYNC
+#define ODS_HOST_EDMA_LOCK(inst)    pthread_mutex_lock(&(inst)->lock)
+#define ODS_HOST_EDMA_UNLOCK(inst)  pthread_mutex_unlock(&(inst)->lock)
+#else
+#define ODS_HOST_EDMA_LOCK(inst)
+#define ODS_HOST_EDMA_UNLOCK(inst)
+#endif
+
+/*!
+ *  @brief    Emulated PaRAM set
+ */
+typedef struct OdsDemo_hostEdmaParam_t
+{
+    /*! @brief Live parameter set, counts and addresses are updated as the
+               transfer progresses like in the hardware PaRAM */
+    EDMA_paramSetConfig_t   cfg;
+
+    /*! @brief PaRAM set reloaded into this one on final completion */
+    uint16_t                link;
+
+    /*! @brief Completion callback, NULL for polled completion */
+    EDMA_transferCompletionCallbackFxn_t callbackFxn;
+
+    /*! @brief Completion callback argument */
+    uintptr_t               callbackArg;
+} OdsDemo_hostEdmaParam;
+
+/*!
+ *  @brief    Emulated EDMA instance (one transfer controller per instance)
+ */
+typedef struct OdsDemo_hostEdmaInst_t
+{
+    /*! @brief PaRAM memory */
+    OdsDemo_hostEdmaParam   param[ODS_HOST_EDMA_NUM_PARAMS];
+
+    /*! @brief Channel to PaRAM set mapping */
+    uint16_t                channelParam[ODS_HOST_EDMA_NUM_CHANNELS];
+
+    /*! @brief Channel enabled flags */
+    bool                    channelEnabled[ODS_HOST_EDMA_NUM_CHANNELS];
+
+    /*! @brief Interrupt pending register, one bit per transfer completion code */
+    volatile uint64_t       ipr;
+
+    /*! @brief Pending triggers */
+    uint8_t                 queue[ODS_HOST_EDMA_QUEUE_LEN];
+    uint32_t                queueRd;
+    uint32_t                queueWr;
+
+    /*! @brief Transfer statistics */
+    OdsDemo_hostEdmaStats   stats;
+
+    /*! @brief Instance is open */
+    bool                    isOpen;
+
+#ifdef ODS_HOST_EDMA_ASYNC
+    pthread_t               worker;
+    pthread_mutex_t         lock;
+    pthread_cond_t          work;
+    pthread_cond_t          idle;
+    bool                    busy;
+#endif
+} OdsDemo_hostEdmaInst;
+
+static OdsDemo_hostEdmaInst gOdsHostEdma[ODS_HOST_EDMA_NUM_INSTANCES];
+
+static void OdsDemo_hostEdmaQueue(OdsDemo_hostEdmaInst *inst, uint8_t channelId)
+{
+    ODS_HOST_EDMA_LOCK(inst);
+    inst->queue[inst->queueWr % ODS_HOST_EDMA_QUEUE_LEN] = channelId;
+    inst->queueWr++;
+#ifdef ODS_HOST_EDMA_ASYNC
+    pthread_cond_signal(&inst->work);
+#endif
+    ODS_HOST_EDMA_UNLOCK(inst);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Signals completion of transfer completion code tcc: calls the
+ *      registered callback (interrupt mode) or sets the IPR bit (polled mode).
+ */
+static void OdsDemo_hostEdmaComplete(OdsDemo_hostEdmaInst *inst, OdsDemo_hostEdmaParam *p)
+{
+    uint8_t tcc = p->cfg.transferCompletionCode;
+
+    if (p->callbackFxn != NULL)
+    {
+        p->callbackFxn(p->callbackArg, tcc);
+    }
+    else
+    {
+        ODS_HOST_EDMA_LOCK(inst);
+        inst->ipr |= ((uint64_t) 1U << (tcc & 63U));
+        ODS_HOST_EDMA_UNLOCK(inst);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Executes one synchronization event on a channel: one A-array for
+ *      A-synchronized and one frame of bCount A-arrays for AB-synchronized
+ *      transfers. Address and count updates, linking and chaining follow the
+ *      EDMA3 PaRAM semantics.
+ */
+static void OdsDemo_hostEdmaExecute(OdsDemo_hostEdmaInst *inst, uint8_t channelId)
+{
+    OdsDemo_hostEdmaParam *p = &inst->param[inst->channelParam[channelId]];
+    EDMA_paramSetConfig_t *cfg = &p->cfg;
+    uint32_t    numArrays, arrayIdx;
+    uint32_t    src, dst;
+    bool        isFinal;
+
+    if ((cfg->aCount == 0U) || (cfg->bCount == 0U) || (cfg->cCount == 0U))
+    {
+        /* Null transfer: completes immediately */
+        OdsDemo_hostEdmaComplete(inst, p);
+        return;
+    }
+
+    inst->stats.numTriggers[channelId]++;
+    src = cfg->sourceAddress;
+    dst = cfg->destinationAddress;
+
+    if (cfg->transferType == (uint8_t) EDMA3_SYNC_A)
+    {
+        memmove((void *)(uintptr_t) dst, (const void *)(uintptr_t) src, cfg->aCount);
+        numArrays = 1U;
+
+        cfg->bCount--;
+        if (cfg->bCount == 0U)
+        {
+            /* End of frame: next array is CIDX away from the last one */
+            cfg->cCount--;
+            cfg->bCount = cfg->bCountReload;
+            cfg->sourceAddress      = src + (int32_t) cfg->sourceCindex;
+            cfg->destinationAddress = dst + (int32_t) cfg->destinationCindex;
+        }
+        else
+        {
+            cfg->sourceAddress      = src + (int32_t) cfg->sourceBindex;
+            cfg->destinationAddress = dst + (int32_t) cfg->destinationBindex;
+        }
+        isFinal = (cfg->cCount == 0U);
+    }
+    else
+    {
+        numArrays = cfg->bCount;
+        for (arrayIdx = 0; arrayIdx < numArrays; arrayIdx++)
+        {
+            memmove((void *)(uintptr_t) (dst + arrayIdx * (int32_t) cfg->destinationBindex),
+                    (const void *)(uintptr_t) (src + arrayIdx * (int32_t) cfg->sourceBindex),
+                    cfg->aCount);
+        }
+        cfg->cCount--;
+        cfg->sourceAddress      = src + (int32_t) cfg->sourceCindex;
+        cfg->destinationAddress = dst + (int32_t) cfg->destinationCindex;
+        isFinal = (cfg->cCount == 0U);
+    }
+
+    inst->stats.numArrays[channelId] += numArrays;
+    inst->stats.bytesMoved[channelId] += (uint64_t) numArrays * cfg->aCount;
+
+    if (isFinal)
+    {
+        EDMA_transferCompletionCallbackFxn_t callbackFxn = p->callbackFxn;
+        uintptr_t   callbackArg = p->callbackArg;
+        bool        interruptEnabled = cfg->isFinalTransferInterruptEnabled;
+        bool        chainEnabled = cfg->isFinalChainingEnabled;
+        uint8_t     tcc = cfg->transferCompletionCode;
+
+        /* Reload from the linked set; the link field of the linked set is
+           copied as well, which is how a self-linked shadow keeps rearming */
+        if (p->link != ODS_HOST_EDMA_NO_LINK)
+        {
+            OdsDemo_hostEdmaParam *linked = &inst->param[p->link];
+            p->cfg  = linked->cfg;
+            p->link = linked->link;
+        }
+        if (interruptEnabled)
+        {
+            OdsDemo_hostEdmaParam done;
+            done.cfg.transferCompletionCode = tcc;
+            done.callbackFxn = callbackFxn;
+            done.callbackArg = callbackArg;
+            OdsDemo_hostEdmaComplete(inst, &done);
+        }
+        if (chainEnabled)
+        {
+            OdsDemo_hostEdmaQueue(inst, tcc);
+        }
+    }
+    else
+    {
+        if (cfg->isIntermediateTransferInterruptEnabled)
+        {
+            OdsDemo_hostEdmaComplete(inst, p);
+        }
+        if (cfg->isIntermediateChainingEnabled)
+        {
+            OdsDemo_hostEdmaQueue(inst, cfg->transferCompletionCode);
+        }
+    }
+}
+
+#ifndef ODS_HOST_EDMA_ASYNC
+/**
+ *  @b Description
+ *  @n
+ *      Drains the trigger queue, including triggers added by chaining.
+ */
+static void OdsDemo_hostEdmaRun(OdsDemo_hostEdmaInst *inst)
+{
+    uint8_t channelId;
+
+    while (inst->queueRd != inst->queueWr)
+    {
+        channelId = inst->queue[inst->queueRd % ODS_HOST_EDMA_QUEUE_LEN];
+        inst->queueRd++;
+        if (inst->channelEnabled[channelId])
+        {
+            OdsDemo_hostEdmaExecute(inst, channelId);
+        }
+    }
+}
+#endif
+
+#ifdef ODS_HOST_EDMA_ASYNC
+/**
+ *  @b Description
+ *  @n
+ *      Background transfer controller. Transfers execute without holding
+ *      the instance lock so that the data path keeps running meanwhile.
+ */
+static void *OdsDemo_hostEdmaWorker(void *arg)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) arg;
+    uint8_t channelId;
+
+    pthread_mutex_lock(&inst->lock);
+    while (1)
+    {
+        while (inst->queueRd == inst->queueWr)
+        {
+            inst->busy = false;
+            pthread_cond_broadcast(&inst->idle);
+            pthread_cond_wait(&inst->work, &inst->lock);
+        }
+        inst->busy = true;
+        channelId = inst->queue[inst->queueRd % ODS_HOST_EDMA_QUEUE_LEN];
+        inst->queueRd++;
+        if (inst->channelEnabled[channelId])
+        {
+            pthread_mutex_unlock(&inst->lock);
+            OdsDemo_hostEdmaExecute(inst, channelId);
+            pthread_mutex_lock(&inst->lock);
+        }
+    }
+    return NULL;
+}
+#endif
+
+/**************************************************************************
+ ********************** EDMA driver API emulation *************************
+ **************************************************************************/
+
+uint8_t EDMA_getNumInstances(void)
+{
+    return (uint8_t) ODS_HOST_EDMA_NUM_INSTANCES;
+}
+
+int32_t EDMA_init(uint8_t instanceId)
+{
+    uint32_t i;
+    OdsDemo_hostEdmaInst *inst;
+
+    if (instanceId >= ODS_HOST_EDMA_NUM_INSTANCES)
+    {
+        return ODS_HOST_EDMA_E_INVALID_INSTANCE;
+    }
+    inst = &gOdsHostEdma[instanceId];
+    if (inst->isOpen)
+    {
+        return EDMA_NO_ERROR;
+    }
+    memset((void *) inst, 0, sizeof(OdsDemo_hostEdmaInst));
+    for (i = 0; i < ODS_HOST_EDMA_NUM_PARAMS; i++)
+    {
+        inst->param[i].link = ODS_HOST_EDMA_NO_LINK;
+    }
+    for (i = 0; i < ODS_HOST_EDMA_NUM_CHANNELS; i++)
+    {
+        inst->channelParam[i] = (uint16_t) i;
+    }
+    return EDMA_NO_ERROR;
+}
+
+EDMA_Handle EDMA_open(uint8_t instanceId, int32_t *errorCode, EDMA_instanceInfo_t *instanceInfo)
+{
+    OdsDemo_hostEdmaInst *inst;
+
+    if (instanceId >= ODS_HOST_EDMA_NUM_INSTANCES)
+    {
+        *errorCode = ODS_HOST_EDMA_E_INVALID_INSTANCE;
+        return NULL;
+    }
+    inst = &gOdsHostEdma[instanceId];
+    if (instanceInfo != NULL)
+    {
+        memset((void *) instanceInfo, 0, sizeof(EDMA_instanceInfo_t));
+    }
+#ifdef ODS_HOST_EDMA_ASYNC
+    if (!inst->isOpen)
+    {
+        pthread_mutex_init(&inst->lock, NULL);
+        pthread_cond_init(&inst->work, NULL);
+        pthread_cond_init(&inst->idle, NULL);
+        pthread_create(&inst->worker, NULL, OdsDemo_hostEdmaWorker, (void *) inst);
+    }
+#endif
+    inst->isOpen = true;
+    *errorCode = EDMA_NO_ERROR;
+    return (EDMA_Handle) inst;
+}
+
+int32_t EDMA_configErrorMonitoring(EDMA_Handle handle, EDMA_errorConfig_t const *config)
+{
+    (void) handle;
+    (void) config;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_configChannel(EDMA_Handle handle, EDMA_channelConfig_t const *config,
+                           bool isEnableChannel)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+    OdsDemo_hostEdmaParam *p;
+
+    if ((config->channelId >= ODS_HOST_EDMA_NUM_CHANNELS) ||
+        (config->paramId >= ODS_HOST_EDMA_NUM_PARAMS))
+    {
+        return EDMA_E_INVALID__DMA_CHAN_ID;
+    }
+    p = &inst->param[config->paramId];
+    p->cfg = config->paramSetConfig;
+    p->link = ODS_HOST_EDMA_NO_LINK;
+    p->callbackFxn = config->transferCompletionCallbackFxn;
+    p->callbackArg = config->transferCompletionCallbackFxnArg;
+    inst->channelParam[config->channelId] = config->paramId;
+
+    /* Event triggered channels are started by the (emulated) event source,
+       manually triggered ones by EDMA_startTransfer; both need the channel
+       to be enabled in this model */
+    (void) isEnableChannel;
+    inst->channelEnabled[config->channelId] = true;
+    inst->ipr &= ~((uint64_t) 1U << (config->paramSetConfig.transferCompletionCode & 63U));
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_configParamSet(EDMA_Handle handle, uint16_t paramId, EDMA_paramConfig_t const *config)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+    OdsDemo_hostEdmaParam *p;
+
+    if (paramId >= ODS_HOST_EDMA_NUM_PARAMS)
+    {
+        return EDMA_E_INVALID__PARAM_ID;
+    }
+    p = &inst->param[paramId];
+    p->cfg = config->paramSetConfig;
+    p->link = ODS_HOST_EDMA_NO_LINK;
+    p->callbackFxn = config->transferCompletionCallbackFxn;
+    p->callbackArg = config->transferCompletionCallbackFxnArg;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_linkParamSets(EDMA_Handle handle, uint16_t fromParamId, uint16_t toParamId)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    if ((fromParamId >= ODS_HOST_EDMA_NUM_PARAMS) || (toParamId >= ODS_HOST_EDMA_NUM_PARAMS))
+    {
+        return EDMA_E_INVALID__PARAM_ID;
+    }
+    inst->param[fromParamId].link = toParamId;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_chainChannels(EDMA_Handle handle, uint16_t fromParamId, uint8_t toChannelId)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    if (fromParamId >= ODS_HOST_EDMA_NUM_PARAMS)
+    {
+        return EDMA_E_INVALID__PARAM_ID;
+    }
+    inst->param[fromParamId].cfg.transferCompletionCode = toChannelId;
+    inst->param[fromParamId].cfg.isFinalChainingEnabled = true;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_setSourceAddress(EDMA_Handle handle, uint16_t paramId, uint32_t sourceAddress)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    if (paramId >= ODS_HOST_EDMA_NUM_PARAMS)
+    {
+        return EDMA_E_INVALID__PARAM_ID;
+    }
+#ifdef ODS_HOST_EDMA_ASYNC
+    OdsDemo_hostEdmaFlush((uint8_t) (inst - &gOdsHostEdma[0]));
+#endif
+    inst->param[paramId].cfg.sourceAddress = sourceAddress;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_setDestinationAddress(EDMA_Handle handle, uint16_t paramId, uint32_t destinationAddress)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    if (paramId >= ODS_HOST_EDMA_NUM_PARAMS)
+    {
+        return EDMA_E_INVALID__PARAM_ID;
+    }
+#ifdef ODS_HOST_EDMA_ASYNC
+    OdsDemo_hostEdmaFlush((uint8_t) (inst - &gOdsHostEdma[0]));
+#endif
+    inst->param[paramId].cfg.destinationAddress = destinationAddress;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_startTransfer(EDMA_Handle handle, uint8_t channelId, uint8_t channelType)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    (void) channelType;
+    if (channelId >= ODS_HOST_EDMA_NUM_CHANNELS)
+    {
+        return EDMA_E_INVALID__DMA_CHAN_ID;
+    }
+    OdsDemo_hostEdmaQueue(inst, channelId);
+#ifndef ODS_HOST_EDMA_ASYNC
+    OdsDemo_hostEdmaRun(inst);
+#endif
+    return EDMA_NO_ERROR;
+}
+
+#ifndef EDMA_startDmaTransfer
+int32_t EDMA_startDmaTransfer(EDMA_Handle handle, uint8_t channelId)
+{
+    return EDMA_startTransfer(handle, channelId, (uint8_t) EDMA3_CHANNEL_TYPE_DMA);
+}
+#endif
+
+int32_t EDMA_disableChannel(EDMA_Handle handle, uint8_t channelId, uint8_t channelType)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+
+    (void) channelType;
+    if (channelId >= ODS_HOST_EDMA_NUM_CHANNELS)
+    {
+        return EDMA_E_INVALID__DMA_CHAN_ID;
+    }
+    inst->channelEnabled[channelId] = false;
+    return EDMA_NO_ERROR;
+}
+
+int32_t EDMA_isTransferComplete(EDMA_Handle handle, uint8_t transferCompletionCode,
+                                bool *isTransferComplete)
+{
+    OdsDemo_hostEdmaInst *inst = (OdsDemo_hostEdmaInst *) handle;
+    uint64_t mask = (uint64_t) 1U << (transferCompletionCode & 63U);
+
+    ODS_HOST_EDMA_LOCK(inst);
+    *isTransferComplete = ((inst->ipr & mask) != 0U);
+    if (*isTransferComplete)
+    {
+        /* Same as the driver: reading a completion clears it */
+        inst->ipr &= ~mask;
+    }
+    ODS_HOST_EDMA_UNLOCK(inst);
+    return EDMA_NO_ERROR;
+}
+
+/**************************************************************************
+ ************************* Host only extensions ***************************
+ **************************************************************************/
+
+int32_t OdsDemo_hostEdmaGetStats(uint8_t instanceId, OdsDemo_hostEdmaStats *stats)
+{
+    if (instanceId >= ODS_HOST_EDMA_NUM_INSTANCES)
+    {
+        return ODS_HOST_EDMA_E_INVALID_INSTANCE;
+    }
+    OdsDemo_hostEdmaFlush(instanceId);
+    *stats = gOdsHostEdma[instanceId].stats;
+    return EDMA_NO_ERROR;
+}
+
+void OdsDemo_hostEdmaResetStats(uint8_t instanceId)
+{
+    if (instanceId < ODS_HOST_EDMA_NUM_INSTANCES)
+    {
+        OdsDemo_hostEdmaFlush(instanceId);
+        memset((void *) &gOdsHostEdma[instanceId].stats, 0, sizeof(OdsDemo_hostEdmaStats));
+    }
+}
+
+void OdsDemo_hostEdmaFlush(uint8_t instanceId)
+{
+#ifdef ODS_HOST_EDMA_ASYNC
+    OdsDemo_hostEdmaInst *inst = &gOdsHostEdma[instanceId];
+
+    if (!inst->isOpen)
+    {
+        return;
+    }
+    pthread_mutex_lock(&inst->lock);
+    while (inst->busy || (inst->queueRd != inst->queueWr))
+    {
+        pthread_cond_wait(&inst->idle, &inst->lock);
+    }
+    pthread_mutex_unlock(&inst->lock);
+#else
+    (void) instanceId;
+#endif
+}
+
+#endif /* _TMS320C6X */
@@ -0,0 +1,127 @@
+/**
+ *   @file  dss_host_edma.h
+ *
+ *   @brief
+ *      Software EDMA engine used when building the data path off-target.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_HOST_EDMA_H
+#define DSS_HOST_EDMA_H
+
+#ifndef _TMS320C6X
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <ti/drivers/edma/edma.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* If the following define is uncommented, the software EDMA executes the
+   transfers on a background thread so that the overlap between EDMA and
+   processing is modelled; EDMA_isTransferComplete then reports completion
+   only once the worker has finished. Otherwise transfers execute
+   synchronously inside EDMA_startTransfer. */
+//#define ODS_HOST_EDMA_ASYNC
+
+/*! @brief Number of EDMA instances emulated */
+#define ODS_HOST_EDMA_NUM_INSTANCES     2U
+
+/*! @brief Number of channels per emulated instance */
+#define ODS_HOST_EDMA_NUM_CHANNELS      64U
+
+/*! @brief Number of PaRAM sets per emulated instance */
+#define ODS_HOST_EDMA_NUM_PARAMS        256U
+
+/*!
+ *  @brief    Per channel transfer statistics of the software EDMA
+ */
+typedef struct OdsDemo_hostEdmaStats_t
+{
+    /*! @brief Number of triggers (manual, event or chained) per channel */
+    uint32_t numTriggers[ODS_HOST_EDMA_NUM_CHANNELS];
+
+    /*! @brief Number of A-arrays transferred per channel */
+    uint32_t numArrays[ODS_HOST_EDMA_NUM_CHANNELS];
+
+    /*! @brief Number of bytes moved per channel */
+    uint64_t bytesMoved[ODS_HOST_EDMA_NUM_CHANNELS];
+} OdsDemo_hostEdmaStats;
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the transfer statistics of an emulated EDMA instance.
+ *
+ *  @param[in]  instanceId  EDMA instance
+ *  @param[out] stats       Copy of the statistics
+ *
+ *  @retval
+ *      EDMA_NO_ERROR on success, <0 if the instance does not exist.
+ */
+int32_t OdsDemo_hostEdmaGetStats(uint8_t instanceId, OdsDemo_hostEdmaStats *stats);
+
+/**
+ *  @b Description
+ *  @n
+ *      Clears the transfer statistics of an emulated EDMA instance.
+ *
+ *  @param[in]  instanceId  EDMA instance
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_hostEdmaResetStats(uint8_t instanceId);
+
+/**
+ *  @b Description
+ *  @n
+ *      Blocks until all queued transfers of the instance have executed.
+ *      Returns immediately in the synchronous configuration.
+ *
+ *  @param[in]  instanceId  EDMA instance
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_hostEdmaFlush(uint8_t instanceId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TMS320C6X */
+
+#endif /* DSS_HOST_EDMA_H */
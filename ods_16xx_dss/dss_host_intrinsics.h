@@ -0,0 +1,344 @@
+/**
+ *   @file  dss_host_intrinsics.h
+ *
+ *   @brief
+ *      C674x intrinsic and mathlib emulation used when building the data path off-target.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_HOST_INTRINSICS_H
+#define DSS_HOST_INTRINSICS_H
+
+/* This header is only meaningful for non-TI compilers. On the C674x the
+ * intrinsics below are compiler built-ins and mathlib provides the *sp
+ * functions, so nothing is defined here. */
+#ifndef _TMS320C6X
+
+#include <stdint.h>
+#include <math.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The data path does 32-bit address arithmetic (e.g. (uint32_t) pointer casts
+ * for SOC_translateAddress and the EDMA utilities), so the host build must
+ * target a 32-bit ABI, see host/makefile. */
+#if (UINTPTR_MAX != 0xFFFFFFFFU)
+#error "The ODS data path needs 32-bit pointers, build it with gcc -m32"
+#endif
+
+/* TI pragmas (DATA_SECTION, DATA_ALIGN, diag_*) are ignored by the host
+ * compiler; silence the resulting warnings. */
+#if defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+/** @defgroup HOST_INTRINSICS C674x intrinsic emulation
+ *
+ * @brief
+ *  Portable C versions of the C674x intrinsics used in the ODS data path.
+ *  The semantics follow the TMS320C6000 Optimizing Compiler User's Guide,
+ *  assuming the little endian memory model used on the xWR16xx DSS.
+ @{ */
+
+/*! @brief Aligned 8 byte load/store (lvalue) */
+#define _amem8(ptr)         (*(int64_t *)(ptr))
+/*! @brief Aligned 8 byte load from const memory */
+#define _amem8_const(ptr)   (*(const int64_t *)(ptr))
+/*! @brief Aligned 4 byte load/store (lvalue) */
+#define _amem4(ptr)         (*(uint32_t *)(ptr))
+/*! @brief Aligned 4 byte load from const memory */
+#define _amem4_const(ptr)   (*(const uint32_t *)(ptr))
+/*! @brief Non aligned 8 byte load/store (lvalue) */
+#define _mem8(ptr)          (*(int64_t *)(ptr))
+/*! @brief Non aligned 4 byte load/store (lvalue) */
+#define _mem4(ptr)          (*(uint32_t *)(ptr))
+
+static inline int32_t _host_sat32(int64_t x)
+{
+    if (x > (int64_t) INT32_MAX)
+    {
+        return INT32_MAX;
+    }
+    if (x < (int64_t) INT32_MIN)
+    {
+        return INT32_MIN;
+    }
+    return (int32_t) x;
+}
+
+static inline int16_t _host_sat16(int32_t x)
+{
+    if (x > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (x < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t) x;
+}
+
+/*! @brief Upper 32 bits of a 64-bit value */
+static inline uint32_t _hill(int64_t src)
+{
+    return (uint32_t) ((uint64_t) src >> 32);
+}
+
+/*! @brief Lower 32 bits of a 64-bit value */
+static inline uint32_t _loll(int64_t src)
+{
+    return (uint32_t) src;
+}
+
+/*! @brief Builds a 64-bit value from two 32-bit halves */
+static inline int64_t _itoll(uint32_t hi, uint32_t lo)
+{
+    return (int64_t) (((uint64_t) hi << 32) | (uint64_t) lo);
+}
+
+/*! @brief Packs the lower half-words of src1 (upper) and src2 (lower) */
+static inline uint32_t _pack2(uint32_t src1, uint32_t src2)
+{
+    return (src1 << 16) | (src2 & 0xFFFFU);
+}
+
+/*! @brief Packs the upper half-words of src1 (upper) and src2 (lower) */
+static inline uint32_t _packh2(uint32_t src1, uint32_t src2)
+{
+    return (src1 & 0xFFFF0000U) | (src2 >> 16);
+}
+
+/*! @brief Saturating 32-bit addition */
+static inline int32_t _sadd(int32_t src1, int32_t src2)
+{
+    return _host_sat32((int64_t) src1 + (int64_t) src2);
+}
+
+/*! @brief Saturating 32-bit subtraction */
+static inline int32_t _ssub(int32_t src1, int32_t src2)
+{
+    return _host_sat32((int64_t) src1 - (int64_t) src2);
+}
+
+/*! @brief Signed bit field extract: (src << csta) >> cstb */
+static inline int32_t _ext(int32_t src, uint32_t csta, uint32_t cstb)
+{
+    return ((int32_t) ((uint32_t) src << csta)) >> cstb;
+}
+
+/*! @brief Unsigned bit field extract: (src << csta) >> cstb */
+static inline uint32_t _extu(uint32_t src, uint32_t csta, uint32_t cstb)
+{
+    return (src << csta) >> cstb;
+}
+
+/*! @brief Number of redundant sign bits */
+static inline uint32_t _norm(int32_t src)
+{
+    uint32_t x = (uint32_t) (src ^ (src >> 31));
+
+    if (x == 0U)
+    {
+        return 31U;
+    }
+    return (uint32_t) __builtin_clz(x) - 1U;
+}
+
+/*! @brief Leftmost bit detection: number of leading bits not equal to bit */
+static inline uint32_t _lmbd(uint32_t bit, uint32_t src)
+{
+    uint32_t x = (bit & 1U) ? src : ~src;
+
+    if (x == 0U)
+    {
+        return 32U;
+    }
+    return (uint32_t) __builtin_clz(x);
+}
+
+/*! @brief Bit reversal */
+static inline uint32_t _bitr(uint32_t src)
+{
+    src = ((src >> 1) & 0x55555555U) | ((src & 0x55555555U) << 1);
+    src = ((src >> 2) & 0x33333333U) | ((src & 0x33333333U) << 2);
+    src = ((src >> 4) & 0x0F0F0F0FU) | ((src & 0x0F0F0F0FU) << 4);
+    src = ((src >> 8) & 0x00FF00FFU) | ((src & 0x00FF00FFU) << 8);
+    return (src >> 16) | (src << 16);
+}
+
+/*! @brief Bits of a single precision float */
+static inline uint32_t _ftoi(float src)
+{
+    union
+    {
+        float    f;
+        uint32_t u;
+    } bits;
+
+    bits.f = src;
+    return bits.u;
+}
+
+/*! @brief Single precision float with the given bits */
+static inline float _itof(uint32_t src)
+{
+    union
+    {
+        float    f;
+        uint32_t u;
+    } bits;
+
+    bits.u = src;
+    return bits.f;
+}
+
+/*! @brief Packs two 32-bit values, saturated to 16 bits, into the upper
+ *         (src1) and lower (src2) half-words */
+static inline uint32_t _spack2(int32_t src1, int32_t src2)
+{
+    return _pack2((uint32_t) _host_sat16(src1), (uint32_t) _host_sat16(src2));
+}
+
+/*! @brief Number of set bits */
+static inline uint32_t _host_popcount(uint32_t src)
+{
+    return (uint32_t) __builtin_popcount(src);
+}
+
+/*! @brief Number of set bits of each byte */
+static inline uint32_t _bitc4(uint32_t src)
+{
+    src = src - ((src >> 1) & 0x55555555U);
+    src = (src & 0x33333333U) + ((src >> 2) & 0x33333333U);
+    return (src + (src >> 4)) & 0x0F0F0F0FU;
+}
+
+/*! @brief Dot product of the unsigned bytes of src1 and src2 */
+static inline uint32_t _dotpu4(uint32_t src1, uint32_t src2)
+{
+    return (src1 & 0xFFU) * (src2 & 0xFFU) +
+           ((src1 >> 8) & 0xFFU) * ((src2 >> 8) & 0xFFU) +
+           ((src1 >> 16) & 0xFFU) * ((src2 >> 16) & 0xFFU) +
+           (src1 >> 24) * (src2 >> 24);
+}
+
+/*! @brief (upper 16 bits of src1) x src2, rounded and shifted right by 15 */
+static inline int32_t _mpyhir(int32_t src1, int32_t src2)
+{
+    return (int32_t) (((int64_t) (src1 >> 16) * src2 + 0x4000) >> 15);
+}
+
+/*! @brief (lower 16 bits of src1) x src2, rounded and shifted right by 15 */
+static inline int32_t _mpylir(int32_t src1, int32_t src2)
+{
+    return (int32_t) (((int64_t) (int16_t) src1 * src2 + 0x4000) >> 15);
+}
+
+/*! @brief Saturating variable shift right (negative shift shifts left) */
+static inline int32_t _sshvr(int32_t src, int32_t shift)
+{
+    if (shift > 31)
+    {
+        shift = 31;
+    }
+    if (shift < -31)
+    {
+        shift = -31;
+    }
+    if (shift >= 0)
+    {
+        return src >> shift;
+    }
+    return _host_sat32((int64_t) src << (-shift));
+}
+
+/*! @brief Saturating variable shift left (negative shift shifts right) */
+static inline int32_t _sshvl(int32_t src, int32_t shift)
+{
+    return _sshvr(src, -shift);
+}
+
+/**
+ * @brief Complex multiply of packed 16-bit values (real in the upper,
+ *        imaginary in the lower half-word) with rounding and saturation
+ */
+static inline uint32_t _cmpyr1(uint32_t src1, uint32_t src2)
+{
+    int32_t ar = (int16_t) (src1 >> 16);
+    int32_t ai = (int16_t) src1;
+    int32_t br = (int16_t) (src2 >> 16);
+    int32_t bi = (int16_t) src2;
+    int64_t re = (int64_t) ar * br - (int64_t) ai * bi;
+    int64_t im = (int64_t) ar * bi + (int64_t) ai * br;
+
+    re = (re + 0x4000) >> 15;
+    im = (im + 0x4000) >> 15;
+    return _pack2((uint32_t) _host_sat16(_host_sat32(re)),
+                  (uint32_t) _host_sat16(_host_sat32(im)));
+}
+
+/** @}*/ /* end defgroup HOST_INTRINSICS */
+
+/** @defgroup HOST_MATHLIB C674x mathlib mapping
+ *
+ * @brief
+ *  Single precision mathlib entry points mapped to the host C library.
+ @{ */
+#define sqrtsp(x)       sqrtf(x)
+#define cossp(x)        cosf(x)
+#define sinsp(x)        sinf(x)
+#define atan2sp(y, x)   atan2f((y), (x))
+#define divsp(a, b)     ((float) (a) / (float) (b))
+#define log10sp(x)      log10f(x)
+#define expsp(x)        expf(x)
+/** @}*/ /* end defgroup HOST_MATHLIB */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TMS320C6X */
+
+#endif /* DSS_HOST_INTRINSICS_H */
@@ -0,0 +1,595 @@
+/**
+ *   @file  dss_host_kernels.c
+ *
+ *   @brief
+ *      Portable stand-ins for the dsplib and mmwavelib kernels used by the data path.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* The CCS project builds every source in this directory, so the whole
+ * translation unit compiles to nothing for the DSP. */
+#ifndef _TMS320C6X
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <math.h>
+
+#include "dss_host_kernels.h"
+
+/**
+ *  @b Description
+ *  @n
+ *      Output position of the last stage group grp: its numDigits radix-4
+ *      digits in reverse order.
+ */
+static inline int32_t OdsDemo_hostFftDigitRev(int32_t grp, int32_t numDigits)
+{
+    int32_t rev = 0;
+    int32_t d;
+
+    for (d = 0; d < numDigits; d++)
+    {
+        rev = (rev << 2) | (grp & 3);
+        grp >>= 2;
+    }
+    return rev;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      16-bit sum and difference with the wrap of the packed _add2/_sub2.
+ */
+static inline int32_t OdsDemo_hostAdd16(int32_t a, int32_t b)
+{
+    return (int16_t) (a + b);
+}
+
+static inline int32_t OdsDemo_hostSub16(int32_t a, int32_t b)
+{
+    return (int16_t) (a - b);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      32-bit sum and difference with the wrap of the DSP adder.
+ */
+static inline int32_t OdsDemo_hostAdd32(int32_t a, int32_t b)
+{
+    return (int32_t) ((uint32_t) a + (uint32_t) b);
+}
+
+static inline int32_t OdsDemo_hostSub32(int32_t a, int32_t b)
+{
+    return (int32_t) ((uint32_t) a - (uint32_t) b);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      (xt + j*yt) * (co - j*si) with the Q15 twiddle of the 16x16 table,
+ *      each part rounded, saturated to 32 bits and shifted down by 16 as
+ *      the complex multiply of the C674x does. This also scales by 2.
+ */
+static inline void OdsDemo_hostTwMul16(int32_t si, int32_t co, int32_t xt, int32_t yt,
+                                       int16_t *re, int16_t *im)
+{
+    *re = (int16_t) (_host_sat32((int64_t) si * yt + (int64_t) co * xt + 0x8000) >> 16);
+    *im = (int16_t) (_host_sat32((int64_t) co * yt - (int64_t) si * xt + 0x8000) >> 16);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      (xt + j*yt) * (co - j*si) with the Q31 twiddle of the 32x32 table,
+ *      rounded; the result wraps to 32 bits.
+ */
+static inline void OdsDemo_hostTwMul32(int32_t si, int32_t co, int32_t xt, int32_t yt,
+                                       int32_t *re, int32_t *im)
+{
+    *re = (int32_t) (uint32_t) (((int64_t) si * yt + (int64_t) co * xt + 0x40000000) >> 31);
+    *im = (int32_t) (uint32_t) (((int64_t) co * yt - (int64_t) si * xt + 0x40000000) >> 31);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the dsplib 16x16 FFT. See @ref DSP_fft16x16 in
+ *      dss_host_kernels.h.
+ */
+void DSP_fft16x16(const int16_t *ptr_w, int32_t npoints, int16_t *ptr_x, int16_t *ptr_y)
+{
+    const int16_t *w = ptr_w;
+    const int16_t *tw;
+    int16_t *x = ptr_x;
+    int32_t  radix, grpLen, quarter, grp, bfly, numDigits, k;
+    int32_t  i0, i1, i2, i3;
+    int32_t  xh0, xh1, xl0, xl1, xh20, xh21, xl20, xl21;
+    int32_t  xt0, yt0, xt1, yt1, xt2, yt2;
+
+    /* the last stage is a radix-2 one for odd powers of 2 */
+    radix = ((30 - (int32_t) _norm(npoints)) & 1) ? 2 : 4;
+
+    /* radix-4 decimation in frequency stages in place, each scaled by 2 */
+    for (grpLen = npoints; grpLen > radix; grpLen >>= 2)
+    {
+        quarter = grpLen >> 2;
+        for (grp = 0; grp < npoints; grp += grpLen)
+        {
+            for (bfly = 0; bfly < quarter; bfly++)
+            {
+                /* twiddles of two butterflies are interleaved, W2 is stored negated */
+                tw = &w[12 * (bfly >> 1) + 2 * (bfly & 1)];
+                i0 = 2 * (grp + bfly);
+                i1 = i0 + 2 * quarter;
+                i2 = i1 + 2 * quarter;
+                i3 = i2 + 2 * quarter;
+
+                xh0  = OdsDemo_hostAdd16(x[i0],     x[i2]);
+                xh1  = OdsDemo_hostAdd16(x[i0 + 1], x[i2 + 1]);
+                xl0  = OdsDemo_hostSub16(x[i0],     x[i2]);
+                xl1  = OdsDemo_hostSub16(x[i0 + 1], x[i2 + 1]);
+                xh20 = OdsDemo_hostAdd16(x[i1],     x[i3]);
+                xh21 = OdsDemo_hostAdd16(x[i1 + 1], x[i3 + 1]);
+                xl20 = OdsDemo_hostSub16(x[i1],     x[i3]);
+                xl21 = OdsDemo_hostSub16(x[i1 + 1], x[i3 + 1]);
+
+                x[i0]     = (int16_t) ((xh0 + xh20 + 1) >> 1);
+                x[i0 + 1] = (int16_t) ((xh1 + xh21 + 1) >> 1);
+
+                xt0 = OdsDemo_hostSub16(xh20, xh0);
+                yt0 = OdsDemo_hostSub16(xh21, xh1);
+                xt1 = OdsDemo_hostAdd16(xl0, xl21);
+                yt1 = OdsDemo_hostSub16(xl1, xl20);
+                xt2 = OdsDemo_hostSub16(xl0, xl21);
+                yt2 = OdsDemo_hostAdd16(xl1, xl20);
+
+                OdsDemo_hostTwMul16(tw[0], tw[1], xt1, yt1, &x[i1], &x[i1 + 1]);
+                OdsDemo_hostTwMul16(tw[4], tw[5], xt0, yt0, &x[i2], &x[i2 + 1]);
+                OdsDemo_hostTwMul16(tw[8], tw[9], xt2, yt2, &x[i3], &x[i3 + 1]);
+            }
+        }
+        w += 12 * (quarter >> 1);
+    }
+
+    /* unscaled last stage, the output is written in natural order */
+    numDigits = (30 - (int32_t) _norm(npoints / radix)) >> 1;
+    quarter   = 2 * (npoints >> 2);
+    for (grp = 0; grp < npoints / radix; grp++)
+    {
+        i0 = 2 * radix * grp;
+        k  = 2 * OdsDemo_hostFftDigitRev(grp, numDigits);
+        if (radix == 2)
+        {
+            ptr_y[k]                   = (int16_t) OdsDemo_hostAdd16(x[i0],     x[i0 + 2]);
+            ptr_y[k + 1]               = (int16_t) OdsDemo_hostAdd16(x[i0 + 1], x[i0 + 3]);
+            ptr_y[k + npoints]         = (int16_t) OdsDemo_hostSub16(x[i0],     x[i0 + 2]);
+            ptr_y[k + npoints + 1]     = (int16_t) OdsDemo_hostSub16(x[i0 + 1], x[i0 + 3]);
+            continue;
+        }
+
+        xh0  = OdsDemo_hostAdd16(x[i0],     x[i0 + 4]);
+        xh1  = OdsDemo_hostAdd16(x[i0 + 1], x[i0 + 5]);
+        xl0  = OdsDemo_hostSub16(x[i0],     x[i0 + 4]);
+        xl1  = OdsDemo_hostSub16(x[i0 + 1], x[i0 + 5]);
+        xh20 = OdsDemo_hostAdd16(x[i0 + 2], x[i0 + 6]);
+        xh21 = OdsDemo_hostAdd16(x[i0 + 3], x[i0 + 7]);
+        xl20 = OdsDemo_hostSub16(x[i0 + 2], x[i0 + 6]);
+        xl21 = OdsDemo_hostSub16(x[i0 + 3], x[i0 + 7]);
+
+        ptr_y[k]                   = (int16_t) OdsDemo_hostAdd16(xh0, xh20);
+        ptr_y[k + 1]               = (int16_t) OdsDemo_hostAdd16(xh1, xh21);
+        ptr_y[k + quarter]         = (int16_t) OdsDemo_hostAdd16(xl0, xl21);
+        ptr_y[k + quarter + 1]     = (int16_t) OdsDemo_hostSub16(xl1, xl20);
+        ptr_y[k + 2 * quarter]     = (int16_t) OdsDemo_hostSub16(xh0, xh20);
+        ptr_y[k + 2 * quarter + 1] = (int16_t) OdsDemo_hostSub16(xh1, xh21);
+        ptr_y[k + 3 * quarter]     = (int16_t) OdsDemo_hostSub16(xl0, xl21);
+        ptr_y[k + 3 * quarter + 1] = (int16_t) OdsDemo_hostAdd16(xl1, xl20);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the dsplib 32x32 FFT. See @ref DSP_fft32x32 in
+ *      dss_host_kernels.h.
+ */
+void DSP_fft32x32(const int32_t *ptr_w, int32_t npoints, int32_t *ptr_x, int32_t *ptr_y)
+{
+    const int32_t *w = ptr_w;
+    const int32_t *tw;
+    int32_t *x = ptr_x;
+    int32_t  radix, grpLen, quarter, grp, bfly, numDigits, k;
+    int32_t  i0, i1, i2, i3;
+    int32_t  xh0, xh1, xl0, xl1, xh20, xh21, xl20, xl21;
+    int32_t  xt0, yt0, xt1, yt1, xt2, yt2;
+
+    /* the last stage is a radix-2 one for odd powers of 2 */
+    radix = ((30 - (int32_t) _norm(npoints)) & 1) ? 2 : 4;
+
+    /* radix-4 decimation in frequency stages in place, not scaled */
+    for (grpLen = npoints; grpLen > radix; grpLen >>= 2)
+    {
+        quarter = grpLen >> 2;
+        for (grp = 0; grp < npoints; grp += grpLen)
+        {
+            for (bfly = 0; bfly < quarter; bfly++)
+            {
+                tw = &w[6 * bfly];
+                i0 = 2 * (grp + bfly);
+                i1 = i0 + 2 * quarter;
+                i2 = i1 + 2 * quarter;
+                i3 = i2 + 2 * quarter;
+
+                xh0  = OdsDemo_hostAdd32(x[i0],     x[i2]);
+                xh1  = OdsDemo_hostAdd32(x[i0 + 1], x[i2 + 1]);
+                xl0  = OdsDemo_hostSub32(x[i0],     x[i2]);
+                xl1  = OdsDemo_hostSub32(x[i0 + 1], x[i2 + 1]);
+                xh20 = OdsDemo_hostAdd32(x[i1],     x[i3]);
+                xh21 = OdsDemo_hostAdd32(x[i1 + 1], x[i3 + 1]);
+                xl20 = OdsDemo_hostSub32(x[i1],     x[i3]);
+                xl21 = OdsDemo_hostSub32(x[i1 + 1], x[i3 + 1]);
+
+                x[i0]     = OdsDemo_hostAdd32(xh0, xh20);
+                x[i0 + 1] = OdsDemo_hostAdd32(xh1, xh21);
+
+                xt0 = OdsDemo_hostSub32(xh0, xh20);
+                yt0 = OdsDemo_hostSub32(xh1, xh21);
+                xt1 = OdsDemo_hostAdd32(xl0, xl21);
+                yt1 = OdsDemo_hostSub32(xl1, xl20);
+                xt2 = OdsDemo_hostSub32(xl0, xl21);
+                yt2 = OdsDemo_hostAdd32(xl1, xl20);
+
+                OdsDemo_hostTwMul32(tw[0], tw[1], xt1, yt1, &x[i1], &x[i1 + 1]);
+                OdsDemo_hostTwMul32(tw[2], tw[3], xt0, yt0, &x[i2], &x[i2 + 1]);
+                OdsDemo_hostTwMul32(tw[4], tw[5], xt2, yt2, &x[i3], &x[i3 + 1]);
+            }
+        }
+        w += 6 * quarter;
+    }
+
+    /* last stage, the output is written in natural order */
+    numDigits = (30 - (int32_t) _norm(npoints / radix)) >> 1;
+    quarter   = 2 * (npoints >> 2);
+    for (grp = 0; grp < npoints / radix; grp++)
+    {
+        i0 = 2 * radix * grp;
+        k  = 2 * OdsDemo_hostFftDigitRev(grp, numDigits);
+        if (radix == 2)
+        {
+            ptr_y[k]                   = OdsDemo_hostAdd32(x[i0],     x[i0 + 2]);
+            ptr_y[k + 1]               = OdsDemo_hostAdd32(x[i0 + 1], x[i0 + 3]);
+            ptr_y[k + npoints]         = OdsDemo_hostSub32(x[i0],     x[i0 + 2]);
+            ptr_y[k + npoints + 1]     = OdsDemo_hostSub32(x[i0 + 1], x[i0 + 3]);
+            continue;
+        }
+
+        xh0  = OdsDemo_hostAdd32(x[i0],     x[i0 + 4]);
+        xh1  = OdsDemo_hostAdd32(x[i0 + 1], x[i0 + 5]);
+        xl0  = OdsDemo_hostSub32(x[i0],     x[i0 + 4]);
+        xl1  = OdsDemo_hostSub32(x[i0 + 1], x[i0 + 5]);
+        xh20 = OdsDemo_hostAdd32(x[i0 + 2], x[i0 + 6]);
+        xh21 = OdsDemo_hostAdd32(x[i0 + 3], x[i0 + 7]);
+        xl20 = OdsDemo_hostSub32(x[i0 + 2], x[i0 + 6]);
+        xl21 = OdsDemo_hostSub32(x[i0 + 3], x[i0 + 7]);
+
+        ptr_y[k]                   = OdsDemo_hostAdd32(xh0, xh20);
+        ptr_y[k + 1]               = OdsDemo_hostAdd32(xh1, xh21);
+        ptr_y[k + quarter]         = OdsDemo_hostAdd32(xl0, xl21);
+        ptr_y[k + quarter + 1]     = OdsDemo_hostSub32(xl1, xl20);
+        ptr_y[k + 2 * quarter]     = OdsDemo_hostSub32(xh0, xh20);
+        ptr_y[k + 2 * quarter + 1] = OdsDemo_hostSub32(xh1, xh21);
+        ptr_y[k + 3 * quarter]     = OdsDemo_hostSub32(xl0, xl21);
+        ptr_y[k + 3 * quarter + 1] = OdsDemo_hostAdd32(xl1, xl20);
+    }
+}
+
+void mmwavelib_windowing16x16_evenlen(int16_t *inp, const int16_t *win, uint32_t len)
+{
+    uint32_t i;
+    uint32_t halfLen = len >> 1;
+    int32_t  w;
+
+    i = 0;
+#if defined(__SSSE3__)
+    /* _mm_mulhrs_epi16 computes (x*w + 2^14) >> 15, i.e. the same rounding as
+     * the scalar loop below. Window coefficients are non negative, so the single
+     * overflowing input pair (-32768 x -32768) cannot occur. */
+    for (; i + 4 <= halfLen; i += 4)
+    {
+        __m128i x  = _mm_loadu_si128((const __m128i *) &inp[2 * i]);
+        __m128i wv = _mm_set_epi16(win[i + 3], win[i + 3], win[i + 2], win[i + 2],
+                                   win[i + 1], win[i + 1], win[i],     win[i]);
+        _mm_storeu_si128((__m128i *) &inp[2 * i], _mm_mulhrs_epi16(x, wv));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        w = (i < halfLen) ? win[i] : win[len - 1U - i];
+        inp[2 * i]     = _host_sat16((inp[2 * i]     * w + 0x4000) >> 15);
+        inp[2 * i + 1] = _host_sat16((inp[2 * i + 1] * w + 0x4000) >> 15);
+    }
+}
+
+void mmwavelib_windowing16x32(const int16_t *inp, const int32_t *win, int32_t *out, uint32_t len)
+{
+    uint32_t i;
+    uint32_t halfLen = len >> 1;
+    int32_t  w;
+
+    i = 0;
+#if defined(__SSE4_1__)
+    /* Two samples a step. _mm_mul_epi32 forms the 64-bit products of the
+     * even lanes, the odd lanes are shifted down to be multiplied the same
+     * way. The logical 64-bit shift gives the same low 32 bits as the
+     * arithmetic shift of _mpylir. */
+    for (; i + 2U <= len; i += 2U)
+    {
+        int32_t w0 = (i < halfLen) ? win[i] : win[len - 1U - i];
+        int32_t w1 = (i + 1U < halfLen) ? win[i + 1U] : win[len - 2U - i];
+        __m128i x  = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) &inp[2 * i]));
+        __m128i wv = _mm_set_epi32(w1, w1, w0, w0);
+        __m128i rnd = _mm_set1_epi64x(0x4000);
+        __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(x, wv), rnd), 15);
+        __m128i odd  = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(x, 32),
+                                                                  _mm_srli_epi64(wv, 32)), rnd), 15);
+
+        _mm_storeu_si128((__m128i *) &out[2 * i], _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        w = (i < halfLen) ? win[i] : win[len - 1U - i];
+        out[2 * i]     = _mpylir(inp[2 * i],     w);
+        out[2 * i + 1] = _mpylir(inp[2 * i + 1], w);
+    }
+}
+
+void mmwavelib_log2Abs32(const int32_t *inp, uint16_t *out, uint32_t len)
+{
+    uint32_t i;
+    float    re, im, magSq;
+
+    for (i = 0; i < len; i++)
+    {
+        /* the C674x forms the magnitude squared in single precision */
+        re = (float) inp[2 * i];
+        im = (float) inp[2 * i + 1];
+        magSq = re * re + im * im;
+        if (magSq < 1.0f)
+        {
+            out[i] = 0;
+        }
+        else
+        {
+            /* log2(|x|) = 0.5 * log2(|x|^2) in Q8, truncated on conversion */
+            out[i] = (uint16_t) (128.0f * log2f(magSq));
+        }
+    }
+}
+
+void mmwavelib_accum16(const uint16_t *inp, uint16_t *out, uint32_t len)
+{
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 8U <= len; i += 8U)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *) &inp[i]);
+        __m128i y = _mm_loadu_si128((const __m128i *) &out[i]);
+
+        _mm_storeu_si128((__m128i *) &out[i], _mm_add_epi16(y, x));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        out[i] = (uint16_t) (out[i] + inp[i]);
+    }
+}
+
+void mmwavelib_vecsum(const int16_t *inp, int32_t *out, int32_t len)
+{
+    int32_t i = 0;
+    int32_t sumRe = 0;
+    int32_t sumIm = 0;
+
+#if defined(__SSE4_1__)
+    /* (re0, im0, re1, im1) partial sums, folded after the loop */
+    __m128i acc = _mm_setzero_si128();
+
+    for (; i + 2 <= len; i += 2)
+    {
+        acc = _mm_add_epi32(acc, _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) &inp[2 * i])));
+    }
+    acc   = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+    sumRe = _mm_cvtsi128_si32(acc);
+    sumIm = _mm_cvtsi128_si32(_mm_srli_si128(acc, 4));
+#endif
+    for (; i < len; i++)
+    {
+        sumRe += inp[2 * i];
+        sumIm += inp[2 * i + 1];
+    }
+    out[0] = sumRe;
+    out[1] = sumIm;
+}
+
+void mmwavelib_vecsubc(const int16_t *inp, int16_t *out, uint32_t constant, int32_t len)
+{
+    int32_t i = 0;
+    int16_t cRe = (int16_t) (constant & 0xFFFFU);
+    int16_t cIm = (int16_t) (constant >> 16);
+
+#if defined(__SSE2__)
+    /* the constant is packed like a sample, real part in the lower half */
+    __m128i c = _mm_set1_epi32((int32_t) constant);
+
+    for (; i + 4 <= len; i += 4)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *) &inp[2 * i]);
+
+        _mm_storeu_si128((__m128i *) &out[2 * i], _mm_sub_epi16(x, c));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        out[2 * i]     = (int16_t) (inp[2 * i]     - cRe);
+        out[2 * i + 1] = (int16_t) (inp[2 * i + 1] - cIm);
+    }
+}
+
+uint32_t mmwavelib_cfarCadBwrap(const uint16_t *inp, uint16_t *out, uint32_t len,
+                                uint32_t const1, uint32_t const2,
+                                uint32_t guardLen, uint32_t noiseLen)
+{
+    uint32_t i, k, numDet = 0;
+    uint32_t sum;
+
+    for (i = 0; i < len; i++)
+    {
+        sum = 0;
+        for (k = guardLen + 1U; k <= guardLen + noiseLen; k++)
+        {
+            sum += inp[(i + len - (k % len)) % len];
+            sum += inp[(i + k) % len];
+        }
+        if ((uint32_t) inp[i] > ((sum >> const2) + const1))
+        {
+            out[numDet++] = (uint16_t) i;
+        }
+    }
+    return numDet;
+}
+
+uint32_t mmwavelib_cfarCadB_SOGO(const uint16_t *inp, uint16_t *out, uint32_t len,
+                                 uint32_t cfartype, uint32_t const1, uint32_t const2,
+                                 uint32_t guardLen, uint32_t noiseLen)
+{
+    uint32_t i, k, numDet = 0;
+    uint32_t sumLeft, sumRight, noise;
+    uint32_t span = guardLen + noiseLen;
+    int32_t  hasLeft, hasRight;
+
+    for (i = 0; i < len; i++)
+    {
+        hasLeft  = (i >= span);
+        hasRight = (i + span < len);
+        sumLeft  = 0;
+        sumRight = 0;
+        for (k = guardLen + 1U; k <= span; k++)
+        {
+            if (hasLeft)
+            {
+                sumLeft += inp[i - k];
+            }
+            if (hasRight)
+            {
+                sumRight += inp[i + k];
+            }
+        }
+
+        /* Near the edges only one side is available and is counted twice */
+        if (!hasLeft)
+        {
+            sumLeft = sumRight;
+        }
+        if (!hasRight)
+        {
+            sumRight = sumLeft;
+        }
+
+        if (cfartype == MMWAVELIB_CFAR_CAGO)
+        {
+            noise = 2U * ((sumLeft > sumRight) ? sumLeft : sumRight);
+        }
+        else if (cfartype == MMWAVELIB_CFAR_CASO)
+        {
+            noise = 2U * ((sumLeft < sumRight) ? sumLeft : sumRight);
+        }
+        else
+        {
+            noise = sumLeft + sumRight;
+        }
+
+        if ((uint32_t) inp[i] > ((noise >> const2) + const1))
+        {
+            out[numDet++] = (uint16_t) i;
+        }
+    }
+    return numDet;
+}
+
+void mmwavelib_dftSingleBinWithWindow(const uint32_t *inp, const uint32_t *sincos,
+                                      const int32_t *win, uint64_t *out,
+                                      uint32_t len, uint32_t binIdx)
+{
+    uint32_t i;
+    uint32_t halfLen = len >> 1;
+    int64_t  accRe = 0;
+    int64_t  accIm = 0;
+    int32_t  xRe, xIm, w;
+    int32_t  c, s;
+    uint32_t twIdx = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        w   = (i < halfLen) ? win[i] : win[len - 1U - i];
+        xRe = _mpylir((int16_t) (inp[i] & 0xFFFFU), w);
+        xIm = _mpylir((int16_t) (inp[i] >> 16), w);
+
+        /* Table holds exp(-j*2*pi*k/len) as imaginary (lower) / real (upper),
+         * see OdsDemo_genDftSinCosTable() */
+        s = (int16_t) (sincos[twIdx] & 0xFFFFU);
+        c = (int16_t) (sincos[twIdx] >> 16);
+
+        accRe += (int64_t) xRe * c - (int64_t) xIm * s;
+        accIm += (int64_t) xRe * s + (int64_t) xIm * c;
+
+        twIdx += binIdx;
+        if (twIdx >= len)
+        {
+            twIdx -= len;
+        }
+    }
+    accRe = (accRe + 0x4000) >> 15;
+    accIm = (accIm + 0x4000) >> 15;
+    *out = ((uint64_t) (uint32_t) accIm << 32) | (uint64_t) (uint32_t) accRe;
+}
+
+#endif /* _TMS320C6X */
@@ -0,0 +1,164 @@
+/**
+ *   @file  dss_host_kernels.h
+ *
+ *   @brief
+ *      Portable stand-ins for the dsplib, mmwavelib kernels used by the data path.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_HOST_KERNELS_H
+#define DSS_HOST_KERNELS_H
+
+#ifndef _TMS320C6X
+
+/* The stand-ins follow the interfaces, the scaling and the rounding of the
+ * TI kernels as far as they are documented: the FFTs are decimation in
+ * frequency with 16 (32) bit wrapping butterflies and the twiddle products
+ * rounded as on the C674x, mmwavelib_log2Abs32 takes the single precision
+ * log2 of the magnitude squared and truncates it. The library sources are
+ * not part of this tree, so the results have not been checked bit exact
+ * against the device and off-target results are only good for checking the
+ * data path logic. The windowing, accumulation, sum and subtraction kernels
+ * have SSE2/SSE4.1 loops with the same results as their scalar loops. */
+
+#include <stdint.h>
+#include <ti/common/sys_types.h>
+#include "dss_host_intrinsics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief  CFAR averaging modes accepted by @ref mmwavelib_cfarCadB_SOGO */
+#define MMWAVELIB_CFAR_CA      0U
+#define MMWAVELIB_CFAR_CAGO    1U
+#define MMWAVELIB_CFAR_CASO    2U
+
+/**
+ *  @b Description
+ *  @n
+ *      Mixed radix 16x16 FFT with the dsplib scaling convention: the result
+ *      of every radix-4 stage but the last one is scaled by 2. ptr_w is the
+ *      table of gen_twiddle_fft16x16(), ptr_x is overwritten as by the
+ *      dsplib kernel.
+ */
+void DSP_fft16x16(const int16_t *ptr_w, int32_t npoints, int16_t *ptr_x, int16_t *ptr_y);
+
+/**
+ *  @b Description
+ *  @n
+ *      Mixed radix 32x32 FFT without scaling (dsplib convention). ptr_w is
+ *      the table of gen_twiddle_fft32x32() with a Q31 scale, ptr_x is
+ *      overwritten as by the dsplib kernel.
+ */
+void DSP_fft32x32(const int32_t *ptr_w, int32_t npoints, int32_t *ptr_x, int32_t *ptr_y);
+
+/**
+ *  @b Description
+ *  @n
+ *      In place windowing of complex 16-bit samples with a symmetric Q15
+ *      window of which only the first len/2 coefficients are stored.
+ */
+void mmwavelib_windowing16x16_evenlen(int16_t *inp, const int16_t *win, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Windowing of complex 16-bit samples with a symmetric 32-bit window
+ *      (first len/2 coefficients stored), output (x*w + 2^14) >> 15.
+ */
+void mmwavelib_windowing16x32(const int16_t *inp, const int32_t *win, int32_t *out, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      log2 magnitude of complex 32-bit samples in Q8, from the single
+ *      precision magnitude squared, truncated to the LSB.
+ */
+void mmwavelib_log2Abs32(const int32_t *inp, uint16_t *out, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      out[i] += inp[i]
+ */
+void mmwavelib_accum16(const uint16_t *inp, uint16_t *out, uint32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Sum of complex 16-bit samples, result written as cmplx32ReIm_t.
+ */
+void mmwavelib_vecsum(const int16_t *inp, int32_t *out, int32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Subtracts the packed complex constant from each complex 16-bit sample.
+ */
+void mmwavelib_vecsubc(const int16_t *inp, int16_t *out, uint32_t constant, int32_t len);
+
+/**
+ *  @b Description
+ *  @n
+ *      Cell averaging CFAR with cyclic wrap, returns the number of detections.
+ */
+uint32_t mmwavelib_cfarCadBwrap(const uint16_t *inp, uint16_t *out, uint32_t len,
+                                uint32_t const1, uint32_t const2,
+                                uint32_t guardLen, uint32_t noiseLen);
+
+/**
+ *  @b Description
+ *  @n
+ *      CA/CAGO/CASO CFAR without wrap, returns the number of detections.
+ */
+uint32_t mmwavelib_cfarCadB_SOGO(const uint16_t *inp, uint16_t *out, uint32_t len,
+                                 uint32_t cfartype, uint32_t const1, uint32_t const2,
+                                 uint32_t guardLen, uint32_t noiseLen);
+
+/**
+ *  @b Description
+ *  @n
+ *      Single bin DFT of windowed complex 16-bit samples.
+ */
+void mmwavelib_dftSingleBinWithWindow(const uint32_t *inp, const uint32_t *sincos,
+                                      const int32_t *win, uint64_t *out,
+                                      uint32_t len, uint32_t binIdx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TMS320C6X */
+
+#endif /* DSS_HOST_KERNELS_H */
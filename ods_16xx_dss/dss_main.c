@@ -81,6 +81,7 @@
 #include "dss_data_path.h"
 #include "../common/ods_messages.h"
 #include "dss_lvds_stream.h"
+#include "dss_benchmark.h"
 
 /* C674x mathlib */
 /* Suppress the mathlib.h warnings
@@ -159,9 +160,6 @@ uint16_t gCQRxSigImgMemory[SYS_COMMON_CQ_MAX_CHIRP_THRESHOLD * (RL_NUM_MON_SLICE
 #pragma DATA_SECTION(gCQRxSigImgMemory, ".l2data");
 #pragma DATA_ALIGN(gCQRxSigImgMemory, 4);
 
-/*! @brief Azimuth FFT size */
-#define ODS_NUM_ANGLE_BINS 64
-
 /*! @brief Flag to enable/disable two peak detection in azimuth for same range and velocity */
 #define OdsDemo_AZIMUTH_TWO_PEAK_DETECTION_ENABLE 1
 
@@ -777,6 +775,171 @@ static void OdsDemo_mboxReadTask(UArg arg0, UArg arg1)
                                          sizeof(OdsDemo_ClutterRemovalCfg), subFrameNum);
                     break;
                 }
+                case ODSDEMO_MSS2DSS_STATIC_CLUTTER_CFG:
+                {
+                    /* Save static clutter filter configuration, the clutter map is
+                       initialized again from the next frame */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].staticClutterCfg = message.body.staticClutterCfg;
+                            gOdsDssMCB.dataPathObj[indx].clutterMapValid = 0;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].staticClutterCfg = message.body.staticClutterCfg;
+                        gOdsDssMCB.dataPathObj[subFrameNum].clutterMapValid = 0;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_RANGE_FFT_BATCH_CFG:
+                {
+                    /* Save batched range FFT configuration, applied when the
+                       buffers are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].rangeFftBatchCfg = message.body.rangeFftBatchCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].rangeFftBatchCfg = message.body.rangeFftBatchCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_RADAR_CUBE_BFP_CFG:
+                {
+                    /* Save block floating point radar cube configuration, applied
+                       when the buffers are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].radarCubeBfpCfg = message.body.radarCubeBfpCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].radarCubeBfpCfg = message.body.radarCubeBfpCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_RADAR_CUBE_LAYOUT_CFG:
+                {
+                    /* Save radar cube layout configuration, applied when the
+                       EDMA is configured at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].radarCubeLayoutCfg = message.body.radarCubeLayoutCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].radarCubeLayoutCfg = message.body.radarCubeLayoutCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_OBJ_CAP_CFG:
+                {
+                    /* Save object list capacities, applied when the buffers
+                       are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].objCapCfg = message.body.objCapCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].objCapCfg = message.body.objCapCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_SUB_BIN_INTERP_CFG:
+                {
+                    /* Save sub-bin interpolation configuration, applied when
+                       the buffers are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].subBinInterpCfg = message.body.subBinInterpCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].subBinInterpCfg = message.body.subBinInterpCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_CFAR_THR_TABLE_RANGE_CFG:
+                {
+                    /* Save range CFAR threshold table, expanded when the buffers
+                       are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].cfarThrTableCfgRange = message.body.cfarThrTableCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].cfarThrTableCfgRange = message.body.cfarThrTableCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_CFAR_THR_TABLE_DOPPLER_CFG:
+                {
+                    /* Save Doppler CFAR threshold table, expanded when the buffers
+                       are allocated at sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].cfarThrTableCfgDoppler = message.body.cfarThrTableCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].cfarThrTableCfgDoppler = message.body.cfarThrTableCfg;
+                    }
+                    break;
+                }
+                case ODSDEMO_MSS2DSS_CFAR_THR_CALIB_CFG:
+                {
+                    /* Save CFAR threshold calibration configuration, the
+                       calibration starts when the buffers are allocated at
+                       sensor start */
+                    if (subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG)
+                    {
+                        uint8_t indx;
+                        for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+                        {
+                            gOdsDssMCB.dataPathObj[indx].cfarThrCalibCfg = message.body.cfarThrCalibCfg;
+                        }
+                    }
+                    else
+                    {
+                        gOdsDssMCB.dataPathObj[subFrameNum].cfarThrCalibCfg = message.body.cfarThrCalibCfg;
+                    }
+                    break;
+                }
                 case ODSDEMO_MSS2DSS_ADCBUFCFG:
                 {
                     /* Save ADCBUF configuration */ 
@@ -968,6 +1131,9 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
     OdsDemo_message     message;
     OdsDemo_GuiMonSel   *pGuiMonSel;
     uint32_t            tlvIdx = 0;
+    uint32_t            numObjOut = obj->numDetObj;
+    uint32_t            reservedHsmSize = 0;
+    uint32_t            objOutSize;
 
     /* Get Gui Monitor configuration */
     pGuiMonSel = &obj->cliCfg->guiMonSel;
@@ -979,6 +1145,41 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
         goto Exit;
     }
 
+    /* The object cap can be configured larger than what fits in the HSM buffer.
+       Reserve the space of the other TLVs written to the HSM buffer and send only
+       as many objects as fit in the rest, so that the frame output is not lost. */
+    if ((pGuiMonSel->detectedObjects == 1) && (obj->numDetObj > 0))
+    {
+        if (pGuiMonSel->logMagRange == 1)
+        {
+            reservedHsmSize += sizeof(uint16_t) * obj->numRangeBins;
+        }
+        if (pGuiMonSel->noiseProfile == 1)
+        {
+            reservedHsmSize += sizeof(uint16_t) * obj->numRangeBins;
+        }
+        if (pGuiMonSel->statsInfo == 1)
+        {
+            reservedHsmSize += sizeof(OdsDemo_output_message_stats);
+        }
+        reservedHsmSize += sizeof(OdsDemo_output_message_dataObjDescr);
+        objOutSize = sizeof(OdsDemo_detectedObj);
+        if (obj->detObjSubBin != NULL)
+        {
+            reservedHsmSize += sizeof(OdsDemo_output_message_subBinObjDescr);
+            objOutSize += sizeof(OdsDemo_detectedObjSubBin);
+        }
+
+        if (reservedHsmSize >= outputBufSize)
+        {
+            numObjOut = 0;
+        }
+        else
+        {
+            numObjOut = MIN(numObjOut, (outputBufSize - reservedHsmSize) / objOutSize);
+        }
+    }
+
 
     /* Clear message to MSS */
     memset((void *)&message, 0, sizeof(OdsDemo_message));
@@ -989,7 +1190,7 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
     message.body.detObj.header.magicWord[1] = 0x0304;
     message.body.detObj.header.magicWord[2] = 0x0506;
     message.body.detObj.header.magicWord[3] = 0x0708;
-    message.body.detObj.header.numDetectedObj = obj->numDetObj;
+    message.body.detObj.header.numDetectedObj = numObjOut;
     message.body.detObj.header.version =    MMWAVE_SDK_VERSION_BUILD |   //DEBUG_VERSION
                                             (MMWAVE_SDK_VERSION_BUGFIX << 8) |
                                             (MMWAVE_SDK_VERSION_MINOR << 16) |
@@ -999,11 +1200,11 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
     ptrCurrBuffer = ptrHsmBuffer;
 
     /* Put detected Objects in HSM buffer: sizeof(OdsDemo_objOut_t) * numDetObj  */
-    if ((pGuiMonSel->detectedObjects == 1) && (obj->numDetObj > 0))
+    if ((pGuiMonSel->detectedObjects == 1) && (numObjOut > 0))
     {
         /* Add objects descriptor */
         OdsDemo_output_message_dataObjDescr descr;
-        descr.numDetetedObj = obj->numDetObj;
+        descr.numDetetedObj = numObjOut;
         descr.xyzQFormat = obj->xyzOutputQFormat;
         itemPayloadLen = sizeof(OdsDemo_output_message_dataObjDescr);
         totalHsmSize += itemPayloadLen;
@@ -1015,7 +1216,7 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
         memcpy(ptrCurrBuffer, (void *)&descr, itemPayloadLen);
 
         /* Add array of objects */
-        itemPayloadLen = sizeof(OdsDemo_detectedObj) * obj->numDetObj;
+        itemPayloadLen = sizeof(OdsDemo_detectedObj) * numObjOut;
         totalHsmSize += itemPayloadLen;
         if(totalHsmSize > outputBufSize)
         {
@@ -1032,6 +1233,43 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
         /* Incrementing pointer to HSM buffer */
         ptrCurrBuffer += itemPayloadLen + sizeof(OdsDemo_output_message_dataObjDescr);
         totalPacketLen += sizeof(OdsDemo_output_message_tl) + itemPayloadLen + sizeof(OdsDemo_output_message_dataObjDescr);
+
+        /* Fractional range and Doppler indices of the objects:
+           sizeof(OdsDemo_detectedObjSubBin) * numDetObj */
+        if (obj->detObjSubBin != NULL)
+        {
+            OdsDemo_output_message_subBinObjDescr subBinDescr;
+            OdsDemo_detectedObjSubBin *subBinObj;
+
+            subBinDescr.numDetectedObj = numObjOut;
+            subBinDescr.binQFormat = ODS_SUB_BIN_QFORMAT;
+            itemPayloadLen = sizeof(OdsDemo_output_message_subBinObjDescr) +
+                             sizeof(OdsDemo_detectedObjSubBin) * numObjOut;
+            totalHsmSize += itemPayloadLen;
+            if(totalHsmSize > outputBufSize)
+            {
+                retVal = -1;
+                goto Exit;
+            }
+            memcpy(ptrCurrBuffer, (void *)&subBinDescr, sizeof(OdsDemo_output_message_subBinObjDescr));
+            subBinObj = (OdsDemo_detectedObjSubBin *) &ptrCurrBuffer[sizeof(OdsDemo_output_message_subBinObjDescr)];
+            for (i = 0; i < numObjOut; i++)
+            {
+                subBinObj[i].rangeIdx = ((int32_t) obj->detObj2D[i].rangeIdx << ODS_SUB_BIN_QFORMAT) +
+                                        obj->detObjSubBin[i].rangeOffs;
+                subBinObj[i].dopplerIdx = ((int32_t) obj->detObj2D[i].dopplerIdx * (1 << ODS_SUB_BIN_QFORMAT)) +
+                                          obj->detObjSubBin[i].dopplerOffs;
+            }
+
+            message.body.detObj.tlv[tlvIdx].length = itemPayloadLen;
+            message.body.detObj.tlv[tlvIdx].type = ODSDEMO_OUTPUT_MSG_DETECTED_POINTS_SUB_BIN;
+            message.body.detObj.tlv[tlvIdx].address = (uint32_t) ptrCurrBuffer;
+            tlvIdx++;
+
+            /* Incrementing pointer to HSM buffer */
+            ptrCurrBuffer += itemPayloadLen;
+            totalPacketLen += sizeof(OdsDemo_output_message_tl) + itemPayloadLen;
+        }
     }
 
     /* Sending range profile:  2bytes * numRangeBins */
@@ -1132,6 +1370,12 @@ int32_t OdsDemo_dssSendProcessOutputToMSS
         stats.transmitOutputTime = (uint32_t) (obj->timingInfo.transmitOutputCycles/DSP_CLOCK_MHZ);
         stats.activeFrameCPULoad = obj->timingInfo.activeFrameCPULoad;
         stats.interFrameCPULoad = obj->timingInfo.interFrameCPULoad;
+        stats.radarCubeExpMin = obj->radarCubeBfpStats.expMin;
+        stats.radarCubeExpMax = obj->radarCubeBfpStats.expMax;
+        stats.radarCubeNumScaledBlocks = (uint16_t) MIN(obj->radarCubeBfpStats.numScaledBlocks, 0xFFFFU);
+        stats.dopplerInNumClipped = obj->radarCubeBfpStats.numClipped;
+        stats.numDetObjRawDropped = obj->numDetObjRawDropped;
+        stats.numDetObjDropped = obj->numDetObjDropped + (obj->numDetObj - numObjOut);
         memcpy(ptrCurrBuffer, (void *)&stats, itemPayloadLen);
 
         message.body.detObj.tlv[tlvIdx].length = itemPayloadLen;
@@ -2800,6 +3044,11 @@ static void OdsDemo_dssInitTask(UArg arg0, UArg arg1)
     System_printf ("Debug: ODSDemoDSS Data Path init succeeded\n");
     gOdsDssMCB.state = ODSDEMO_DSS_STATE_INIT;
 
+#ifdef ODS_BENCHMARK
+    /* Runs before the data path task starts, the benchmarks use the data path heaps */
+    OdsDemo_benchRun(&gOdsDssMCB.dataPathContext, ODS_BENCH_RESULT_FILE, ODS_BENCH_BASELINE_FILE);
+#endif
+
     /* Start data path task */
     Task_Params_init(&taskParams);
     taskParams.priority = 5;
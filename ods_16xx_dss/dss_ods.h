@@ -60,6 +60,10 @@
 #include "dss_data_path.h"
 #include "dss_lvds_stream.h"
 #include "../common/ods_messages.h"
+#ifndef _TMS320C6X
+/* Off-target build: provides _norm() used by OdsDemo_floorLog2() */
+#include "dss_host_intrinsics.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,7 +97,6 @@ extern "C" {
 #define ODSDEMO_BSS_CALIBRATION_REP_EVT                     Event_Id_08
 
 /* Map all common MmmDemo_* structures to OdsDemo_* */
-#define OdsDemo_output_message_stats        MmwDemo_output_message_stats
 #define OdsDemo_output_message_dataObjDescr MmwDemo_output_message_dataObjDescr
 #define OdsDemo_measureRxChannelBiasCfg_t   MmwDemo_measureRxChannelBiasCfg_t
 #define OdsDemo_ADCBufCfg                   MmwDemo_ADCBufCfg
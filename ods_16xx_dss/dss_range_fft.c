@@ -0,0 +1,965 @@
+/**
+ *   @file  dss_range_fft.c
+ *
+ *   @brief
+ *      Range FFT with windowing and zero padding fused into the first stage.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <math.h>
+
+/* On the C674x the intrinsics are compiler built-ins */
+#ifndef _TMS320C6X
+#include "dss_host_intrinsics.h"
+#endif
+
+#include "dss_range_fft.h"
+
+/**************************************************************************
+ *************************** Local Definitions ****************************
+ **************************************************************************/
+
+/*! @brief pi in double precision, for the twiddle factors */
+#define ODS_RANGE_FFT_PI        3.14159265358979323846
+
+/*! @brief Q15 twiddle scale, as in gen_twiddle_fft16x16() */
+#define ODS_RANGE_FFT_TW_SCALE  32767.5
+
+/*! @brief Rounding constant of the Q15 twiddle multiplication */
+#define ODS_RANGE_FFT_TW_RND    0x4000
+
+/**************************************************************************
+ *************************** Local Functions ******************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Position of the output block of the first stage fed by input offset
+ *      idx: the numDigitBits/2 radix-4 digits of idx in reverse order.
+ */
+static inline uint32_t OdsDemo_rangeFftDigitRev(uint32_t idx, uint32_t numDigitBits)
+{
+    /* split shift, numDigitBits may be 0 */
+    uint32_t rev = (_bitr(idx) >> 1) >> (31U - numDigitBits);
+
+    return ((rev & 0x55555555U) << 1) | ((rev >> 1) & 0x55555555U);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Loads ADC sample idx and applies the symmetric window.
+ */
+static inline void OdsDemo_rangeFftLoad(const cmplx16ReIm_t * restrict adcIn,
+                                        const int16_t * restrict window,
+                                        uint32_t numAdcSamples,
+                                        uint32_t idx,
+                                        int32_t *re,
+                                        int32_t *im)
+{
+    int32_t w = (idx < (numAdcSamples >> 1)) ? window[idx] : window[numAdcSamples - 1U - idx];
+
+    *re = (adcIn[idx].real * w + 0x4000) >> 15;
+    *im = (adcIn[idx].imag * w + 0x4000) >> 15;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Q15 twiddle multiplication with rounding.
+ */
+static inline void OdsDemo_rangeFftCmul(int32_t *re, int32_t *im, cmplx16ReIm_t w)
+{
+    int64_t xr = *re;
+    int64_t xi = *im;
+
+    *re = (int32_t) ((xr * w.real - xi * w.imag + ODS_RANGE_FFT_TW_RND) >> 15);
+    *im = (int32_t) ((xr * w.imag + xi * w.real + ODS_RANGE_FFT_TW_RND) >> 15);
+}
+
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+/**
+ *  @b Description
+ *  @n
+ *      Loads two consecutive ADC samples from idx, applies the window and
+ *      widens them to (re0, im0, re1, im1). _mm_mulhrs_epi16 rounds like
+ *      the scalar path.
+ */
+static inline __m128i OdsDemo_rangeFftLoadSse(const cmplx16ReIm_t *adcIn, const int16_t *window,
+                                              uint32_t numAdcSamples, uint32_t idx)
+{
+    uint32_t half = numAdcSamples >> 1;
+    int16_t  w0 = (idx < half) ? window[idx] : window[numAdcSamples - 1U - idx];
+    int16_t  w1 = (idx + 1U < half) ? window[idx + 1U] : window[numAdcSamples - 2U - idx];
+    __m128i  x = _mm_loadl_epi64((const __m128i *) &adcIn[idx]);
+
+    x = _mm_mulhrs_epi16(x, _mm_set_epi16(0, 0, 0, 0, w1, w1, w0, w0));
+    return _mm_cvtepi16_epi32(x);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Q15 twiddle multiplication of two complex values, w holding the
+ *      twiddles as (wr0, wi0, wr1, wi1). The 64-bit logical shift gives
+ *      the same low 32 bits as the arithmetic shift of the scalar path.
+ */
+static inline __m128i OdsDemo_rangeFftCmulSse(__m128i x, __m128i w)
+{
+    const __m128i rnd = _mm_set1_epi64x(ODS_RANGE_FFT_TW_RND);
+    __m128i xi = _mm_srli_epi64(x, 32);
+    __m128i wi = _mm_srli_epi64(w, 32);
+    __m128i re = _mm_sub_epi64(_mm_mul_epi32(x, w), _mm_mul_epi32(xi, wi));
+    __m128i im = _mm_add_epi64(_mm_mul_epi32(x, wi), _mm_mul_epi32(xi, w));
+
+    re = _mm_srli_epi64(_mm_add_epi64(re, rnd), 15);
+    im = _mm_srli_epi64(_mm_add_epi64(im, rnd), 15);
+    return _mm_blend_epi16(re, _mm_slli_epi64(im, 32), 0xCC);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Twiddles k and k + 1 of stride step as (wr0, wi0, wr1, wi1).
+ */
+static inline __m128i OdsDemo_rangeFftTwiddleSse(const cmplx16ReIm_t *twiddle, uint32_t k, uint32_t step)
+{
+    cmplx16ReIm_t w0 = twiddle[k * step];
+    cmplx16ReIm_t w1 = twiddle[(k + 1U) * step];
+
+    return _mm_set_epi32(w1.imag, w1.real, w0.imag, w0.real);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Twiddle factor as (wr, wi, wr, wi), for two channels.
+ */
+static inline __m128i OdsDemo_rangeFftTwiddleBcastSse(const cmplx16ReIm_t *twiddle)
+{
+    return _mm_cvtepi16_epi32(_mm_set1_epi32((int32_t) _amem4_const(twiddle)));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Radix-4 butterfly of two complex values per vector, outputs scaled
+ *      by shift.
+ */
+static inline void OdsDemo_rangeFftBfly4Sse(__m128i a0, __m128i a1, __m128i a2, __m128i a3,
+                                            int32_t shift, __m128i *y)
+{
+    __m128i b0 = _mm_add_epi32(a0, a2);
+    __m128i b1 = _mm_sub_epi32(a0, a2);
+    __m128i b2 = _mm_add_epi32(a1, a3);
+    __m128i b3 = _mm_sub_epi32(a1, a3);
+    /* (b3.im, b3.re): y1 = b1 - j*b3, y3 = b1 + j*b3 */
+    __m128i s  = _mm_shuffle_epi32(b3, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128i p  = _mm_add_epi32(b1, s);
+    __m128i m  = _mm_sub_epi32(b1, s);
+
+    y[0] = _mm_srai_epi32(_mm_add_epi32(b0, b2), shift);
+    y[1] = _mm_srai_epi32(_mm_blend_epi16(p, m, 0xCC), shift);
+    y[2] = _mm_srai_epi32(_mm_sub_epi32(b0, b2), shift);
+    y[3] = _mm_srai_epi32(_mm_blend_epi16(m, p, 0xCC), shift);
+}
+#endif
+
+/**
+ *  @b Description
+ *  @n
+ *      Radix-4 butterfly, outputs scaled by shift.
+ */
+static inline void OdsDemo_rangeFftBfly4(int32_t *re, int32_t *im, int32_t shift)
+{
+    int32_t b0r = re[0] + re[2];
+    int32_t b0i = im[0] + im[2];
+    int32_t b1r = re[0] - re[2];
+    int32_t b1i = im[0] - im[2];
+    int32_t b2r = re[1] + re[3];
+    int32_t b2i = im[1] + im[3];
+    int32_t b3r = re[1] - re[3];
+    int32_t b3i = im[1] - im[3];
+
+    /* y1 = b1 - j*b3, y3 = b1 + j*b3 */
+    re[0] = (b0r + b2r) >> shift;
+    im[0] = (b0i + b2i) >> shift;
+    re[1] = (b1r + b3i) >> shift;
+    im[1] = (b1i - b3r) >> shift;
+    re[2] = (b0r - b2r) >> shift;
+    im[2] = (b0i - b2i) >> shift;
+    re[3] = (b1r - b3i) >> shift;
+    im[3] = (b1i + b3r) >> shift;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      First stage, radix-4, for input offsets offStart to offEnd - 1 of
+ *      which the first numIn of the four inputs are ADC samples and the
+ *      others zero padding. Called with constant numIn so that the zero
+ *      terms drop out after inlining.
+ */
+static inline void OdsDemo_rangeFftFirstStage4(const cmplx16ReIm_t * restrict adcIn,
+                                               const int16_t * restrict window,
+                                               uint32_t numAdcSamples,
+                                               uint32_t quarter,
+                                               uint32_t numDigitBits,
+                                               uint32_t offStart,
+                                               uint32_t offEnd,
+                                               uint32_t numIn,
+                                               cmplx32ReIm_t * restrict y)
+{
+    uint32_t off, q, blk;
+    int32_t  re[4], im[4];
+
+    off = offStart;
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+    for (; off + 2U <= offEnd; off += 2U)
+    {
+        __m128i a[4], b[4];
+        uint32_t blk1;
+
+        for (q = 0; q < 4U; q++)
+        {
+            a[q] = (q < numIn) ? OdsDemo_rangeFftLoadSse(adcIn, window, numAdcSamples, off + q * quarter) :
+                                 _mm_setzero_si128();
+        }
+        OdsDemo_rangeFftBfly4Sse(a[0], a[1], a[2], a[3], 0, b);
+
+        blk  = OdsDemo_rangeFftDigitRev(off, numDigitBits) * 4U;
+        blk1 = OdsDemo_rangeFftDigitRev(off + 1U, numDigitBits) * 4U;
+        _mm_storeu_si128((__m128i *) &y[blk],      _mm_unpacklo_epi64(b[0], b[1]));
+        _mm_storeu_si128((__m128i *) &y[blk + 2],  _mm_unpacklo_epi64(b[2], b[3]));
+        _mm_storeu_si128((__m128i *) &y[blk1],     _mm_unpackhi_epi64(b[0], b[1]));
+        _mm_storeu_si128((__m128i *) &y[blk1 + 2], _mm_unpackhi_epi64(b[2], b[3]));
+    }
+#endif
+    for (; off < offEnd; off++)
+    {
+        for (q = 0; q < 4U; q++)
+        {
+            re[q] = 0;
+            im[q] = 0;
+            if (q < numIn)
+            {
+                OdsDemo_rangeFftLoad(adcIn, window, numAdcSamples, off + q * quarter, &re[q], &im[q]);
+            }
+        }
+        OdsDemo_rangeFftBfly4(re, im, 0);
+
+        blk = OdsDemo_rangeFftDigitRev(off, numDigitBits) * 4U;
+        for (q = 0; q < 4U; q++)
+        {
+            y[blk + q].real = re[q];
+            y[blk + q].imag = im[q];
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      First stage, radix-2, see @ref OdsDemo_rangeFftFirstStage4.
+ */
+static inline void OdsDemo_rangeFftFirstStage2(const cmplx16ReIm_t * restrict adcIn,
+                                               const int16_t * restrict window,
+                                               uint32_t numAdcSamples,
+                                               uint32_t half,
+                                               uint32_t numDigitBits,
+                                               uint32_t offStart,
+                                               uint32_t offEnd,
+                                               uint32_t numIn,
+                                               cmplx32ReIm_t * restrict y)
+{
+    uint32_t off, blk;
+    int32_t  a0r, a0i, a1r = 0, a1i = 0;
+
+    for (off = offStart; off < offEnd; off++)
+    {
+        OdsDemo_rangeFftLoad(adcIn, window, numAdcSamples, off, &a0r, &a0i);
+        if (numIn > 1U)
+        {
+            OdsDemo_rangeFftLoad(adcIn, window, numAdcSamples, off + half, &a1r, &a1i);
+        }
+
+        blk = OdsDemo_rangeFftDigitRev(off, numDigitBits) * 2U;
+        y[blk].real     = a0r + a1r;
+        y[blk].imag     = a0i + a1i;
+        y[blk + 1].real = a0r - a1r;
+        y[blk + 1].imag = a0i - a1i;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Radix-4 combining stage of size n, scaled by 2. Runs in place in the
+ *      scratch buffer or, for the last stage (out != NULL), writes the
+ *      result saturated to 16 bits to out.
+ */
+static void OdsDemo_rangeFftStage(cmplx32ReIm_t * restrict y,
+                                  const cmplx16ReIm_t * restrict twiddle,
+                                  uint32_t fftSize,
+                                  uint32_t n,
+                                  cmplx16ReIm_t * restrict out)
+{
+    uint32_t m = n >> 2;
+    uint32_t step = fftSize / n;
+    uint32_t blk, k, q;
+    int32_t  re[4], im[4];
+    cmplx32ReIm_t *x;
+
+    for (blk = 0; blk < fftSize; blk += n)
+    {
+        x = &y[blk];
+        k = 0;
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+        for (; k + 2U <= m; k += 2U)
+        {
+            __m128i a[4], b[4];
+
+            a[0] = _mm_loadu_si128((const __m128i *) &x[k]);
+            for (q = 1; q < 4U; q++)
+            {
+                a[q] = OdsDemo_rangeFftCmulSse(_mm_loadu_si128((const __m128i *) &x[k + q * m]),
+                                               OdsDemo_rangeFftTwiddleSse(twiddle, k, q * step));
+            }
+            OdsDemo_rangeFftBfly4Sse(a[0], a[1], a[2], a[3], 1, b);
+
+            for (q = 0; q < 4U; q++)
+            {
+                if (out != NULL)
+                {
+                    _mm_storel_epi64((__m128i *) &out[blk + k + q * m], _mm_packs_epi32(b[q], b[q]));
+                }
+                else
+                {
+                    _mm_storeu_si128((__m128i *) &x[k + q * m], b[q]);
+                }
+            }
+        }
+#endif
+        for (; k < m; k++)
+        {
+            re[0] = x[k].real;
+            im[0] = x[k].imag;
+            for (q = 1; q < 4U; q++)
+            {
+                re[q] = x[k + q * m].real;
+                im[q] = x[k + q * m].imag;
+                OdsDemo_rangeFftCmul(&re[q], &im[q], twiddle[q * k * step]);
+            }
+            OdsDemo_rangeFftBfly4(re, im, 1);
+
+            for (q = 0; q < 4U; q++)
+            {
+                if (out != NULL)
+                {
+                    _amem4(&out[blk + k + q * m]) = _spack2(im[q], re[q]);
+                }
+                else
+                {
+                    x[k + q * m].real = re[q];
+                    x[k + q * m].imag = im[q];
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Window coefficient of ADC sample idx.
+ */
+static inline int32_t OdsDemo_rangeFftWinCoef(const int16_t * restrict window,
+                                              uint32_t numAdcSamples,
+                                              uint32_t idx)
+{
+    return (idx < (numAdcSamples >> 1)) ? window[idx] : window[numAdcSamples - 1U - idx];
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      First stage of the batched transform, radix-4, see
+ *      @ref OdsDemo_rangeFftFirstStage4. The window coefficients are loaded
+ *      once per input offset for all channels, the output is interleaved by
+ *      channel.
+ */
+static inline void OdsDemo_rangeFftBatchFirstStage4(const cmplx16ReIm_t * restrict adcIn,
+                                                    uint32_t numCh,
+                                                    const int16_t * restrict window,
+                                                    uint32_t numAdcSamples,
+                                                    uint32_t quarter,
+                                                    uint32_t numDigitBits,
+                                                    uint32_t offStart,
+                                                    uint32_t offEnd,
+                                                    uint32_t numIn,
+                                                    cmplx32ReIm_t * restrict y)
+{
+    uint32_t off, q, ch, blk, idx;
+    int32_t  w[4], re[4], im[4];
+    const cmplx16ReIm_t *x;
+
+    for (off = offStart; off < offEnd; off++)
+    {
+        for (q = 0; q < numIn; q++)
+        {
+            w[q] = OdsDemo_rangeFftWinCoef(window, numAdcSamples, off + q * quarter);
+        }
+        blk = OdsDemo_rangeFftDigitRev(off, numDigitBits) * 4U * numCh;
+
+        ch = 0;
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+        for (; ch + 2U <= numCh; ch += 2U)
+        {
+            __m128i a[4], b[4];
+
+            for (q = 0; q < 4U; q++)
+            {
+                a[q] = _mm_setzero_si128();
+                if (q < numIn)
+                {
+                    idx = off + q * quarter;
+                    x = &adcIn[ch * numAdcSamples + idx];
+                    a[q] = _mm_unpacklo_epi32(_mm_cvtsi32_si128(_amem4_const(&x[0])),
+                                              _mm_cvtsi32_si128(_amem4_const(&x[numAdcSamples])));
+                    a[q] = _mm_cvtepi16_epi32(_mm_mulhrs_epi16(a[q], _mm_set1_epi16((int16_t) w[q])));
+                }
+            }
+            OdsDemo_rangeFftBfly4Sse(a[0], a[1], a[2], a[3], 0, b);
+
+            for (q = 0; q < 4U; q++)
+            {
+                _mm_storeu_si128((__m128i *) &y[blk + q * numCh + ch], b[q]);
+            }
+        }
+#endif
+        for (; ch < numCh; ch++)
+        {
+            x = &adcIn[ch * numAdcSamples];
+            for (q = 0; q < 4U; q++)
+            {
+                re[q] = 0;
+                im[q] = 0;
+                if (q < numIn)
+                {
+                    idx = off + q * quarter;
+                    re[q] = (x[idx].real * w[q] + 0x4000) >> 15;
+                    im[q] = (x[idx].imag * w[q] + 0x4000) >> 15;
+                }
+            }
+            OdsDemo_rangeFftBfly4(re, im, 0);
+
+            for (q = 0; q < 4U; q++)
+            {
+                y[blk + q * numCh + ch].real = re[q];
+                y[blk + q * numCh + ch].imag = im[q];
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      First stage of the batched transform, radix-2, see
+ *      @ref OdsDemo_rangeFftBatchFirstStage4.
+ */
+static inline void OdsDemo_rangeFftBatchFirstStage2(const cmplx16ReIm_t * restrict adcIn,
+                                                    uint32_t numCh,
+                                                    const int16_t * restrict window,
+                                                    uint32_t numAdcSamples,
+                                                    uint32_t half,
+                                                    uint32_t numDigitBits,
+                                                    uint32_t offStart,
+                                                    uint32_t offEnd,
+                                                    uint32_t numIn,
+                                                    cmplx32ReIm_t * restrict y)
+{
+    uint32_t off, ch, blk;
+    int32_t  w0, w1 = 0;
+    int32_t  a0r, a0i, a1r = 0, a1i = 0;
+    const cmplx16ReIm_t *x;
+
+    for (off = offStart; off < offEnd; off++)
+    {
+        w0 = OdsDemo_rangeFftWinCoef(window, numAdcSamples, off);
+        if (numIn > 1U)
+        {
+            w1 = OdsDemo_rangeFftWinCoef(window, numAdcSamples, off + half);
+        }
+        blk = OdsDemo_rangeFftDigitRev(off, numDigitBits) * 2U * numCh;
+
+        for (ch = 0; ch < numCh; ch++)
+        {
+            x = &adcIn[ch * numAdcSamples];
+            a0r = (x[off].real * w0 + 0x4000) >> 15;
+            a0i = (x[off].imag * w0 + 0x4000) >> 15;
+            if (numIn > 1U)
+            {
+                a1r = (x[off + half].real * w1 + 0x4000) >> 15;
+                a1i = (x[off + half].imag * w1 + 0x4000) >> 15;
+            }
+
+            y[blk + ch].real         = a0r + a1r;
+            y[blk + ch].imag         = a0i + a1i;
+            y[blk + numCh + ch].real = a0r - a1r;
+            y[blk + numCh + ch].imag = a0i - a1i;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Radix-4 combining stage of the batched transform, see
+ *      @ref OdsDemo_rangeFftStage. The three twiddle factors of a butterfly
+ *      are loaded once and applied to all channels. The last stage
+ *      (out != NULL) writes channel ch to out + ch * outStride.
+ */
+static void OdsDemo_rangeFftBatchStage(cmplx32ReIm_t * restrict y,
+                                       uint32_t numCh,
+                                       const cmplx16ReIm_t * restrict twiddle,
+                                       uint32_t fftSize,
+                                       uint32_t n,
+                                       cmplx16ReIm_t * restrict out,
+                                       uint32_t outStride)
+{
+    uint32_t m = n >> 2;
+    uint32_t step = fftSize / n;
+    uint32_t blk, k, q, ch;
+    int32_t  re[4], im[4];
+    cmplx16ReIm_t w[4];
+    cmplx32ReIm_t *x;
+
+    for (blk = 0; blk < fftSize; blk += n)
+    {
+        for (k = 0; k < m; k++)
+        {
+            x = &y[(blk + k) * numCh];
+
+            ch = 0;
+#if !defined(_TMS320C6X) && defined(__SSE4_1__)
+            {
+                /* the legs are written out so that the twiddles stay in
+                   registers across the channels */
+                __m128i w1 = OdsDemo_rangeFftTwiddleBcastSse(&twiddle[k * step]);
+                __m128i w2 = OdsDemo_rangeFftTwiddleBcastSse(&twiddle[2U * k * step]);
+                __m128i w3 = OdsDemo_rangeFftTwiddleBcastSse(&twiddle[3U * k * step]);
+                cmplx32ReIm_t *x1 = &x[m * numCh];
+                cmplx32ReIm_t *x2 = &x[2U * m * numCh];
+                cmplx32ReIm_t *x3 = &x[3U * m * numCh];
+                uint32_t idx;
+
+                for (; ch + 2U <= numCh; ch += 2U)
+                {
+                    __m128i b[4];
+
+                    OdsDemo_rangeFftBfly4Sse(
+                        _mm_loadu_si128((const __m128i *) &x[ch]),
+                        OdsDemo_rangeFftCmulSse(_mm_loadu_si128((const __m128i *) &x1[ch]), w1),
+                        OdsDemo_rangeFftCmulSse(_mm_loadu_si128((const __m128i *) &x2[ch]), w2),
+                        OdsDemo_rangeFftCmulSse(_mm_loadu_si128((const __m128i *) &x3[ch]), w3),
+                        1, b);
+
+                    if (out != NULL)
+                    {
+                        for (q = 0; q < 4U; q++)
+                        {
+                            idx = blk + k + q * m;
+                            b[q] = _mm_packs_epi32(b[q], b[q]);
+                            _amem4(&out[ch * outStride + idx]) = (uint32_t) _mm_cvtsi128_si32(b[q]);
+                            _amem4(&out[(ch + 1U) * outStride + idx]) =
+                                (uint32_t) _mm_extract_epi32(b[q], 1);
+                        }
+                    }
+                    else
+                    {
+                        _mm_storeu_si128((__m128i *) &x[ch],  b[0]);
+                        _mm_storeu_si128((__m128i *) &x1[ch], b[1]);
+                        _mm_storeu_si128((__m128i *) &x2[ch], b[2]);
+                        _mm_storeu_si128((__m128i *) &x3[ch], b[3]);
+                    }
+                }
+            }
+#endif
+            if (ch < numCh)
+            {
+                for (q = 1; q < 4U; q++)
+                {
+                    w[q] = twiddle[q * k * step];
+                }
+            }
+            for (; ch < numCh; ch++)
+            {
+                re[0] = x[ch].real;
+                im[0] = x[ch].imag;
+                for (q = 1; q < 4U; q++)
+                {
+                    re[q] = x[q * m * numCh + ch].real;
+                    im[q] = x[q * m * numCh + ch].imag;
+                    OdsDemo_rangeFftCmul(&re[q], &im[q], w[q]);
+                }
+                OdsDemo_rangeFftBfly4(re, im, 1);
+
+                for (q = 0; q < 4U; q++)
+                {
+                    if (out != NULL)
+                    {
+                        _amem4(&out[ch * outStride + blk + k + q * m]) = _spack2(im[q], re[q]);
+                    }
+                    else
+                    {
+                        x[q * m * numCh + ch].real = re[q];
+                        x[q * m * numCh + ch].imag = im[q];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Input offsets from offBound[numIn] to offBound[numIn - 1] - 1 feed
+ *      numIn ADC samples to their first stage butterfly, the others are
+ *      zero padding.
+ */
+static void OdsDemo_rangeFftOffBounds(uint32_t numAdcSamples, uint32_t radix, uint32_t stride,
+                                      uint32_t *offBound)
+{
+    uint32_t numIn;
+    int32_t  bound;
+
+    for (numIn = 0; numIn <= radix; numIn++)
+    {
+        bound = (int32_t) numAdcSamples - (int32_t) (numIn * stride);
+        offBound[numIn] = (bound < 0) ? 0 : (((uint32_t) bound > stride) ? stride : (uint32_t) bound);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Packs one channel of the 32-bit result, element n at y[n * stride],
+ *      to 16 bits with the smallest block exponent for which no value
+ *      saturates, and returns the exponent.
+ */
+static uint8_t OdsDemo_rangeFftPackBfp(const cmplx32ReIm_t * restrict y,
+                                       uint32_t stride,
+                                       uint32_t fftSize,
+                                       cmplx16ReIm_t * restrict out)
+{
+    uint32_t n;
+    int32_t  re, im, rnd;
+    int32_t  magBits = 0;
+    int32_t  blockExp;
+
+    /* the OR of the magnitudes has the same leading bit as their maximum */
+    for (n = 0; n < fftSize; n++)
+    {
+        re = y[n * stride].real;
+        im = y[n * stride].imag;
+        magBits |= (re ^ (re >> 31)) | (im ^ (im >> 31));
+    }
+    blockExp = 16 - (int32_t) _norm(magBits);
+
+    if (blockExp <= 0)
+    {
+        for (n = 0; n < fftSize; n++)
+        {
+            _amem4(&out[n]) = _spack2(y[n * stride].imag, y[n * stride].real);
+        }
+        return 0;
+    }
+
+    /* rounding can still reach 2^15, which saturates */
+    rnd = 1 << (blockExp - 1);
+    for (n = 0; n < fftSize; n++)
+    {
+        _amem4(&out[n]) = _spack2((y[n * stride].imag + rnd) >> blockExp,
+                                  (y[n * stride].real + rnd) >> blockExp);
+    }
+    return (uint8_t) blockExp;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Range FFT of one channel, see @ref OdsDemo_rangeFftWin16x16. With
+ *      out == NULL the 32-bit result is left in scratch, in natural order.
+ */
+static void OdsDemo_rangeFftRun(const cmplx16ReIm_t *adcIn,
+                                const int16_t *window,
+                                uint32_t numAdcSamples,
+                                const cmplx16ReIm_t *twiddle,
+                                cmplx32ReIm_t *scratch,
+                                uint32_t fftSize,
+                                cmplx16ReIm_t *out)
+{
+    uint32_t log2Size = 30U - _norm((int32_t) fftSize);
+    uint32_t radix = (log2Size & 1U) ? 2U : 4U;
+    uint32_t numDigitBits = log2Size - (radix >> 1);
+    uint32_t stride = fftSize / radix;
+    uint32_t offBound[5];
+    uint32_t off, n;
+
+    OdsDemo_rangeFftOffBounds(numAdcSamples, radix, stride, offBound);
+
+    if (radix == 4U)
+    {
+        OdsDemo_rangeFftFirstStage4(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[4], offBound[3], 4U, scratch);
+        OdsDemo_rangeFftFirstStage4(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[3], offBound[2], 3U, scratch);
+        OdsDemo_rangeFftFirstStage4(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[2], offBound[1], 2U, scratch);
+        OdsDemo_rangeFftFirstStage4(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[1], offBound[0], 1U, scratch);
+    }
+    else
+    {
+        OdsDemo_rangeFftFirstStage2(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[2], offBound[1], 2U, scratch);
+        OdsDemo_rangeFftFirstStage2(adcIn, window, numAdcSamples, stride, numDigitBits,
+                                    offBound[1], offBound[0], 1U, scratch);
+    }
+
+    /* Input offsets without any ADC sample */
+    for (off = offBound[0]; off < stride; off++)
+    {
+        for (n = 0; n < radix; n++)
+        {
+            scratch[OdsDemo_rangeFftDigitRev(off, numDigitBits) * radix + n].real = 0;
+            scratch[OdsDemo_rangeFftDigitRev(off, numDigitBits) * radix + n].imag = 0;
+        }
+    }
+
+    if (fftSize == radix)
+    {
+        if (out != NULL)
+        {
+            for (n = 0; n < fftSize; n++)
+            {
+                _amem4(&out[n]) = _spack2(scratch[n].imag, scratch[n].real);
+            }
+        }
+        return;
+    }
+
+    for (n = radix * 4U; n < fftSize; n *= 4U)
+    {
+        OdsDemo_rangeFftStage(scratch, twiddle, fftSize, n, NULL);
+    }
+    OdsDemo_rangeFftStage(scratch, twiddle, fftSize, fftSize, out);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Range FFT of numCh channels, see @ref OdsDemo_rangeFftWin16x16Batch.
+ *      With out == NULL the 32-bit result is left in scratch, interleaved
+ *      by channel.
+ */
+static void OdsDemo_rangeFftBatchRun(const cmplx16ReIm_t *adcIn,
+                                     uint32_t numCh,
+                                     const int16_t *window,
+                                     uint32_t numAdcSamples,
+                                     const cmplx16ReIm_t *twiddle,
+                                     cmplx32ReIm_t *scratch,
+                                     uint32_t fftSize,
+                                     cmplx16ReIm_t *out,
+                                     uint32_t outStride)
+{
+    uint32_t log2Size = 30U - _norm((int32_t) fftSize);
+    uint32_t radix = (log2Size & 1U) ? 2U : 4U;
+    uint32_t numDigitBits = log2Size - (radix >> 1);
+    uint32_t stride = fftSize / radix;
+    uint32_t offBound[5];
+    uint32_t off, n, ch;
+
+    OdsDemo_rangeFftOffBounds(numAdcSamples, radix, stride, offBound);
+
+    if (radix == 4U)
+    {
+        OdsDemo_rangeFftBatchFirstStage4(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[4], offBound[3], 4U, scratch);
+        OdsDemo_rangeFftBatchFirstStage4(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[3], offBound[2], 3U, scratch);
+        OdsDemo_rangeFftBatchFirstStage4(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[2], offBound[1], 2U, scratch);
+        OdsDemo_rangeFftBatchFirstStage4(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[1], offBound[0], 1U, scratch);
+    }
+    else
+    {
+        OdsDemo_rangeFftBatchFirstStage2(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[2], offBound[1], 2U, scratch);
+        OdsDemo_rangeFftBatchFirstStage2(adcIn, numCh, window, numAdcSamples, stride, numDigitBits,
+                                         offBound[1], offBound[0], 1U, scratch);
+    }
+
+    /* Input offsets without any ADC sample */
+    for (off = offBound[0]; off < stride; off++)
+    {
+        for (n = 0; n < radix * numCh; n++)
+        {
+            scratch[OdsDemo_rangeFftDigitRev(off, numDigitBits) * radix * numCh + n].real = 0;
+            scratch[OdsDemo_rangeFftDigitRev(off, numDigitBits) * radix * numCh + n].imag = 0;
+        }
+    }
+
+    if (fftSize == radix)
+    {
+        if (out != NULL)
+        {
+            for (n = 0; n < fftSize; n++)
+            {
+                for (ch = 0; ch < numCh; ch++)
+                {
+                    _amem4(&out[ch * outStride + n]) = _spack2(scratch[n * numCh + ch].imag,
+                                                               scratch[n * numCh + ch].real);
+                }
+            }
+        }
+        return;
+    }
+
+    for (n = radix * 4U; n < fftSize; n *= 4U)
+    {
+        OdsDemo_rangeFftBatchStage(scratch, numCh, twiddle, fftSize, n, NULL, 0);
+    }
+    OdsDemo_rangeFftBatchStage(scratch, numCh, twiddle, fftSize, fftSize, out, outStride);
+}
+
+/**************************************************************************
+ *************************** Exported Functions ***************************
+ **************************************************************************/
+
+void OdsDemo_rangeFftGenTwiddle(cmplx16ReIm_t *twiddle, uint32_t fftSize)
+{
+    uint32_t k;
+    double   re, im;
+
+    for (k = 0; k < ODS_RANGE_FFT_TWIDDLE_LEN(fftSize); k++)
+    {
+        re = floor(0.5 + ODS_RANGE_FFT_TW_SCALE * cos(2.0 * ODS_RANGE_FFT_PI * k / fftSize));
+        im = floor(0.5 + ODS_RANGE_FFT_TW_SCALE * sin(2.0 * ODS_RANGE_FFT_PI * k / fftSize));
+        twiddle[k].real = (int16_t) ((re > 32767.0) ? 32767.0 : re);
+        twiddle[k].imag = (int16_t) -((im > 32767.0) ? 32767.0 : im);
+    }
+}
+
+void OdsDemo_rangeFftWin16x16(const cmplx16ReIm_t *adcIn,
+                              const int16_t *window,
+                              uint32_t numAdcSamples,
+                              const cmplx16ReIm_t *twiddle,
+                              cmplx32ReIm_t *scratch,
+                              uint32_t fftSize,
+                              cmplx16ReIm_t *out)
+{
+    OdsDemo_rangeFftRun(adcIn, window, numAdcSamples, twiddle, scratch, fftSize, out);
+}
+
+void OdsDemo_rangeFftWin16x16Batch(const cmplx16ReIm_t *adcIn,
+                                   uint32_t numCh,
+                                   const int16_t *window,
+                                   uint32_t numAdcSamples,
+                                   const cmplx16ReIm_t *twiddle,
+                                   cmplx32ReIm_t *scratch,
+                                   uint32_t fftSize,
+                                   cmplx16ReIm_t *out,
+                                   uint32_t outStride)
+{
+    if (numCh == 1U)
+    {
+        OdsDemo_rangeFftRun(adcIn, window, numAdcSamples, twiddle, scratch, fftSize, out);
+        return;
+    }
+
+    OdsDemo_rangeFftBatchRun(adcIn, numCh, window, numAdcSamples, twiddle, scratch, fftSize,
+                             out, outStride);
+}
+
+void OdsDemo_rangeFftWin16x16Bfp(const cmplx16ReIm_t *adcIn,
+                                 const int16_t *window,
+                                 uint32_t numAdcSamples,
+                                 const cmplx16ReIm_t *twiddle,
+                                 cmplx32ReIm_t *scratch,
+                                 uint32_t fftSize,
+                                 cmplx16ReIm_t *out,
+                                 uint8_t *blockExp)
+{
+    OdsDemo_rangeFftRun(adcIn, window, numAdcSamples, twiddle, scratch, fftSize, NULL);
+    *blockExp = OdsDemo_rangeFftPackBfp(scratch, 1U, fftSize, out);
+}
+
+void OdsDemo_rangeFftWin16x16BatchBfp(const cmplx16ReIm_t *adcIn,
+                                      uint32_t numCh,
+                                      const int16_t *window,
+                                      uint32_t numAdcSamples,
+                                      const cmplx16ReIm_t *twiddle,
+                                      cmplx32ReIm_t *scratch,
+                                      uint32_t fftSize,
+                                      cmplx16ReIm_t *out,
+                                      uint32_t outStride,
+                                      uint8_t *blockExp)
+{
+    uint32_t ch;
+
+    if (numCh == 1U)
+    {
+        OdsDemo_rangeFftRun(adcIn, window, numAdcSamples, twiddle, scratch, fftSize, NULL);
+    }
+    else
+    {
+        OdsDemo_rangeFftBatchRun(adcIn, numCh, window, numAdcSamples, twiddle, scratch, fftSize,
+                                 NULL, 0);
+    }
+    for (ch = 0; ch < numCh; ch++)
+    {
+        blockExp[ch] = OdsDemo_rangeFftPackBfp(&scratch[ch], numCh, fftSize, &out[ch * outStride]);
+    }
+}
@@ -0,0 +1,209 @@
+/**
+ *   @file  dss_range_fft.h
+ *
+ *   @brief
+ *      Range FFT with windowing and zero padding fused into the first stage.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_RANGE_FFT_H
+#define DSS_RANGE_FFT_H
+
+#include <stdint.h>
+#include <ti/common/sys_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Number of twiddle factors used by @ref OdsDemo_rangeFftWin16x16 */
+#define ODS_RANGE_FFT_TWIDDLE_LEN(fftSize)  (3U * (fftSize) / 4U)
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the twiddle factors of @ref OdsDemo_rangeFftWin16x16,
+ *      exp(-j*2*pi*k/fftSize) in Q15 for k < 3*fftSize/4, rounded like
+ *      gen_twiddle_fft16x16().
+ *
+ *  @param[out] twiddle     Twiddle factors, ODS_RANGE_FFT_TWIDDLE_LEN(fftSize)
+ *  @param[in]  fftSize     FFT size, power of 2
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_rangeFftGenTwiddle(cmplx16ReIm_t *twiddle, uint32_t fftSize);
+
+/**
+ *  @b Description
+ *  @n
+ *      Range FFT of one chirp of one Rx antenna in a single call. The ADC
+ *      samples are windowed as they are loaded by the first (decimation in
+ *      time) butterfly stage, samples beyond numAdcSamples are implicit
+ *      zeros whose butterfly terms are not computed, and the last stage
+ *      writes the 16-bit result to the output buffer. The input is not
+ *      modified.
+ *
+ *      The scaling is the one of DSP_fft16x16: every radix-4 stage but the
+ *      last one is scaled by 2. Intermediate stages are kept in 32 bits in
+ *      the scratch buffer, so no intermediate stage saturates.
+ *
+ *  @param[in]  adcIn           ADC samples, numAdcSamples
+ *  @param[in]  window          Symmetric Q15 window, first numAdcSamples/2
+ *                              coefficients
+ *  @param[in]  numAdcSamples   Number of ADC samples, even, <= fftSize
+ *  @param[in]  twiddle         Twiddle factors from @ref OdsDemo_rangeFftGenTwiddle
+ *  @param[in]  scratch         Scratch buffer, fftSize, 8 byte aligned
+ *  @param[in]  fftSize         FFT size, power of 2, 2 to 4096
+ *  @param[out] out             FFT output, fftSize, 4 byte aligned
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_rangeFftWin16x16(const cmplx16ReIm_t *adcIn,
+                              const int16_t *window,
+                              uint32_t numAdcSamples,
+                              const cmplx16ReIm_t *twiddle,
+                              cmplx32ReIm_t *scratch,
+                              uint32_t fftSize,
+                              cmplx16ReIm_t *out);
+
+/**
+ *  @b Description
+ *  @n
+ *      Range FFT of one chirp of numCh Rx antennas in a single call, with
+ *      the same arithmetic and output as @ref OdsDemo_rangeFftWin16x16 for
+ *      each antenna. The antennas are transformed together with the
+ *      intermediate stages interleaved by antenna in the scratch buffer, so
+ *      every window coefficient and twiddle factor is loaded once per chirp
+ *      instead of once per antenna.
+ *
+ *  @param[in]  adcIn           ADC samples, antenna ch at adcIn + ch * numAdcSamples,
+ *                              4 byte aligned
+ *  @param[in]  numCh           Number of Rx antennas
+ *  @param[in]  window          Symmetric Q15 window, first numAdcSamples/2
+ *                              coefficients
+ *  @param[in]  numAdcSamples   Number of ADC samples, even, <= fftSize
+ *  @param[in]  twiddle         Twiddle factors from @ref OdsDemo_rangeFftGenTwiddle
+ *  @param[in]  scratch         Scratch buffer, numCh * fftSize, 8 byte aligned
+ *  @param[in]  fftSize         FFT size, power of 2, 2 to 4096
+ *  @param[out] out             FFT output, antenna ch at out + ch * outStride,
+ *                              4 byte aligned
+ *  @param[in]  outStride       Distance between the outputs of two antennas
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_rangeFftWin16x16Batch(const cmplx16ReIm_t *adcIn,
+                                   uint32_t numCh,
+                                   const int16_t *window,
+                                   uint32_t numAdcSamples,
+                                   const cmplx16ReIm_t *twiddle,
+                                   cmplx32ReIm_t *scratch,
+                                   uint32_t fftSize,
+                                   cmplx16ReIm_t *out,
+                                   uint32_t outStride);
+
+/**
+ *  @b Description
+ *  @n
+ *      Range FFT of one chirp of one Rx antenna with block floating point
+ *      output. The arithmetic is the one of @ref OdsDemo_rangeFftWin16x16,
+ *      but the last stage is kept in 32 bits and packed to 16 bits with the
+ *      smallest exponent for which no value saturates, so that
+ *      out * 2^blockExp is the unsaturated output of
+ *      @ref OdsDemo_rangeFftWin16x16. If no value exceeds 16 bits the
+ *      exponent is 0 and the output is identical.
+ *
+ *  @param[in]  adcIn           ADC samples, numAdcSamples
+ *  @param[in]  window          Symmetric Q15 window, first numAdcSamples/2
+ *                              coefficients
+ *  @param[in]  numAdcSamples   Number of ADC samples, even, <= fftSize
+ *  @param[in]  twiddle         Twiddle factors from @ref OdsDemo_rangeFftGenTwiddle
+ *  @param[in]  scratch         Scratch buffer, fftSize, 8 byte aligned
+ *  @param[in]  fftSize         FFT size, power of 2, 2 to 4096
+ *  @param[out] out             FFT output mantissas, fftSize, 4 byte aligned
+ *  @param[out] blockExp        Block exponent of the output
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_rangeFftWin16x16Bfp(const cmplx16ReIm_t *adcIn,
+                                 const int16_t *window,
+                                 uint32_t numAdcSamples,
+                                 const cmplx16ReIm_t *twiddle,
+                                 cmplx32ReIm_t *scratch,
+                                 uint32_t fftSize,
+                                 cmplx16ReIm_t *out,
+                                 uint8_t *blockExp);
+
+/**
+ *  @b Description
+ *  @n
+ *      Batched version of @ref OdsDemo_rangeFftWin16x16Bfp, with the
+ *      buffers of @ref OdsDemo_rangeFftWin16x16Batch and one block exponent
+ *      per antenna.
+ *
+ *  @param[in]  adcIn           ADC samples, antenna ch at adcIn + ch * numAdcSamples,
+ *                              4 byte aligned
+ *  @param[in]  numCh           Number of Rx antennas
+ *  @param[in]  window          Symmetric Q15 window, first numAdcSamples/2
+ *                              coefficients
+ *  @param[in]  numAdcSamples   Number of ADC samples, even, <= fftSize
+ *  @param[in]  twiddle         Twiddle factors from @ref OdsDemo_rangeFftGenTwiddle
+ *  @param[in]  scratch         Scratch buffer, numCh * fftSize, 8 byte aligned
+ *  @param[in]  fftSize         FFT size, power of 2, 2 to 4096
+ *  @param[out] out             FFT output mantissas, antenna ch at out + ch * outStride,
+ *                              4 byte aligned
+ *  @param[in]  outStride       Distance between the outputs of two antennas
+ *  @param[out] blockExp        Block exponents, numCh
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_rangeFftWin16x16BatchBfp(const cmplx16ReIm_t *adcIn,
+                                      uint32_t numCh,
+                                      const int16_t *window,
+                                      uint32_t numAdcSamples,
+                                      const cmplx16ReIm_t *twiddle,
+                                      cmplx32ReIm_t *scratch,
+                                      uint32_t fftSize,
+                                      cmplx16ReIm_t *out,
+                                      uint32_t outStride,
+                                      uint8_t *blockExp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSS_RANGE_FFT_H */
@@ -61,6 +61,7 @@
 #define ODS_EDMA_CH_3D_IN_PONG           EDMA_TPCC0_REQ_FREE_9
 #define ODS_EDMA_CH_SIGIMG_MON           EDMA_TPCC0_REQ_FREE_10
 #define ODS_EDMA_CH_RX_SATURATION_MON    EDMA_TPCC0_REQ_FREE_11
+#define ODS_EDMA_CH_DET_MATRIX3          EDMA_TPCC0_REQ_FREE_12
 
 /*shadow*/
 #define ODS_EDMA_CH_1D_IN_PING_SHADOW           (EDMA_NUM_DMA_CHANNELS + 0U)
@@ -73,6 +74,7 @@
 #define ODS_EDMA_CH_DET_MATRIX2_SHADOW          (EDMA_NUM_DMA_CHANNELS + 7U)
 #define ODS_EDMA_CH_3D_IN_PING_SHADOW           (EDMA_NUM_DMA_CHANNELS + 8U)
 #define ODS_EDMA_CH_3D_IN_PONG_SHADOW           (EDMA_NUM_DMA_CHANNELS + 9U)
+#define ODS_EDMA_CH_DET_MATRIX3_SHADOW          (EDMA_NUM_DMA_CHANNELS + 10U)
 /*************************Data path EDMA resources END*******************************/
 
 /*************************LVDS streaming EDMA resources*******************************/
@@ -0,0 +1,519 @@
+/**
+ *   @file  dss_scene_gen.c
+ *
+ *   @brief
+ *      Synthetic FMCW scene generator.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#ifndef _TMS320C6X
+#include <stdio.h>
+#endif
+
+/* BIOS/XDC Include Files. */
+#include <xdc/std.h>
+#include <xdc/runtime/System.h>
+
+/* ODS Demo Include Files */
+#include "dss_ods.h"
+#include "dss_data_path.h"
+#include "dss_adc_replay.h"
+#include "dss_scene_gen.h"
+
+/**************************************************************************
+ *************************** Local Definitions ****************************
+ **************************************************************************/
+
+/*! @brief profileCfg start frequency LSB in Hz */
+#define ODS_SCENE_FREQ_LSB_HZ           (3.6e9 / (1U << 26))
+
+/*! @brief profileCfg frequency slope LSB in Hz/s */
+#define ODS_SCENE_SLOPE_LSB_HZ_PER_S    ((3.6e3 * 900) / (1U << 26) * 1e12)
+
+/*! @brief profileCfg time LSB in seconds */
+#define ODS_SCENE_TIME_LSB_S            (10e-9)
+
+/*! @brief Field of view of the random target and clutter angles */
+#define ODS_SCENE_MAX_AZIMUTH           (60.0f * (float)PI_ / 180.0f)
+#define ODS_SCENE_MAX_ELEVATION         (20.0f * (float)PI_ / 180.0f)
+
+/*! @brief Generated data does not depend on the order of generation, so
+           every random stream is derived from a hash of its coordinates */
+#define ODS_SCENE_STREAM_CLUTTER        0x434C5554U
+#define ODS_SCENE_STREAM_NOISE          0x4E4F4953U
+#define ODS_SCENE_STREAM_LATTICE        0x4C415454U
+
+/**************************************************************************
+ *************************** Local Functions ******************************
+ **************************************************************************/
+
+static uint32_t OdsDemo_sceneHash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7FEB352DU;
+    x ^= x >> 15;
+    x *= 0x846CA68BU;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Uniform in [0, 1) and advances the stream */
+static float OdsDemo_sceneUniform(uint32_t *state)
+{
+    *state += 0x9E3779B9U;
+    return (float)(OdsDemo_sceneHash(*state) >> 8) * (1.0f / 16777216.0f);
+}
+
+/* Uniform in [-max, max) */
+static float OdsDemo_sceneSymmetric(uint32_t *state, float max)
+{
+    return (2.0f * OdsDemo_sceneUniform(state) - 1.0f) * max;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Static clutter scatterer idx, derived from the seed only.
+ */
+static void OdsDemo_sceneClutter(const OdsDemo_sceneGen *scene, uint32_t idx,
+                                 OdsDemo_sceneTarget *target)
+{
+    uint32_t state = OdsDemo_sceneHash(scene->cfg.seed ^ ODS_SCENE_STREAM_CLUTTER) + idx * 0x632BE5ABU;
+    float minRange = 2.0f * scene->rangeResolution;
+
+    target->range     = minRange + OdsDemo_sceneUniform(&state) * (scene->cfg.clutterMaxRange - minRange);
+    target->velocity  = 0;
+    target->azimuth   = OdsDemo_sceneSymmetric(&state, ODS_SCENE_MAX_AZIMUTH);
+    target->elevation = OdsDemo_sceneSymmetric(&state, ODS_SCENE_MAX_ELEVATION);
+    target->amplitude = scene->cfg.clutterAmplitude * (0.1f + 0.9f * OdsDemo_sceneUniform(&state));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Adds the echo of one target to the chirp accumulator.
+ *
+ *  @param[in]  scene       Generator instance
+ *  @param[in]  target      Target
+ *  @param[in]  frameTime   Time of the frame start since frame 0 in seconds
+ *  @param[in]  chirpTime   Time of the chirp start since the frame start in seconds
+ *  @param[in]  chirpIdx    Chirp index within the frame
+ *  @param[in]  rxIdx       Receive channel
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void OdsDemo_sceneAddTarget(OdsDemo_sceneGen *scene, const OdsDemo_sceneTarget *target,
+                                   float frameTime, float chirpTime, uint32_t chirpIdx,
+                                   uint32_t rxIdx)
+{
+    static const int8_t rxRow[] = ODS_ANT_RX_ROW;
+    static const int8_t rxCol[] = ODS_ANT_RX_COL;
+    static const int8_t txRow[] = ODS_ANT_TX_ROW;
+    static const int8_t txCol[] = ODS_ANT_TX_COL;
+    const OdsDemo_sceneCfg *cfg = &scene->cfg;
+    float u, w, range, phase, spatial;
+    float gainRe, gainIm, curRe, curIm, stepRe, stepIm, tmp;
+    float *acc = scene->lineBuf;
+    uint32_t txIdx, n;
+
+    /* Direction cosines on the azimuth (columns) and elevation (rows) axes of
+       the angle FFT grid, half wavelength spacing */
+    u = sinf(target->azimuth) * cosf(target->elevation);
+    w = sinf(target->elevation);
+
+    /* Array response of the transmit antennas active in this chirp */
+    if (cfg->chirpScheme == ODS_SCENE_CHIRP_BPM)
+    {
+        spatial = (float)PI_ * (u * (rxCol[rxIdx] + txCol[0]) + w * (rxRow[rxIdx] + txRow[0]));
+        gainRe  = cosf(spatial);
+        gainIm  = sinf(spatial);
+        spatial = (float)PI_ * (u * (rxCol[rxIdx] + txCol[1]) + w * (rxRow[rxIdx] + txRow[1]));
+        if (chirpIdx & 1U)
+        {
+            gainRe -= cosf(spatial);
+            gainIm -= sinf(spatial);
+        }
+        else
+        {
+            gainRe += cosf(spatial);
+            gainIm += sinf(spatial);
+        }
+    }
+    else
+    {
+        txIdx   = chirpIdx % cfg->numTxAntennas;
+        spatial = (float)PI_ * (u * (rxCol[rxIdx] + txCol[txIdx]) + w * (rxRow[rxIdx] + txRow[txIdx]));
+        gainRe  = cosf(spatial);
+        gainIm  = sinf(spatial);
+    }
+
+    /* Range at the chirp start, the motion within a chirp is neglected */
+    range = target->range + target->velocity * chirpTime;
+    if (cfg->moveTargets)
+    {
+        range += target->velocity * frameTime;
+    }
+
+    phase = fmodf(4.0f * (float)PI_ * range / scene->lambda, 2.0f * (float)PI_);
+    curRe = target->amplitude * (gainRe * cosf(phase) - gainIm * sinf(phase));
+    curIm = target->amplitude * (gainRe * sinf(phase) + gainIm * cosf(phase));
+
+    phase  = scene->beatPerMeter * range;
+    stepRe = cosf(phase);
+    stepIm = sinf(phase);
+
+    for (n = 0; n < cfg->numAdcSamples; n++)
+    {
+        acc[2 * n]     += curRe;
+        acc[2 * n + 1] += curIm;
+        tmp   = curRe * stepRe - curIm * stepIm;
+        curIm = curRe * stepIm + curIm * stepRe;
+        curRe = tmp;
+    }
+}
+
+static int16_t OdsDemo_sceneSaturate(float x)
+{
+    x = (x < 0) ? (x - 0.5f) : (x + 0.5f);
+    if (x > ODS_SCENE_ADC_FULL_SCALE)
+    {
+        return 32767;
+    }
+    if (x < -ODS_SCENE_ADC_FULL_SCALE)
+    {
+        return -32767;
+    }
+    return (int16_t)x;
+}
+
+/**************************************************************************
+ ************************** Exported Functions ****************************
+ **************************************************************************/
+
+int32_t OdsDemo_sceneInit(OdsDemo_sceneGen *scene, const OdsDemo_sceneCfg *cfg,
+                          const OdsDemo_sceneTarget *targets, uint32_t numTargets,
+                          cmplx16ReIm_t *eventBuf)
+{
+    double slope, fs, startFreq, numRangeBins, numDopplerBins;
+
+    memset((void *)scene, 0, sizeof(OdsDemo_sceneGen));
+
+    if ((cfg->numRxAntennas == 0) || (cfg->numRxAntennas > SYS_COMMON_NUM_RX_CHANNEL) ||
+        (cfg->numTxAntennas == 0) || (cfg->numTxAntennas > SYS_COMMON_NUM_TX_ANTENNAS) ||
+        ((cfg->chirpScheme == ODS_SCENE_CHIRP_BPM) && (cfg->numTxAntennas != 2)))
+    {
+        System_printf("Error: scene with %d Rx %d Tx not supported\n",
+                      cfg->numRxAntennas, cfg->numTxAntennas);
+        return -1;
+    }
+    if ((cfg->numAdcSamples == 0) || (cfg->numAdcSamples > ODS_SCENE_MAX_ADC_SAMPLES) ||
+        ((cfg->numAdcSamples % 4) != 0) || (cfg->numChirpsPerChirpEvent == 0) ||
+        ((cfg->numChirpsPerFrame % cfg->numChirpsPerChirpEvent) != 0) ||
+        ((cfg->numChirpsPerFrame % cfg->numTxAntennas) != 0))
+    {
+        System_printf("Error: scene chirp layout not supported\n");
+        return -1;
+    }
+    if ((cfg->freqSlopeConst == 0) || (cfg->digOutSampleRate == 0) ||
+        (cfg->startFreqConst == 0) || ((cfg->idleTimeConst + cfg->rampEndTime) == 0))
+    {
+        System_printf("Error: scene profile not set\n");
+        return -1;
+    }
+
+    scene->cfg        = *cfg;
+    scene->targets    = targets;
+    scene->numTargets = numTargets;
+    scene->eventBuf   = eventBuf;
+
+    slope          = cfg->freqSlopeConst * ODS_SCENE_SLOPE_LSB_HZ_PER_S;
+    fs             = cfg->digOutSampleRate * 1e3;
+    startFreq      = cfg->startFreqConst * ODS_SCENE_FREQ_LSB_HZ;
+    numRangeBins   = OdsDemo_pow2roundup(cfg->numAdcSamples);
+    numDopplerBins = cfg->numChirpsPerFrame / cfg->numTxAntennas;
+
+    scene->lambda             = (float)(ODS_SCENE_SPEED_OF_LIGHT / startFreq);
+    scene->beatPerMeter       = (float)(2.0 * PI_ * 2.0 * slope / (ODS_SCENE_SPEED_OF_LIGHT * fs));
+    scene->chirpPeriod        = (float)((cfg->idleTimeConst + cfg->rampEndTime) * ODS_SCENE_TIME_LSB_S);
+    scene->rangeResolution    = (float)(ODS_SCENE_SPEED_OF_LIGHT * fs / (2.0 * fabs(slope) * numRangeBins));
+    scene->velocityResolution = (float)(scene->lambda /
+                                        (2.0 * numDopplerBins * cfg->numTxAntennas * scene->chirpPeriod));
+    return 0;
+}
+
+uint32_t OdsDemo_sceneEventSize(const OdsDemo_sceneCfg *cfg)
+{
+    return (uint32_t)cfg->numRxAntennas * cfg->numChirpsPerChirpEvent *
+           cfg->numAdcSamples * sizeof(cmplx16ReIm_t);
+}
+
+void OdsDemo_sceneGetHeader(const OdsDemo_sceneGen *scene, uint32_t numFrames,
+                            OdsDemo_adcCaptureHeader *header)
+{
+    const OdsDemo_sceneCfg *cfg = &scene->cfg;
+
+    memset((void *)header, 0, sizeof(OdsDemo_adcCaptureHeader));
+    header->magic                  = ODS_ADC_CAPTURE_MAGIC;
+    header->version                = ODS_ADC_CAPTURE_VERSION;
+    header->headerSize             = sizeof(OdsDemo_adcCaptureHeader);
+    header->numFrames              = numFrames;
+    header->frameIndexOffset       = sizeof(OdsDemo_adcCaptureHeader);
+    header->frameSize              = OdsDemo_sceneEventSize(cfg) *
+                                     (cfg->numChirpsPerFrame / cfg->numChirpsPerChirpEvent);
+    header->numAdcSamples          = cfg->numAdcSamples;
+    header->numRxAntennas          = cfg->numRxAntennas;
+    header->numTxAntennas          = cfg->numTxAntennas;
+    header->numChirpsPerFrame      = cfg->numChirpsPerFrame;
+    header->numChirpsPerChirpEvent = cfg->numChirpsPerChirpEvent;
+    header->rxChannelEn            = (uint8_t)((1U << cfg->numRxAntennas) - 1U);
+    header->txChannelEn            = (uint8_t)((1U << cfg->numTxAntennas) - 1U);
+    header->adcFmt                 = 0;
+    header->iqSwapSel              = cfg->iqSwapSel;
+    header->framePeriodUs          = cfg->framePeriodUs;
+    header->startFreqConst         = cfg->startFreqConst;
+    header->freqSlopeConst         = cfg->freqSlopeConst;
+    header->digOutSampleRate       = cfg->digOutSampleRate;
+    header->idleTimeConst          = cfg->idleTimeConst;
+    header->rampEndTime            = cfg->rampEndTime;
+}
+
+void OdsDemo_sceneGenChirpEvent(OdsDemo_sceneGen *scene, uint32_t frameNum,
+                                uint32_t eventIdx, cmplx16ReIm_t *buf)
+{
+    const OdsDemo_sceneCfg *cfg = &scene->cfg;
+    OdsDemo_sceneTarget clutter;
+    cmplx16ReIm_t *out;
+    float frameTime, chirpTime, mag, arg;
+    uint32_t rxIdx, chirpInEvent, chirpIdx, targetIdx, n, state;
+
+    frameTime = (float)((double)frameNum * cfg->framePeriodUs * 1e-6);
+
+    for (rxIdx = 0; rxIdx < cfg->numRxAntennas; rxIdx++)
+    {
+        for (chirpInEvent = 0; chirpInEvent < cfg->numChirpsPerChirpEvent; chirpInEvent++)
+        {
+            chirpIdx  = eventIdx * cfg->numChirpsPerChirpEvent + chirpInEvent;
+            chirpTime = chirpIdx * scene->chirpPeriod;
+
+            memset((void *)scene->lineBuf, 0, 2 * cfg->numAdcSamples * sizeof(float));
+
+            for (targetIdx = 0; targetIdx < scene->numTargets; targetIdx++)
+            {
+                OdsDemo_sceneAddTarget(scene, &scene->targets[targetIdx], frameTime, chirpTime,
+                                       chirpIdx, rxIdx);
+            }
+            for (targetIdx = 0; targetIdx < cfg->numClutter; targetIdx++)
+            {
+                OdsDemo_sceneClutter(scene, targetIdx, &clutter);
+                OdsDemo_sceneAddTarget(scene, &clutter, 0, chirpTime, chirpIdx, rxIdx);
+            }
+
+            /* Complex white Gaussian noise (Box-Muller), one stream per chirp
+               and receive channel */
+            if (cfg->noiseRms > 0)
+            {
+                state = OdsDemo_sceneHash(cfg->seed ^ ODS_SCENE_STREAM_NOISE) ^
+                        OdsDemo_sceneHash((frameNum * cfg->numChirpsPerFrame + chirpIdx) *
+                                          SYS_COMMON_NUM_RX_CHANNEL + rxIdx);
+                for (n = 0; n < cfg->numAdcSamples; n++)
+                {
+                    mag = cfg->noiseRms *
+                          sqrtf(-2.0f * logf(1.0f - OdsDemo_sceneUniform(&state)));
+                    arg = 2.0f * (float)PI_ * OdsDemo_sceneUniform(&state);
+                    scene->lineBuf[2 * n]     += mag * cosf(arg);
+                    scene->lineBuf[2 * n + 1] += mag * sinf(arg);
+                }
+            }
+
+            out = &buf[(rxIdx * cfg->numChirpsPerChirpEvent + chirpInEvent) * cfg->numAdcSamples];
+            for (n = 0; n < cfg->numAdcSamples; n++)
+            {
+                if (cfg->iqSwapSel)
+                {
+                    out[n].real = OdsDemo_sceneSaturate(scene->lineBuf[2 * n + 1]);
+                    out[n].imag = OdsDemo_sceneSaturate(scene->lineBuf[2 * n]);
+                }
+                else
+                {
+                    out[n].real = OdsDemo_sceneSaturate(scene->lineBuf[2 * n]);
+                    out[n].imag = OdsDemo_sceneSaturate(scene->lineBuf[2 * n + 1]);
+                }
+            }
+        }
+    }
+}
+
+const cmplx16ReIm_t *OdsDemo_sceneEventFxn(uintptr_t arg, uint32_t frameNum, uint32_t eventIdx)
+{
+    OdsDemo_sceneGen *scene = (OdsDemo_sceneGen *)arg;
+
+    OdsDemo_sceneGenChirpEvent(scene, frameNum, eventIdx, scene->eventBuf);
+    return scene->eventBuf;
+}
+
+uint32_t OdsDemo_scenePlaceLattice(const OdsDemo_sceneGen *scene, OdsDemo_sceneTarget *targets,
+                                   uint32_t numTargets, float minAmplitude, float maxAmplitude,
+                                   uint32_t seed)
+{
+    const OdsDemo_sceneCfg *cfg = &scene->cfg;
+    uint32_t numRangeBins   = OdsDemo_pow2roundup(cfg->numAdcSamples);
+    uint32_t numDopplerBins = cfg->numChirpsPerFrame / cfg->numTxAntennas;
+    uint32_t usableRangeBins = numRangeBins - 2;
+    uint32_t stepRange, stepDoppler, numCols, numRows, idx;
+    uint32_t state = OdsDemo_sceneHash(seed ^ ODS_SCENE_STREAM_LATTICE);
+    int32_t dopplerIdx;
+    float pitch;
+
+    if (numTargets == 0)
+    {
+        return 0;
+    }
+
+    /* Start from the square lattice pitch in bins rounded up and refine the
+       coarser axis until the lattice holds numTargets */
+    pitch = ceilf(sqrtf((float)usableRangeBins * numDopplerBins / numTargets));
+    stepRange   = (pitch < 1.0f) ? 1U : (uint32_t)pitch;
+    stepDoppler = stepRange;
+    numCols = usableRangeBins / stepRange;
+    numRows = numDopplerBins / stepDoppler;
+    while ((numCols * numRows < numTargets) && ((stepRange > 1) || (stepDoppler > 1)))
+    {
+        if (stepRange >= stepDoppler)
+        {
+            stepRange--;
+        }
+        else
+        {
+            stepDoppler--;
+        }
+        numCols = usableRangeBins / stepRange;
+        numRows = numDopplerBins / stepDoppler;
+    }
+    if (numTargets > numCols * numRows)
+    {
+        numTargets = numCols * numRows;
+    }
+
+    for (idx = 0; idx < numTargets; idx++)
+    {
+        dopplerIdx = (int32_t)((idx / numCols) * stepDoppler) - (int32_t)(numDopplerBins / 2);
+
+        targets[idx].range     = (1 + (idx % numCols) * stepRange) * scene->rangeResolution;
+        targets[idx].velocity  = dopplerIdx * scene->velocityResolution;
+        targets[idx].azimuth   = OdsDemo_sceneSymmetric(&state, ODS_SCENE_MAX_AZIMUTH);
+        targets[idx].elevation = OdsDemo_sceneSymmetric(&state, ODS_SCENE_MAX_ELEVATION);
+        targets[idx].amplitude = minAmplitude + (maxAmplitude - minAmplitude) * OdsDemo_sceneUniform(&state);
+    }
+
+    return numTargets;
+}
+
+#ifndef _TMS320C6X
+int32_t OdsDemo_sceneWriteCapture(OdsDemo_sceneGen *scene, const char *path,
+                                  uint32_t numFrames)
+{
+    OdsDemo_adcCaptureHeader header;
+    OdsDemo_adcCaptureFrameIdx frameIdx;
+    uint32_t frameNum, eventIdx, numEvents, eventSize, dataOffset;
+    int32_t retVal = -1;
+    FILE *fp;
+
+    if (scene->eventBuf == NULL)
+    {
+        System_printf("Error: scene has no chirp event buffer\n");
+        return -1;
+    }
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        System_printf("Error: unable to create ADC capture %s\n", path);
+        return -1;
+    }
+
+    OdsDemo_sceneGetHeader(scene, numFrames, &header);
+    numEvents  = scene->cfg.numChirpsPerFrame / scene->cfg.numChirpsPerChirpEvent;
+    eventSize  = OdsDemo_sceneEventSize(&scene->cfg);
+    dataOffset = header.frameIndexOffset + numFrames * sizeof(OdsDemo_adcCaptureFrameIdx);
+    dataOffset = (dataOffset + ODS_ADC_CAPTURE_FRAME_ALIGN - 1U) & ~(ODS_ADC_CAPTURE_FRAME_ALIGN - 1U);
+
+    if (fwrite(&header, sizeof(header), 1, fp) != 1)
+    {
+        goto exit;
+    }
+    for (frameNum = 0; frameNum < numFrames; frameNum++)
+    {
+        frameIdx.offset      = dataOffset + frameNum * header.frameSize;
+        frameIdx.timeStampUs = frameNum * header.framePeriodUs;
+        if (fwrite(&frameIdx, sizeof(frameIdx), 1, fp) != 1)
+        {
+            goto exit;
+        }
+    }
+    if (fseek(fp, dataOffset, SEEK_SET) != 0)
+    {
+        goto exit;
+    }
+
+    for (frameNum = 0; frameNum < numFrames; frameNum++)
+    {
+        for (eventIdx = 0; eventIdx < numEvents; eventIdx++)
+        {
+            OdsDemo_sceneGenChirpEvent(scene, frameNum, eventIdx, scene->eventBuf);
+            if (fwrite(scene->eventBuf, eventSize, 1, fp) != 1)
+            {
+                goto exit;
+            }
+        }
+    }
+    retVal = 0;
+
+exit:
+    if (retVal < 0)
+    {
+        System_printf("Error: writing ADC capture %s failed\n", path);
+    }
+    fclose(fp);
+    return retVal;
+}
+#endif
@@ -0,0 +1,331 @@
+/**
+ *   @file  dss_scene_gen.h
+ *
+ *   @brief
+ *      Synthetic FMCW scene generator.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DSS_SCENE_GEN_H
+#define DSS_SCENE_GEN_H
+
+#include <stdint.h>
+#include "dss_data_path.h"
+#include "dss_adc_replay.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Speed of light used by the generator */
+#define ODS_SCENE_SPEED_OF_LIGHT        (3.0e8)
+
+/*! @brief Full scale of the generated 16-bit ADC samples */
+#define ODS_SCENE_ADC_FULL_SCALE        32767.0f
+
+/*! @brief Maximum number of ADC samples per chirp */
+#define ODS_SCENE_MAX_ADC_SAMPLES       1024U
+
+/**
+ * @brief
+ *  Chirp (multiplexing) scheme of the transmit antennas
+ */
+typedef enum OdsDemo_sceneChirpScheme_e
+{
+    /*! @brief TDM-MIMO, chirp m is sent by transmit antenna m % numTxAntennas */
+    ODS_SCENE_CHIRP_TDM = 0,
+
+    /*! @brief BPM-MIMO (bpmCfg), both transmit antennas send every chirp,
+               the second one with phase 0 on even and pi on odd chirps */
+    ODS_SCENE_CHIRP_BPM
+} OdsDemo_sceneChirpScheme;
+
+/**
+ * @brief
+ *  Point target
+ */
+typedef struct OdsDemo_sceneTarget_t
+{
+    /*! @brief Range at frame 0 in meters */
+    float       range;
+
+    /*! @brief Radial velocity in m/s, positive moving away */
+    float       velocity;
+
+    /*! @brief Azimuth in radians, positive towards +x */
+    float       azimuth;
+
+    /*! @brief Elevation in radians, positive towards +z */
+    float       elevation;
+
+    /*! @brief Amplitude per receive channel in ADC LSBs */
+    float       amplitude;
+} OdsDemo_sceneTarget;
+
+/**
+ * @brief
+ *  Scene generator configuration
+ *
+ * @details
+ *  The chirp and frame layout uses the same fields and units as the capture
+ *  header (profileCfg units for the profile), so that a configuration
+ *  matching a CLI profile produces data the chain processes exactly like a
+ *  capture of that profile.
+ */
+typedef struct OdsDemo_sceneCfg_t
+{
+    /*! @brief Number of ADC samples per chirp */
+    uint16_t    numAdcSamples;
+
+    /*! @brief Number of receive channels (up to 4) */
+    uint8_t     numRxAntennas;
+
+    /*! @brief Number of transmit antennas (up to 2, 2 for BPM) */
+    uint8_t     numTxAntennas;
+
+    /*! @brief Number of chirps per frame */
+    uint16_t    numChirpsPerFrame;
+
+    /*! @brief Number of chirps per chirp event (ADC buffer chirp threshold) */
+    uint16_t    numChirpsPerChirpEvent;
+
+    /*! @brief Chirp scheme */
+    OdsDemo_sceneChirpScheme chirpScheme;
+
+    /*! @brief IQ swap selection of adcbufCfg */
+    uint8_t     iqSwapSel;
+
+    /*! @brief Targets move along their line of sight from frame to frame */
+    uint8_t     moveTargets;
+
+    /*! @brief Profile start frequency (profileCfg units) */
+    uint32_t    startFreqConst;
+
+    /*! @brief Profile frequency slope (profileCfg units) */
+    int16_t     freqSlopeConst;
+
+    /*! @brief Profile ADC sampling rate in ksps */
+    uint16_t    digOutSampleRate;
+
+    /*! @brief Profile idle time (profileCfg units) */
+    uint32_t    idleTimeConst;
+
+    /*! @brief Profile ramp end time (profileCfg units) */
+    uint32_t    rampEndTime;
+
+    /*! @brief Frame periodicity in micro seconds */
+    uint32_t    framePeriodUs;
+
+    /*! @brief Standard deviation of the complex white noise per I and Q in
+               ADC LSBs, 0 for no noise */
+    float       noiseRms;
+
+    /*! @brief Number of static clutter scatterers */
+    uint32_t    numClutter;
+
+    /*! @brief Maximum amplitude of a clutter scatterer in ADC LSBs */
+    float       clutterAmplitude;
+
+    /*! @brief Clutter scatterers are spread up to this range in meters */
+    float       clutterMaxRange;
+
+    /*! @brief Seed of the noise and clutter, equal seeds give equal data */
+    uint32_t    seed;
+} OdsDemo_sceneCfg;
+
+/**
+ * @brief
+ *  Scene generator instance
+ *
+ * @details
+ *  The instance holds the accumulator of one chirp (8 KB), on the target it
+ *  is meant to be placed in L3 next to the chirp event buffer.
+ */
+typedef struct OdsDemo_sceneGen_t
+{
+    /*! @brief Configuration */
+    OdsDemo_sceneCfg            cfg;
+
+    /*! @brief Targets, owned by the caller */
+    const OdsDemo_sceneTarget   *targets;
+
+    /*! @brief Number of targets */
+    uint32_t                    numTargets;
+
+    /*! @brief Chirp event buffer for the replay source, owned by the caller */
+    cmplx16ReIm_t               *eventBuf;
+
+    /*! @brief Wavelength in meters */
+    float                       lambda;
+
+    /*! @brief Beat frequency per meter of range in radians per sample */
+    float                       beatPerMeter;
+
+    /*! @brief Chirp repetition period in seconds */
+    float                       chirpPeriod;
+
+    /*! @brief Range covered by one range FFT bin in meters */
+    float                       rangeResolution;
+
+    /*! @brief Velocity covered by one Doppler FFT bin in m/s */
+    float                       velocityResolution;
+
+    /*! @brief Accumulator of one chirp of one receive channel (I,Q pairs) */
+    float                       lineBuf[2 * ODS_SCENE_MAX_ADC_SAMPLES];
+} OdsDemo_sceneGen;
+
+/**
+ *  @b Description
+ *  @n
+ *      Validates the configuration and prepares the generator. Nothing is
+ *      generated until frames or chirp events are requested.
+ *
+ *  @param[out] scene       Generator instance
+ *  @param[in]  cfg         Configuration
+ *  @param[in]  targets     Targets, must stay valid while the generator is used
+ *  @param[in]  numTargets  Number of targets
+ *  @param[in]  eventBuf    Buffer of @ref OdsDemo_sceneEventSize bytes used by
+ *                          @ref OdsDemo_sceneEventFxn, may be NULL otherwise
+ *
+ *  @retval
+ *      0 on success, -1 if the configuration is not supported.
+ */
+int32_t OdsDemo_sceneInit(OdsDemo_sceneGen *scene, const OdsDemo_sceneCfg *cfg,
+                          const OdsDemo_sceneTarget *targets, uint32_t numTargets,
+                          cmplx16ReIm_t *eventBuf);
+
+/**
+ *  @b Description
+ *  @n
+ *      Size of one chirp event in bytes.
+ *
+ *  @param[in]  cfg     Configuration
+ *
+ *  @retval
+ *      Chirp event size.
+ */
+uint32_t OdsDemo_sceneEventSize(const OdsDemo_sceneCfg *cfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Fills the capture header describing the generated stream.
+ *
+ *  @param[in]  scene       Generator instance
+ *  @param[in]  numFrames   Number of frames of the stream
+ *  @param[out] header      Capture header
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_sceneGetHeader(const OdsDemo_sceneGen *scene, uint32_t numFrames,
+                            OdsDemo_adcCaptureHeader *header);
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates one chirp event of a frame in the ADC buffer layout
+ *      (non-interleaved: for every receive channel, numChirpsPerChirpEvent
+ *      chirps of numAdcSamples samples). Any event of any frame can be
+ *      generated in any order, the result only depends on the configuration,
+ *      the targets and the frame and event numbers.
+ *
+ *  @param[in]  scene       Generator instance
+ *  @param[in]  frameNum    Frame number
+ *  @param[in]  eventIdx    Chirp event within the frame
+ *  @param[out] buf         Chirp event, @ref OdsDemo_sceneEventSize bytes
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void OdsDemo_sceneGenChirpEvent(OdsDemo_sceneGen *scene, uint32_t frameNum,
+                                uint32_t eventIdx, cmplx16ReIm_t *buf);
+
+/**
+ *  @b Description
+ *  @n
+ *      Chirp event source for @ref OdsDemo_adcReplayOpenSource, arg is the
+ *      generator instance. Generates into the event buffer of the generator.
+ *
+ *  @retval
+ *      Generated chirp event.
+ */
+const cmplx16ReIm_t *OdsDemo_sceneEventFxn(uintptr_t arg, uint32_t frameNum, uint32_t eventIdx);
+
+/**
+ *  @b Description
+ *  @n
+ *      Places targets one per range/Doppler cell on a lattice spread over
+ *      the whole range/Doppler plane (range bin 0 and the far end excluded),
+ *      with random angles in the field of view and random amplitudes.
+ *      Targets sit exactly on bin centres and the lattice pitch is as coarse
+ *      as numTargets allows, so the number of CFAR detections follows
+ *      numTargets closely and can be pushed to MAX_DET_OBJECTS_RAW.
+ *
+ *  @param[in]  scene       Generator instance (for the resolutions)
+ *  @param[out] targets     Targets
+ *  @param[in]  numTargets  Number of targets to place
+ *  @param[in]  minAmplitude Minimum amplitude in ADC LSBs
+ *  @param[in]  maxAmplitude Maximum amplitude in ADC LSBs
+ *  @param[in]  seed        Seed of the angles and amplitudes
+ *
+ *  @retval
+ *      Number of targets placed, less than numTargets if the plane is full.
+ */
+uint32_t OdsDemo_scenePlaceLattice(const OdsDemo_sceneGen *scene, OdsDemo_sceneTarget *targets,
+                                   uint32_t numTargets, float minAmplitude, float maxAmplitude,
+                                   uint32_t seed);
+
+#ifndef _TMS320C6X
+/**
+ *  @b Description
+ *  @n
+ *      Writes numFrames frames to a file in the capture format of the replay
+ *      driver, one chirp event at a time.
+ *
+ *  @param[in]  scene       Generator instance
+ *  @param[in]  path        Capture file
+ *  @param[in]  numFrames   Number of frames
+ *
+ *  @retval
+ *      0 on success, -1 on error.
+ */
+int32_t OdsDemo_sceneWriteCapture(OdsDemo_sceneGen *scene, const char *path,
+                                  uint32_t numFrames);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSS_SCENE_GEN_H */
@@ -0,0 +1,100 @@
+/**
+ *   @file  host_main.c
+ *
+ *   @brief
+ *      Entry point of the host build of the DSS stage benchmarks.
+ *
+ *      Usage: ods_bench [result.csv [baseline.csv]]
+ *
+ *      The results are written to ODS_BENCH_RESULT_FILE unless another file
+ *      is given. If a baseline is given the results are compared with it and
+ *      the exit status is non zero on a regression.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ti/drivers/edma/edma.h>
+#include "dss_data_path.h"
+#include "dss_benchmark.h"
+
+/*! @brief EDMA instance used by the EDMA fixtures, as in the DSS init task */
+#define ODS_HOST_BENCH_EDMA_INSTANCE    0U
+
+/**************************************************************************
+ *************************** Global Definitions ***************************
+ **************************************************************************/
+
+/*! @brief Data path context, only its EDMA handle is used by the fixtures */
+static OdsDemo_DSS_dataPathContext_t gOdsHostBenchContext;
+
+int main(int argc, char *argv[])
+{
+    const char  *resultPath = ODS_BENCH_RESULT_FILE;
+    const char  *baselinePath = NULL;
+    int32_t     errCode;
+    int32_t     retVal;
+
+    if (argc > 1)
+    {
+        resultPath = argv[1];
+    }
+    if (argc > 2)
+    {
+        baselinePath = argv[2];
+    }
+
+    errCode = EDMA_init(ODS_HOST_BENCH_EDMA_INSTANCE);
+    if (errCode != EDMA_NO_ERROR)
+    {
+        System_printf("Error: EDMA_init failed with error %d\n", errCode);
+        return 1;
+    }
+    gOdsHostBenchContext.edmaHandle[0] = EDMA_open(ODS_HOST_BENCH_EDMA_INSTANCE, &errCode, NULL);
+    if (gOdsHostBenchContext.edmaHandle[0] == NULL)
+    {
+        System_printf("Error: EDMA_open failed with error %d\n", errCode);
+        return 1;
+    }
+
+    retVal = OdsDemo_benchRun(&gOdsHostBenchContext, resultPath, baselinePath);
+
+    return (retVal != 0) ? 1 : 0;
+}
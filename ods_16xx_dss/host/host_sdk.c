@@ -0,0 +1,142 @@
+/**
+ *   @file  host_sdk.c
+ *
+ *   @brief
+ *      Host implementations of the SDK and DSS main functions and globals the
+ *      benchmark build links against, see host_sdk.h. The EDMA driver is
+ *      provided by dss_host_edma.c.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "host_sdk.h"
+#include "dss_data_path.h"
+
+/**************************************************************************
+ *************************** Global Definitions ***************************
+ **************************************************************************/
+
+/*! @brief Data path cycle log, defined by dss_main.c in the DSP build */
+volatile cycleLog_t gCycleLog;
+
+/**************************************************************************
+ ************************** Host SDK Functions ****************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the DSS assert hook. The DSP build forwards the
+ *      location to the MSS, here it is printed and the process aborted.
+ *
+ *  @param[in]  expression  Asserted expression
+ *  @param[in]  file        Source file of the assert
+ *  @param[in]  line        Source line of the assert
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void _OdsDemo_dssAssert(int32_t expression, const char *file, int32_t line)
+{
+    if (!expression)
+    {
+        System_printf("Error: Assert at %s:%d\n", file, (int)line);
+        abort();
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the OSAL assert. _OdsDemo_dssAssert has already
+ *      aborted on a failed expression, so this has nothing left to do.
+ *
+ *  @param[in]  expression  Asserted expression
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void DebugP_assert(int32_t expression)
+{
+    if (!expression)
+    {
+        abort();
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the SOC address translation. The host address space
+ *      is flat, so the address is returned unchanged.
+ *
+ *  @param[in]  addr     Address to translate
+ *  @param[in]  dir      Translation direction, ignored
+ *  @param[out] errCode  Error code, set to 0 if not NULL
+ *
+ *  @retval
+ *      The address.
+ */
+uint32_t SOC_translateAddress(uint32_t addr, int32_t dir, int32_t *errCode)
+{
+    (void) dir;
+    if (errCode != NULL)
+    {
+        *errCode = 0;
+    }
+    return addr;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host version of the SYS/BIOS semaphore parameter initialization.
+ *
+ *  @param[out] params  Parameters to initialize
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void Semaphore_Params_init(Semaphore_Params *params)
+{
+    params->mode = 0;
+}
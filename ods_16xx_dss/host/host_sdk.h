@@ -0,0 +1,403 @@
+/**
+ *   @file  host_sdk.h
+ *
+ *   @brief
+ *      Minimal stand-in for the mmWave SDK, SYS/BIOS and XDC headers used by
+ *      the host build of the DSS benchmark. Every SDK header the data path
+ *      includes is generated by the host makefile as a one line file that
+ *      includes this header.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2016 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HOST_SDK_H
+#define HOST_SDK_H
+
+/* Only the types, constants and functions the benchmark build references
+ * are provided. Structures keep the field names of SDK 02.00.00.04 but not
+ * necessarily their layout, the host build never exchanges them with the
+ * MSS. The functions are implemented in host_sdk.c and dss_host_edma.c. */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************
+ ************************ XDC and SYS/BIOS ********************************
+ **************************************************************************/
+
+typedef int             Bool;
+typedef int             Int;
+typedef unsigned int    UInt;
+typedef uintptr_t       UArg;
+
+#ifndef TRUE
+#define TRUE    1
+#endif
+#ifndef FALSE
+#define FALSE   0
+#endif
+
+/*! @brief TI far data qualifier, meaningless on the host */
+#define far
+
+#define System_printf           printf
+#define BIOS_WAIT_FOREVER       0xFFFFFFFFU
+
+typedef void *Task_Handle;
+typedef void *Event_Handle;
+typedef void *Semaphore_Handle;
+typedef struct { int32_t priority; } Task_Params;
+typedef struct { int32_t mode; } Semaphore_Params;
+
+#define Semaphore_Mode_BINARY   1
+
+void Semaphore_Params_init(Semaphore_Params *params);
+Semaphore_Handle Semaphore_create(int32_t count, Semaphore_Params *params, void *eb);
+void Semaphore_post(Semaphore_Handle handle);
+Bool Semaphore_pend(Semaphore_Handle handle, uint32_t timeout);
+void Task_sleep(uint32_t ticks);
+void *Memory_alloc(void *heap, uint32_t size, uint32_t align, void *eb);
+
+/**************************************************************************
+ ***************************** ti/common **********************************
+ **************************************************************************/
+
+#define SYS_COMMON_NUM_TX_ANTENNAS          2
+#define SYS_COMMON_NUM_RX_CHANNEL           4
+#define SYS_COMMON_CQ_MAX_CHIRP_THRESHOLD   16
+
+#define MAX(x,y) ((x) > (y) ? (x) : (y))
+#define MIN(x,y) ((x) < (y) ? (x) : (y))
+
+typedef struct { int16_t real, imag; } cmplx16ReIm_t;
+typedef struct { int16_t imag, real; } cmplx16ImRe_t;
+typedef struct { int32_t real, imag; } cmplx32ReIm_t;
+typedef struct { int32_t imag, real; } cmplx32ImRe_t;
+
+/**************************************************************************
+ ****************************** ti/drivers ********************************
+ **************************************************************************/
+
+#define SOC_XWR16XX_DSS_L3RAM_SIZE          0xC0000
+#define SOC_XWR16XX_DSS_HSRAM_SIZE          0x8000
+#define SOC_TranslateAddr_Dir_TO_EDMA       0
+#define SOC_TranslateAddr_Dir_FROM_EDMA     1
+
+typedef void *SOC_Handle;
+typedef void *SOC_SysIntListenerHandle;
+typedef void *HwiP_Handle;
+typedef void *SemaphoreP_Handle;
+typedef void *ADCBuf_Handle;
+typedef void *UART_Handle;
+typedef void *Mbox_Handle;
+typedef void *CBUFF_Handle;
+typedef void *CBUFF_SessionHandle;
+typedef struct { int32_t unused; } CBUFF_EDMAChannelCfg;
+
+/*! @brief The host address space is flat, translation is the identity */
+uint32_t SOC_translateAddress(uint32_t addr, int32_t dir, int32_t *errCode);
+void DebugP_assert(int32_t expression);
+
+/* EDMA driver, implemented by the software engine in dss_host_edma.c */
+#define EDMA_NUM_CC                         2
+#define EDMA_NUM_DMA_CHANNELS               64
+#define EDMA_EVENT_QUEUE_THRESHOLD_MAX      16
+#define EDMA_NO_ERROR                       0
+#define EDMA_E_INVALID__DMA_CHAN_ID         (-2)
+#define EDMA_E_INVALID__PARAM_ID            (-3)
+#define EDMA_NULL_LINK_ADDRESS              0xFFFFU
+#define EDMA3_SYNC_A                        0
+#define EDMA3_SYNC_AB                       1
+#define EDMA3_CHANNEL_TYPE_DMA              0
+#define EDMA3_ADDRESSING_MODE_LINEAR        0
+#define EDMA3_FIFO_WIDTH_8BIT               0
+
+#define EDMA_TPCC0_REQ_FREE_0       0
+#define EDMA_TPCC0_REQ_FREE_1       1
+#define EDMA_TPCC0_REQ_FREE_2       2
+#define EDMA_TPCC0_REQ_FREE_3       3
+#define EDMA_TPCC0_REQ_FREE_4       4
+#define EDMA_TPCC0_REQ_FREE_5       5
+#define EDMA_TPCC0_REQ_FREE_6       6
+#define EDMA_TPCC0_REQ_FREE_7       7
+#define EDMA_TPCC0_REQ_FREE_8       8
+#define EDMA_TPCC0_REQ_FREE_9       9
+#define EDMA_TPCC0_REQ_FREE_10      10
+#define EDMA_TPCC0_REQ_FREE_11      11
+#define EDMA_TPCC0_REQ_FREE_12      12
+#define EDMA_TPCC0_REQ_FREE_13      13
+#define EDMA_TPCC0_REQ_FREE_14      14
+#define EDMA_TPCC0_REQ_FREE_15      15
+#define EDMA_TPCC0_REQ_FREE_16      16
+#define EDMA_TPCC0_REQ_FREE_17      17
+#define EDMA_TPCC0_REQ_FREE_18      18
+#define EDMA_TPCC0_REQ_FREE_19      19
+#define EDMA_TPCC0_REQ_FREE_20      20
+#define EDMA_TPCC0_REQ_FREE_21      21
+
+typedef void *EDMA_Handle;
+typedef void (*EDMA_transferCompletionCallbackFxn_t)(uintptr_t arg,
+                                                     uint8_t transferCompletionCode);
+
+typedef struct EDMA_paramSetConfig_t_
+{
+    uint32_t sourceAddress;
+    uint32_t destinationAddress;
+    uint16_t aCount;
+    uint16_t bCount;
+    uint16_t cCount;
+    uint16_t bCountReload;
+    int16_t  sourceBindex;
+    int16_t  destinationBindex;
+    int16_t  sourceCindex;
+    int16_t  destinationCindex;
+    uint16_t linkAddress;
+    uint8_t  transferType;
+    uint8_t  transferCompletionCode;
+    uint8_t  sourceAddressingMode;
+    uint8_t  destinationAddressingMode;
+    uint8_t  fifoWidth;
+    bool     isStaticSet;
+    bool     isEarlyCompletion;
+    bool     isFinalTransferInterruptEnabled;
+    bool     isIntermediateTransferInterruptEnabled;
+    bool     isFinalChainingEnabled;
+    bool     isIntermediateChainingEnabled;
+} EDMA_paramSetConfig_t;
+
+typedef struct EDMA_channelConfig_t_
+{
+    uint8_t  channelId;
+    uint8_t  channelType;
+    uint16_t paramId;
+    uint8_t  eventQueueId;
+    EDMA_paramSetConfig_t paramSetConfig;
+    EDMA_transferCompletionCallbackFxn_t transferCompletionCallbackFxn;
+    uintptr_t transferCompletionCallbackFxnArg;
+} EDMA_channelConfig_t;
+
+typedef struct EDMA_paramConfig_t_
+{
+    EDMA_paramSetConfig_t paramSetConfig;
+    EDMA_transferCompletionCallbackFxn_t transferCompletionCallbackFxn;
+    uintptr_t transferCompletionCallbackFxnArg;
+} EDMA_paramConfig_t;
+
+typedef struct EDMA_errorConfig_t_
+{
+    bool    isConfigAllEventQueues;
+    bool    isConfigAllTransferControllers;
+    bool    isEventQueueThresholdingEnabled;
+    bool    isEnableAllTransferControllerErrors;
+    uint8_t eventQueueThreshold;
+    void    *callbackFxn;
+    void    *transferControllerCallbackFxn;
+} EDMA_errorConfig_t;
+
+typedef struct { int32_t unused; } EDMA_instanceInfo_t;
+typedef struct { int32_t unused; } EDMA_errorInfo_t;
+typedef struct { int32_t unused; } EDMA_transferControllerErrorInfo_t;
+
+uint8_t EDMA_getNumInstances(void);
+int32_t EDMA_init(uint8_t instanceId);
+EDMA_Handle EDMA_open(uint8_t instanceId, int32_t *errorCode, EDMA_instanceInfo_t *instanceInfo);
+int32_t EDMA_configErrorMonitoring(EDMA_Handle handle, EDMA_errorConfig_t const *config);
+int32_t EDMA_configChannel(EDMA_Handle handle, EDMA_channelConfig_t const *config,
+                           bool isEnableChannel);
+int32_t EDMA_configParamSet(EDMA_Handle handle, uint16_t paramId,
+                            EDMA_paramConfig_t const *config);
+int32_t EDMA_linkParamSets(EDMA_Handle handle, uint16_t fromParamId, uint16_t toParamId);
+int32_t EDMA_chainChannels(EDMA_Handle handle, uint16_t fromParamId, uint8_t toChannelId);
+int32_t EDMA_disableChannel(EDMA_Handle handle, uint8_t channelId, uint8_t channelType);
+int32_t EDMA_startTransfer(EDMA_Handle handle, uint8_t channelId, uint8_t channelType);
+int32_t EDMA_startDmaTransfer(EDMA_Handle handle, uint8_t channelId);
+int32_t EDMA_isTransferComplete(EDMA_Handle handle, uint8_t transferCompletionCode,
+                                bool *isTransferComplete);
+int32_t EDMA_setSourceAddress(EDMA_Handle handle, uint16_t paramId, uint32_t sourceAddress);
+int32_t EDMA_setDestinationAddress(EDMA_Handle handle, uint16_t paramId,
+                                   uint32_t destinationAddress);
+
+/**************************************************************************
+ *************************** ti/control, mmwavelink ***********************
+ **************************************************************************/
+
+#define RL_MAX_SUBFRAMES            4
+#define RL_NUM_MON_SLICES_MAX       127
+
+typedef void *MMWave_Handle;
+typedef int32_t MMWave_ErrorLevel;
+typedef struct { int32_t unused; } MMWave_CtrlCfg;
+typedef struct { int32_t unused; } MMWave_OpenCfg;
+typedef struct { int32_t unused; } rlProfileCfg_t;
+typedef struct { int32_t unused; } rlChirpCfg_t;
+typedef struct { int32_t unused; } rlFrameCfg_t;
+typedef struct { uint8_t profileIndx, satMonSel, numSlices; } rlRxSatMonConf_t;
+typedef struct { uint8_t profileIndx, numSlices; } rlSigImgMonConf_t;
+
+/**************************************************************************
+ ************************* ti/utils, ti/demo ******************************
+ **************************************************************************/
+
+#define DSP_CLOCK_MHZ                           600U
+#define MMWDEMO_OUTPUT_MSG_MAX                  10
+#define MMW_MAX_OBJ_OUT                         100
+#define MMWDEMO_XYZ_Q_FORMAT                    7
+#define DC_RANGE_SIGNATURE_COMP_MAX_BIN_SIZE    32
+#define MMW_PEAK_GROUPING_DET_MATRIX_BASED      1
+#define MMW_PEAK_GROUPING_CFAR_PEAK_BASED       2
+#define MMWDEMO_MEMORY_ALLOC_MAX_STRUCT_ALIGN   8
+#define MMWDEMO_MEMORY_ALLOC_DOUBLE_WORD_ALIGN  8
+
+#define ROUND(x) ((x) < 0 ? ((x) - 0.5) : ((x) + 0.5))
+#define DOPPLER_IDX_TO_SIGNED(_idx, _fftSize) \
+    ((_idx) < (_fftSize)/2 ? ((int16_t) (_idx)) : ((int16_t) (_idx) - (int16_t) (_fftSize)))
+#define DOPPLER_IDX_TO_UNSIGNED(_idx, _fftSize) ((_idx) & ((_fftSize) - 1))
+#define MMWDEMO_SATURATE_HIGH(x) ((x) > 32767 ? 32767 : (x))
+#define MMWDEMO_SATURATE_LOW(x) ((x) < -32768 ? -32768 : (x))
+
+/*! @brief Host builds have no cycle counter, stage cycles read as 0 */
+static inline uint32_t Cycleprofiler_getTimeStamp(void)
+{
+    return 0U;
+}
+
+typedef struct { uint32_t w[16]; } HSIHeader;
+
+typedef struct
+{
+    uint16_t rangeIdx;
+    int16_t  dopplerIdx;
+    uint16_t peakVal;
+    int16_t  x, y, z;
+} MmwDemo_detectedObj;
+
+typedef struct { uint16_t numDetetedObj; uint16_t xyzQFormat; } MmwDemo_output_message_dataObjDescr;
+typedef struct
+{
+    uint32_t magicWord[2];
+    uint32_t version;
+    uint32_t totalPacketLen;
+    uint32_t platform;
+    uint32_t frameNumber;
+    uint32_t timeCpuCycles;
+    uint32_t numDetectedObj;
+    uint32_t numTLVs;
+    uint32_t subFrameNumber;
+} MmwDemo_output_message_header;
+typedef struct { uint32_t type, length; } MmwDemo_output_message_tl;
+typedef struct { int32_t unused; } MmwDemo_detInfoMsg;
+
+typedef struct
+{
+    uint8_t  averageMode;
+    uint8_t  winLen;
+    uint8_t  guardLen;
+    uint8_t  noiseDivShift;
+    uint8_t  cyclicMode;
+    uint16_t thresholdScale;
+} MmwDemo_CfarCfg;
+
+typedef struct
+{
+    uint8_t  scheme;
+    uint8_t  inRangeDirectionEn;
+    uint8_t  inDopplerDirectionEn;
+    uint16_t minRangeIndex;
+    uint16_t maxRangeIndex;
+} MmwDemo_PeakGroupingCfg;
+
+typedef struct { uint8_t enabled; float multiPeakThrsScal; } MmwDemo_MultiObjBeamFormingCfg;
+typedef struct
+{
+    uint8_t  enabled;
+    int16_t  negativeBinIdx;
+    int16_t  positiveBinIdx;
+    uint16_t numAvgChirps;
+} MmwDemo_CalibDcRangeSigCfg;
+typedef struct { uint8_t enabled; } MmwDemo_ExtendedMaxVelocityCfg;
+typedef struct { uint8_t enabled; } MmwDemo_ClutterRemovalCfg;
+typedef struct { uint8_t enabled; uint16_t startRangeIdx, endRangeIdx; } MmwDemo_NearFieldCorrectionCfg;
+typedef struct { uint8_t isEnabled; uint8_t chirp0Idx, chirp1Idx; } MmwDemo_BpmCfg;
+typedef struct { uint8_t adcFmt, iqSwapSel, chInterleave, chirpThreshold; } MmwDemo_ADCBufCfg;
+typedef struct { uint8_t dataFmt, isHeaderEnabled, isSwEnabled; } MmwDemo_LvdsStreamCfg;
+typedef struct
+{
+    uint8_t detectedObjects;
+    uint8_t logMagRange;
+    uint8_t noiseProfile;
+    uint8_t rangeAzimuthHeatMap;
+    uint8_t rangeDopplerHeatMap;
+    uint8_t statsInfo;
+} MmwDemo_GuiMonSel;
+typedef struct { uint8_t enabled; float targetDistance, searchWinSize; } MmwDemo_measureRxChannelBiasCfg_t;
+typedef struct { float rangeBias; cmplx16ImRe_t rxChPhaseComp[8]; } MmwDemo_compRxChannelBiasCfg_t;
+typedef struct { uint8_t rxSatMonEn, sigImgMonEn; } MmwDemo_AnaMonitorCfg;
+
+typedef struct
+{
+    MmwDemo_compRxChannelBiasCfg_t      compRxChanCfg;
+    MmwDemo_measureRxChannelBiasCfg_t   measureRxChanCfg;
+    rlRxSatMonConf_t                    cqSatMonCfg[4];
+    rlSigImgMonConf_t                   cqSigImgMonCfg[4];
+    MmwDemo_AnaMonitorCfg               anaMonCfg;
+} MmwDemo_CliCommonCfg_t;
+
+typedef struct
+{
+    MmwDemo_GuiMonSel               guiMonSel;
+    MmwDemo_CfarCfg                 cfarCfgRange;
+    MmwDemo_CfarCfg                 cfarCfgDoppler;
+    MmwDemo_PeakGroupingCfg         peakGroupingCfg;
+    MmwDemo_MultiObjBeamFormingCfg  multiObjBeamFormingCfg;
+    MmwDemo_CalibDcRangeSigCfg      calibDcRangeSigCfg;
+    MmwDemo_ExtendedMaxVelocityCfg  extendedMaxVelocityCfg;
+    MmwDemo_ClutterRemovalCfg       clutterRemovalCfg;
+    MmwDemo_NearFieldCorrectionCfg  nearFieldCorrectionCfg;
+    MmwDemo_LvdsStreamCfg           lvdsStreamCfg;
+    MmwDemo_BpmCfg                  bpmCfg;
+    MmwDemo_ADCBufCfg               adcBufCfg;
+} MmwDemo_CliCfg_t;
+
+typedef struct { int32_t unused; } MmwDemo_Cfg;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SDK_H */
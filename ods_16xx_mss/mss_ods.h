@@ -53,6 +53,7 @@
 
 /* MMW Demo Include Files */
 #include <ti/demo/io_interface/mmw_config.h>
+#include "common/ods_messages.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -193,6 +194,33 @@ typedef struct OdsDemo_MCB_t
 
     /*! @brief   CLI related configuration common across all subframes */
     OdsDemo_CliCommonCfg_t      cliCommonCfg;
+
+    /*! @brief   Static clutter filter configuration */
+    OdsDemo_StaticClutterCfg    staticClutterCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Batched range FFT configuration */
+    OdsDemo_RangeFftBatchCfg    rangeFftBatchCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Block floating point radar cube configuration */
+    OdsDemo_RadarCubeBfpCfg     radarCubeBfpCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Radar cube layout configuration */
+    OdsDemo_RadarCubeLayoutCfg  radarCubeLayoutCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Object list capacity configuration */
+    OdsDemo_ObjCapCfg           objCapCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Sub-bin interpolation configuration */
+    OdsDemo_SubBinInterpCfg     subBinInterpCfg[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Range CFAR threshold table configuration */
+    OdsDemo_CfarThrTableCfg     cfarThrTableCfgRange[RL_MAX_SUBFRAMES];
+
+    /*! @brief   Doppler CFAR threshold table configuration */
+    OdsDemo_CfarThrTableCfg     cfarThrTableCfgDoppler[RL_MAX_SUBFRAMES];
+
+    /*! @brief   CFAR threshold calibration configuration */
+    OdsDemo_CfarThrCalibCfg     cfarThrCalibCfg[RL_MAX_SUBFRAMES];
  
     /*! * @brief   Handle to the SOC Module */
     SOC_Handle                  socHandle;
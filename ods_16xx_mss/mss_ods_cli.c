@@ -90,6 +90,13 @@ static int32_t OdsDemo_CLIMultiObjBeamForming (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLICalibDcRangeSig (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLIExtendedMaxVelocity (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLIClutterRemoval (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLIStaticClutterCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLIRangeFftBatchCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLIRadarCubeBfpCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLIObjCapCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLISubBinInterpCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLICfarThrTableCfg (int32_t argc, char* argv[]);
+static int32_t OdsDemo_CLICfarThrCalibCfg (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLISensorStart (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLISensorStop (int32_t argc, char* argv[]);
 static int32_t OdsDemo_CLIGuiMonSel (int32_t argc, char* argv[]);
@@ -701,6 +708,559 @@ static int32_t OdsDemo_CLIClutterRemoval (int32_t argc, char* argv[])
         return -1;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the static clutter filter configuration.
+ *      Alpha is the weight of the current frame in the cross frame IIR
+ *      update of the clutter map, 1 is equivalent to per frame mean removal.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLIStaticClutterCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_StaticClutterCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    float               alpha;
+    uint8_t             indx;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 4, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    alpha = (float) atof (argv[3]);
+    if ((alpha <= 0.) || (alpha > 1.))
+    {
+        CLI_write ("Error: alpha must be in the range (0, 1]\n");
+        return -1;
+    }
+
+    /* Initialize configuration for the static clutter filter */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_StaticClutterCfg));
+
+    /* Populate configuration: */
+    cfg.enabled          = (uint8_t) atoi (argv[2]);
+    cfg.alphaQ15         = (uint16_t) (alpha * 32768. + 0.5);
+    if (cfg.alphaQ15 == 0)
+    {
+        cfg.alphaQ15 = 1;
+    }
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.staticClutterCfg[indx], (void *)&cfg, sizeof(OdsDemo_StaticClutterCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_STATIC_CLUTTER_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.staticClutterCfg, (void *)&cfg, sizeof(OdsDemo_StaticClutterCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the batched range FFT configuration.
+ *      When enabled the DSS fetches all Rx antennas of a chirp with one EDMA
+ *      transfer and computes their range FFTs in one call.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLIRangeFftBatchCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_RangeFftBatchCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 3, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the batched range FFT */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_RangeFftBatchCfg));
+
+    /* Populate configuration: */
+    cfg.enabled          = (uint8_t) atoi (argv[2]);
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.rangeFftBatchCfg[indx], (void *)&cfg, sizeof(OdsDemo_RangeFftBatchCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_RANGE_FFT_BATCH_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.rangeFftBatchCfg, (void *)&cfg, sizeof(OdsDemo_RangeFftBatchCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the block floating point radar cube
+ *      configuration. When enabled the range FFT output of every chirp and
+ *      antenna is stored in the radar cube with its own block exponent.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLIRadarCubeBfpCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_RadarCubeBfpCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 3, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the block floating point radar cube */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_RadarCubeBfpCfg));
+
+    /* Populate configuration: */
+    cfg.enabled          = (uint8_t) atoi (argv[2]);
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.radarCubeBfpCfg[indx], (void *)&cfg, sizeof(OdsDemo_RadarCubeBfpCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_RADAR_CUBE_BFP_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.radarCubeBfpCfg, (void *)&cfg, sizeof(OdsDemo_RadarCubeBfpCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the radar cube layout configuration. It
+ *      selects whether the radar cube is stored range-major (1D output order)
+ *      or Doppler-major (2D input order).
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLIRadarCubeLayoutCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_RadarCubeLayoutCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 3, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the radar cube layout */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_RadarCubeLayoutCfg));
+
+    /* Populate configuration: */
+    cfg.layout           = (uint8_t) atoi (argv[2]);
+    if (cfg.layout > ODSDEMO_RADAR_CUBE_LAYOUT_DOPPLER_MAJOR)
+    {
+        CLI_write ("Error: Invalid radar cube layout\n");
+        return -1;
+    }
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.radarCubeLayoutCfg[indx], (void *)&cfg, sizeof(OdsDemo_RadarCubeLayoutCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_RADAR_CUBE_LAYOUT_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.radarCubeLayoutCfg, (void *)&cfg, sizeof(OdsDemo_RadarCubeLayoutCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the object list capacity configuration.
+ *      It sets how many CFAR detections and detected objects are kept per
+ *      frame, the strongest ones being kept when there are more. Zero
+ *      selects the default capacity.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLIObjCapCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_ObjCapCfg   cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+    int32_t             maxNumDetObjRaw;
+    int32_t             maxNumDetObj;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 4, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the object list capacities */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_ObjCapCfg));
+
+    /* Populate configuration: */
+    maxNumDetObjRaw = atoi (argv[2]);
+    maxNumDetObj    = atoi (argv[3]);
+    if ((maxNumDetObjRaw < 0) || (maxNumDetObjRaw > 0xFFFF) ||
+        (maxNumDetObj < 0) || (maxNumDetObj > 0xFFFF))
+    {
+        CLI_write ("Error: Invalid object list capacity\n");
+        return -1;
+    }
+    cfg.maxNumDetObjRaw = (uint16_t) maxNumDetObjRaw;
+    cfg.maxNumDetObj    = (uint16_t) maxNumDetObj;
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.objCapCfg[indx], (void *)&cfg, sizeof(OdsDemo_ObjCapCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_OBJ_CAP_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.objCapCfg, (void *)&cfg, sizeof(OdsDemo_ObjCapCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the sub-bin interpolation configuration.
+ *      When enabled, the range and Doppler indices of the detected objects
+ *      are refined to a fraction of a bin and sent in an additional TLV.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLISubBinInterpCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_SubBinInterpCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 3, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the sub-bin interpolation */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_SubBinInterpCfg));
+
+    /* Populate configuration: */
+    cfg.enabled          = (uint8_t) atoi (argv[2]);
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.subBinInterpCfg[indx], (void *)&cfg, sizeof(OdsDemo_SubBinInterpCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_SUB_BIN_INTERP_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.subBinInterpCfg, (void *)&cfg, sizeof(OdsDemo_SubBinInterpCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the range dependent CFAR threshold table
+ *      of the CFAR along range (procDirection 0) or along Doppler
+ *      (procDirection 1). The table is given as numPoints pairs of range bin
+ *      and threshold offset, no points for the same threshold at all range
+ *      bins. The two dimensional CFAR (range averageMode 4) applies the range
+ *      table only, a Doppler table is then left unused.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLICfarThrTableCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_CfarThrTableCfg cfg;
+    OdsDemo_message     message;
+    uint32_t            procDirection;
+    int32_t             numPoints;
+    int32_t             rangeIdx;
+    int32_t             offset;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+
+    /* The number of points sets the number of arguments */
+    if (argc < 4)
+    {
+        CLI_write ("Error: Invalid usage of the CLI command\n");
+        return -1;
+    }
+    numPoints = atoi (argv[3]);
+    if ((numPoints < 0) || (numPoints > (int32_t) ODS_CFAR_THR_TABLE_MAX_POINTS))
+    {
+        CLI_write ("Error: Invalid number of threshold table points\n");
+        return -1;
+    }
+    if(OdsDemo_CLIGetSubframe(argc, argv, 4 + 2 * numPoints, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the threshold table */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_CfarThrTableCfg));
+
+    /* Populate configuration: */
+    procDirection = (uint32_t) atoi (argv[2]);
+    if (procDirection > 1)
+    {
+        CLI_write ("Error: Invalid processing direction\n");
+        return -1;
+    }
+    cfg.numPoints = (uint8_t) numPoints;
+    for (indx = 0; indx < cfg.numPoints; indx++)
+    {
+        rangeIdx = atoi (argv[4 + 2 * indx]);
+        offset   = atoi (argv[5 + 2 * indx]);
+        if ((rangeIdx < 0) || (rangeIdx > 0xFFFF) ||
+            ((indx > 0) && (rangeIdx <= (int32_t) cfg.rangeIdx[indx - 1])) ||
+            (offset < -32768) || (offset > 32767))
+        {
+            CLI_write ("Error: Invalid threshold table point\n");
+            return -1;
+        }
+        cfg.rangeIdx[indx] = (uint16_t) rangeIdx;
+        cfg.offset[indx]   = (int16_t) offset;
+    }
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            if (procDirection == 0)
+            {
+                memcpy((void *)&gOdsMssMCB.cfarThrTableCfgRange[indx], (void *)&cfg,
+                       sizeof(OdsDemo_CfarThrTableCfg));
+            }
+            else
+            {
+                memcpy((void *)&gOdsMssMCB.cfarThrTableCfgDoppler[indx], (void *)&cfg,
+                       sizeof(OdsDemo_CfarThrTableCfg));
+            }
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    if (procDirection == 0)
+    {
+        message.type = ODSDEMO_MSS2DSS_CFAR_THR_TABLE_RANGE_CFG;
+    }
+    else
+    {
+        message.type = ODSDEMO_MSS2DSS_CFAR_THR_TABLE_DOPPLER_CFG;
+    }
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.cfarThrTableCfg, (void *)&cfg, sizeof(OdsDemo_CfarThrTableCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the CFAR threshold calibration. The first
+ *      numFrames frames after sensor start are taken as empty-room frames,
+ *      after them the threshold tables of both CFAR directions are set margin
+ *      above the noise peak learned per range bin. numFrames 0 disables the
+ *      calibration.
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t OdsDemo_CLICfarThrCalibCfg (int32_t argc, char* argv[])
+{
+    OdsDemo_CfarThrCalibCfg cfg;
+    OdsDemo_message     message;
+    int8_t              subFrameNum;
+    uint8_t             indx;
+    int32_t             numFrames;
+    int32_t             margin;
+
+    if(OdsDemo_CLIGetSubframe(argc, argv, 4, &subFrameNum) < 0)
+    {
+        return -1;
+    }
+
+    /* Initialize configuration for the threshold calibration */
+    memset ((void *)&cfg, 0, sizeof(OdsDemo_CfarThrCalibCfg));
+
+    /* Populate configuration: */
+    numFrames = atoi (argv[2]);
+    margin    = atoi (argv[3]);
+    if ((numFrames < 0) || (numFrames > 0xFFFF) || (margin < 0) || (margin > 0xFFFF))
+    {
+        CLI_write ("Error: Invalid threshold calibration configuration\n");
+        return -1;
+    }
+    cfg.numFrames = (uint16_t) numFrames;
+    cfg.margin    = (uint16_t) margin;
+
+    /* Save Configuration to use later */
+    for(indx = 0; indx < RL_MAX_SUBFRAMES; indx++)
+    {
+        if ((subFrameNum == ODSDEMO_SUBFRAME_NUM_FRAME_LEVEL_CONFIG) || (subFrameNum == indx))
+        {
+            memcpy((void *)&gOdsMssMCB.cfarThrCalibCfg[indx], (void *)&cfg, sizeof(OdsDemo_CfarThrCalibCfg));
+        }
+    }
+
+    /* Send configuration to DSS */
+    memset((void *)&message, 0, sizeof(OdsDemo_message));
+
+    message.type = ODSDEMO_MSS2DSS_CFAR_THR_CALIB_CFG;
+    message.subFrameNum = subFrameNum;
+    memcpy((void *)&message.body.cfarThrCalibCfg, (void *)&cfg, sizeof(OdsDemo_CfarThrCalibCfg));
+
+    if (OdsDemo_mboxWrite(&message) == 0)
+        return 0;
+    else
+        return -1;
+}
+
 /**
  *  @b Description
  *  @n
@@ -1285,6 +1845,46 @@ void OdsDemo_CLIInit (void)
     cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIClutterRemoval;
     cnt++;
 
+    cliCfg.tableEntry[cnt].cmd            = "staticClutterCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <enabled> <alpha>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIStaticClutterCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "rangeFftBatchCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <enabled>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIRangeFftBatchCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "radarCubeBfpCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <enabled>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIRadarCubeBfpCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "radarCubeLayoutCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <layout>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIRadarCubeLayoutCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "objCapCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <maxNumDetObjRaw> <maxNumDetObj>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIObjCapCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "subBinInterpCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <enabled>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLISubBinInterpCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "cfarThrTableCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <procDirection> <numPoints> [<rangeIdx> <offset>]... (2D CFAR: range table only)";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLICfarThrTableCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "cfarThrCalibCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <numFrames> <margin>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLICfarThrCalibCfg;
+    cnt++;
+
     cliCfg.tableEntry[cnt].cmd            = "adcbufCfg";
     cliCfg.tableEntry[cnt].helpString     = "<subFrameIdx> <adcOutputFmt> <SampleSwap> <ChanInterleave> <ChirpThreshold>";
     cliCfg.tableEntry[cnt].cmdHandlerFxn  = OdsDemo_CLIADCBufCfg;